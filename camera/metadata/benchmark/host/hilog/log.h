@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Logging is compiled out for the host metadata benchmark
+#ifndef CAMERA_METADATA_BENCHMARK_HOST_HILOG_LOG_H
+#define CAMERA_METADATA_BENCHMARK_HOST_HILOG_LOG_H
+
+#define LOG_CORE 0
+#define HILOG_DEBUG(type, ...) ((void)0)
+#define HILOG_INFO(type, ...) ((void)0)
+#define HILOG_WARN(type, ...) ((void)0)
+#define HILOG_ERROR(type, ...) ((void)0)
+#define HILOG_FATAL(type, ...) ((void)0)
+#endif // CAMERA_METADATA_BENCHMARK_HOST_HILOG_LOG_H
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// In-memory host replacement for the ipc MessageParcel used by the metadata benchmark
+#ifndef CAMERA_METADATA_BENCHMARK_HOST_MESSAGE_PARCEL_H
+#define CAMERA_METADATA_BENCHMARK_HOST_MESSAGE_PARCEL_H
+
+#include "parcel.h"
+
+namespace OHOS {
+class MessageParcel : public Parcel {
+public:
+    bool WriteRawData(const void *data, size_t size)
+    {
+        return WriteUint32(static_cast<uint32_t>(size)) && WriteUnpadBuffer(data, size);
+    }
+
+    const void *ReadRawData(size_t size)
+    {
+        uint32_t rawSize = 0;
+        if (!ReadUint32(rawSize) || rawSize != size) {
+            return nullptr;
+        }
+        return ReadUnpadBuffer(size);
+    }
+};
+} // namespace OHOS
+#endif // CAMERA_METADATA_BENCHMARK_HOST_MESSAGE_PARCEL_H
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host replacement for the vendor tag HDI, the benchmark never touches vendor tags
+#ifndef CAMERA_METADATA_BENCHMARK_HOST_ICAMERA_VENDOR_TAG_H
+#define CAMERA_METADATA_BENCHMARK_HOST_ICAMERA_VENDOR_TAG_H
+
+#include <cstdint>
+#include <vector>
+#include "parcel.h"
+
+namespace OHOS::HDI::Camera::Metadata::V1_0 {
+struct VendorTag {
+    uint32_t tagId;
+    void *tagName;
+    int8_t tagType;
+};
+
+class ICameraVendorTag {
+public:
+    static sptr<ICameraVendorTag> Get(bool isStub)
+    {
+        (void)isStub;
+        return nullptr;
+    }
+    int32_t GetVendorTagType(uint32_t tagId, int8_t &tagType)
+    {
+        (void)tagId;
+        (void)tagType;
+        return -1;
+    }
+    int32_t GetVendorTagName(uint32_t tagId, void *&tagName)
+    {
+        (void)tagId;
+        (void)tagName;
+        return -1;
+    }
+    int32_t GetAllVendorTags(std::vector<VendorTag> &tagVec)
+    {
+        (void)tagVec;
+        return -1;
+    }
+};
+} // namespace OHOS::HDI::Camera::Metadata::V1_0
+#endif // CAMERA_METADATA_BENCHMARK_HOST_ICAMERA_VENDOR_TAG_H
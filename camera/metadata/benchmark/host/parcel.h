@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// In-memory host replacement for the c_utils Parcel used by the metadata benchmark
+#ifndef CAMERA_METADATA_BENCHMARK_HOST_PARCEL_H
+#define CAMERA_METADATA_BENCHMARK_HOST_PARCEL_H
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace OHOS {
+template <typename T>
+using sptr = T *;
+
+class Parcel;
+
+class Parcelable {
+public:
+    virtual ~Parcelable() = default;
+    virtual bool Marshalling(Parcel &parcel) const = 0;
+};
+
+class Parcel {
+public:
+    virtual ~Parcel() = default;
+
+    bool WriteUnpadBuffer(const void *data, size_t size)
+    {
+        if (data == nullptr && size != 0) {
+            return false;
+        }
+        const uint8_t *begin = static_cast<const uint8_t *>(data);
+        buffer_.insert(buffer_.end(), begin, begin + size);
+        return true;
+    }
+
+    const uint8_t *ReadUnpadBuffer(size_t size)
+    {
+        if (size > buffer_.size() - readPos_) {
+            return nullptr;
+        }
+        const uint8_t *data = buffer_.data() + readPos_;
+        readPos_ += size;
+        return data;
+    }
+
+    bool WriteUint32(uint32_t value)
+    {
+        return WriteUnpadBuffer(&value, sizeof(value));
+    }
+
+    bool WriteUint64(uint64_t value)
+    {
+        return WriteUnpadBuffer(&value, sizeof(value));
+    }
+
+    bool WriteInt32(int32_t value)
+    {
+        return WriteUnpadBuffer(&value, sizeof(value));
+    }
+
+    uint32_t ReadUint32()
+    {
+        uint32_t value = 0;
+        ReadUint32(value);
+        return value;
+    }
+
+    bool ReadUint32(uint32_t &value)
+    {
+        return ReadValue(value);
+    }
+
+    bool ReadUint64(uint64_t &value)
+    {
+        return ReadValue(value);
+    }
+
+    int32_t ReadInt32()
+    {
+        int32_t value = 0;
+        ReadValue(value);
+        return value;
+    }
+
+    bool ReadInt32(int32_t &value)
+    {
+        return ReadValue(value);
+    }
+
+    bool WriteInt32Vector(const std::vector<int32_t> &val)
+    {
+        return WriteVector(val);
+    }
+
+    bool ReadInt32Vector(std::vector<int32_t> *val)
+    {
+        return ReadVector(val);
+    }
+
+    bool WriteUInt32Vector(const std::vector<uint32_t> &val)
+    {
+        return WriteVector(val);
+    }
+
+    bool ReadUInt32Vector(std::vector<uint32_t> *val)
+    {
+        return ReadVector(val);
+    }
+
+    size_t GetDataSize() const
+    {
+        return buffer_.size();
+    }
+
+    size_t GetReadableBytes() const
+    {
+        return buffer_.size() - readPos_;
+    }
+
+private:
+    template <typename T>
+    bool ReadValue(T &value)
+    {
+        const uint8_t *data = ReadUnpadBuffer(sizeof(T));
+        if (data == nullptr) {
+            return false;
+        }
+        memcpy(&value, data, sizeof(T));
+        return true;
+    }
+
+    template <typename T>
+    bool WriteVector(const std::vector<T> &val)
+    {
+        return WriteUint32(static_cast<uint32_t>(val.size())) && WriteUnpadBuffer(val.data(), val.size() * sizeof(T));
+    }
+
+    template <typename T>
+    bool ReadVector(std::vector<T> *val)
+    {
+        uint32_t size = 0;
+        if (val == nullptr || !ReadUint32(size) || size > GetReadableBytes() / sizeof(T)) {
+            return false;
+        }
+        const uint8_t *data = ReadUnpadBuffer(size * sizeof(T));
+        val->resize(size);
+        if (size != 0) {
+            memcpy(val->data(), data, size * sizeof(T));
+        }
+        return true;
+    }
+
+    std::vector<uint8_t> buffer_;
+    size_t readPos_ = 0;
+};
+} // namespace OHOS
+#endif // CAMERA_METADATA_BENCHMARK_HOST_PARCEL_H
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Minimal host replacement for c_utils securec, only used by the metadata benchmark
+#ifndef CAMERA_METADATA_BENCHMARK_HOST_SECUREC_H
+#define CAMERA_METADATA_BENCHMARK_HOST_SECUREC_H
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#define EOK 0
+typedef int errno_t;
+
+inline errno_t memcpy_s(void *dest, size_t destMax, const void *src, size_t count)
+{
+    if (dest == nullptr || src == nullptr || count > destMax) {
+        return -1;
+    }
+    memcpy(dest, src, count);
+    return EOK;
+}
+
+inline errno_t memmove_s(void *dest, size_t destMax, const void *src, size_t count)
+{
+    if (dest == nullptr || src == nullptr || count > destMax) {
+        return -1;
+    }
+    memmove(dest, src, count);
+    return EOK;
+}
+
+inline errno_t memset_s(void *dest, size_t destMax, int c, size_t count)
+{
+    if (dest == nullptr || count > destMax) {
+        return -1;
+    }
+    memset(dest, c, count);
+    return EOK;
+}
+
+inline errno_t strcpy_s(char *dest, size_t destMax, const char *src)
+{
+    if (dest == nullptr || src == nullptr || strlen(src) >= destMax) {
+        return -1;
+    }
+    memcpy(dest, src, strlen(src) + 1);
+    return EOK;
+}
+
+inline int sprintf_s(char *dest, size_t destMax, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int ret = vsnprintf(dest, destMax, format, args);
+    va_end(args);
+    return (ret < 0 || static_cast<size_t>(ret) >= destMax) ? -1 : ret;
+}
+
+inline int snprintf_s(char *dest, size_t destMax, size_t count, const char *format, ...)
+{
+    (void)count;
+    va_list args;
+    va_start(args, format);
+    int ret = vsnprintf(dest, destMax, format, args);
+    va_end(args);
+    return (ret < 0 || static_cast<size_t>(ret) >= destMax) ? -1 : ret;
+}
+#endif // CAMERA_METADATA_BENCHMARK_HOST_SECUREC_H
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "camera_metadata_info.h"
+#include "camera_metadata_item_info.h"
+#include "metadata_utils.h"
+
+using namespace OHOS::Camera;
+
+namespace {
+constexpr uint32_t ITEM_DATA_COUNT = 4;
+constexpr uint32_t ITEM_DATA_BYTES = ITEM_DATA_COUNT * sizeof(double);
+constexpr uint32_t ITEM_DATA_CAPACITY = 8;
+
+const std::vector<uint32_t> &GetBenchmarkTags()
+{
+    static const std::vector<uint32_t> tags = [] {
+        std::vector<uint32_t> validTags;
+        for (const metadata_section_desc_t &desc : g_ohosSectionDescs) {
+            for (uint32_t tag = desc.start; tag < desc.end; tag++) {
+                uint32_t dataType;
+                if (CameraMetadata::GetCameraMetadataItemType(tag, &dataType) == CAM_META_SUCCESS) {
+                    validTags.push_back(tag);
+                }
+            }
+        }
+        return validTags;
+    }();
+    return tags;
+}
+
+// Tags are added in reverse order so that a sorted buffer has to insert in the middle
+std::vector<uint32_t> PickTags(size_t tagCount)
+{
+    const std::vector<uint32_t> &allTags = GetBenchmarkTags();
+    std::vector<uint32_t> tags;
+    for (size_t i = 0; i < tagCount && i < allTags.size(); i++) {
+        tags.push_back(allTags[allTags.size() - 1 - i]);
+    }
+    return tags;
+}
+
+std::shared_ptr<CameraMetadata> BuildMetadata(const std::vector<uint32_t> &tags, bool sorted = false)
+{
+    auto metadata = std::make_shared<CameraMetadata>(tags.size(), tags.size() * ITEM_DATA_BYTES);
+    if (sorted) {
+        SetCameraMetadataItemsSorted(metadata->get(), true);
+    }
+    uint8_t data[ITEM_DATA_BYTES] = {1, 2, 3, 4, 5, 6, 7, 8};
+    for (uint32_t tag : tags) {
+        metadata->addEntry(tag, data, ITEM_DATA_COUNT);
+    }
+    return metadata;
+}
+
+void BM_AddCameraMetadataItem(benchmark::State &state)
+{
+    std::vector<uint32_t> tags = PickTags(state.range(0));
+    uint8_t data[ITEM_DATA_BYTES] = {0};
+    for (auto _ : state) {
+        common_metadata_header_t *meta =
+            AllocateCameraMetadataBuffer(tags.size(), tags.size() * ITEM_DATA_BYTES);
+        for (uint32_t tag : tags) {
+            benchmark::DoNotOptimize(AddCameraMetadataItem(meta, tag, data, ITEM_DATA_COUNT));
+        }
+        FreeCameraMetadataBuffer(meta);
+    }
+    state.SetItemsProcessed(state.iterations() * tags.size());
+}
+
+void BM_GetCameraMetadataItemTagByName(benchmark::State &state)
+{
+    std::vector<const char *> names;
+    for (uint32_t tag : PickTags(state.range(0))) {
+        const char *name = GetCameraMetadataItemName(tag);
+        if (name != nullptr) {
+            names.push_back(name);
+        }
+    }
+    uint32_t item;
+    for (auto _ : state) {
+        for (const char *name : names) {
+            benchmark::DoNotOptimize(GetCameraMetadataItemTagByName(name, &item));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+void BM_AddEntryWithResize(benchmark::State &state)
+{
+    std::vector<uint32_t> tags = PickTags(state.range(0));
+    uint8_t data[ITEM_DATA_BYTES] = {0};
+    for (auto _ : state) {
+        CameraMetadata metadata(1, ITEM_DATA_CAPACITY);
+        for (uint32_t tag : tags) {
+            benchmark::DoNotOptimize(metadata.addEntry(tag, data, ITEM_DATA_COUNT));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * tags.size());
+}
+
+void FindAllTags(benchmark::State &state, bool sorted)
+{
+    std::vector<uint32_t> tags = PickTags(state.range(0));
+    std::shared_ptr<CameraMetadata> metadata = BuildMetadata(tags, sorted);
+    camera_metadata_item_t item;
+    for (auto _ : state) {
+        for (uint32_t tag : tags) {
+            benchmark::DoNotOptimize(FindCameraMetadataItem(metadata->get(), tag, &item));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * tags.size());
+}
+
+void BM_FindCameraMetadataItem(benchmark::State &state)
+{
+    FindAllTags(state, false);
+}
+
+void BM_FindCameraMetadataItemSorted(benchmark::State &state)
+{
+    FindAllTags(state, true);
+}
+
+void BM_UpdateCameraMetadataItem(benchmark::State &state)
+{
+    std::vector<uint32_t> tags = PickTags(state.range(0));
+    std::shared_ptr<CameraMetadata> metadata = BuildMetadata(tags);
+    uint8_t data[ITEM_DATA_BYTES] = {8, 7, 6, 5, 4, 3, 2, 1};
+    for (auto _ : state) {
+        for (uint32_t tag : tags) {
+            benchmark::DoNotOptimize(
+                UpdateCameraMetadataItem(metadata->get(), tag, data, ITEM_DATA_COUNT, nullptr));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * tags.size());
+}
+
+void BM_MetadataVecRoundTrip(benchmark::State &state)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildMetadata(PickTags(state.range(0)));
+    std::vector<uint8_t> cameraAbility;
+    for (auto _ : state) {
+        MetadataUtils::ConvertMetadataToVec(metadata, cameraAbility);
+        std::shared_ptr<CameraMetadata> decoded;
+        MetadataUtils::ConvertVecToMetadata(cameraAbility, decoded);
+        benchmark::DoNotOptimize(decoded);
+    }
+    state.SetBytesProcessed(state.iterations() * cameraAbility.size());
+}
+
+// A single large int32 array, like OHOS_ABILITY_STREAM_AVAILABLE_EXTEND_CONFIGURATIONS in a static ability
+void BM_MetadataVecRoundTripLargeArray(benchmark::State &state)
+{
+    std::vector<int32_t> configurations(state.range(0));
+    for (size_t i = 0; i < configurations.size(); i++) {
+        configurations[i] = static_cast<int32_t>(i);
+    }
+    auto metadata = std::make_shared<CameraMetadata>(1, configurations.size() * sizeof(int32_t));
+    metadata->addEntry(OHOS_ABILITY_STREAM_AVAILABLE_EXTEND_CONFIGURATIONS, configurations.data(),
+        configurations.size());
+    std::vector<uint8_t> cameraAbility;
+    for (auto _ : state) {
+        MetadataUtils::ConvertMetadataToVec(metadata, cameraAbility);
+        std::shared_ptr<CameraMetadata> decoded;
+        MetadataUtils::ConvertVecToMetadata(cameraAbility, decoded);
+        benchmark::DoNotOptimize(decoded);
+    }
+    state.SetBytesProcessed(state.iterations() * cameraAbility.size());
+}
+
+void BM_MetadataStringRoundTrip(benchmark::State &state)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildMetadata(PickTags(state.range(0)));
+    size_t encodedSize = 0;
+    for (auto _ : state) {
+        std::string encoded = MetadataUtils::EncodeToString(metadata);
+        encodedSize = encoded.size();
+        std::shared_ptr<CameraMetadata> decoded = MetadataUtils::DecodeFromString(encoded);
+        benchmark::DoNotOptimize(decoded);
+    }
+    state.SetBytesProcessed(state.iterations() * encodedSize);
+}
+
+void BM_FormatCameraMetadataToString(benchmark::State &state)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildMetadata(PickTags(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(FormatCameraMetadataToString(metadata->get()));
+    }
+}
+
+void CreateFrameSettings(benchmark::State &state, const std::shared_ptr<CameraMetadataAllocator> &allocator)
+{
+    std::vector<uint32_t> tags = PickTags(state.range(0));
+    uint8_t data[ITEM_DATA_BYTES] = {0};
+    for (auto _ : state) {
+        auto metadata = (allocator != nullptr) ?
+            std::make_unique<CameraMetadata>(tags.size(), tags.size() * ITEM_DATA_BYTES, allocator) :
+            std::make_unique<CameraMetadata>(tags.size(), tags.size() * ITEM_DATA_BYTES);
+        for (uint32_t tag : tags) {
+            metadata->addEntry(tag, data, ITEM_DATA_COUNT);
+        }
+        benchmark::DoNotOptimize(metadata->get());
+    }
+}
+
+void BM_CreateFrameSettings(benchmark::State &state)
+{
+    CreateFrameSettings(state, nullptr);
+}
+
+void BM_CreateFrameSettingsPooled(benchmark::State &state)
+{
+    constexpr size_t slabSize = 64 * 1024;
+    constexpr uint32_t maxFreeSlabs = 4;
+    auto pool = std::make_shared<CameraMetadataPool>(slabSize, maxFreeSlabs);
+    CreateFrameSettings(state, pool);
+    CameraMetadataPoolStats stats = pool->GetStats();
+    state.counters["hits"] = stats.hits;
+    state.counters["misses"] = stats.misses;
+    state.counters["highWaterMark"] = stats.highWaterMark;
+}
+
+void BM_DumpCameraMetadata(benchmark::State &state)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildMetadata(PickTags(state.range(0)));
+    size_t dumpLength = 0;
+    MetadataDumpSink sink = [&dumpLength](const char *str, size_t length) {
+        benchmark::DoNotOptimize(str);
+        dumpLength += length;
+    };
+    for (auto _ : state) {
+        DumpCameraMetadata(metadata->get(), sink);
+    }
+    benchmark::DoNotOptimize(dumpLength);
+}
+} // namespace
+
+BENCHMARK(BM_AddCameraMetadataItem)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_AddEntryWithResize)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_GetCameraMetadataItemTagByName)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_FindCameraMetadataItem)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_FindCameraMetadataItemSorted)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_UpdateCameraMetadataItem)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_MetadataVecRoundTrip)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_MetadataVecRoundTripLargeArray)->Arg(1024)->Arg(4096)->Arg(16384);
+BENCHMARK(BM_MetadataStringRoundTrip)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_FormatCameraMetadataToString)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_CreateFrameSettings)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_CreateFrameSettingsPooled)->Arg(16)->Arg(128)->Arg(512);
+BENCHMARK(BM_DumpCameraMetadata)->Arg(16)->Arg(128)->Arg(512);
+
+BENCHMARK_MAIN();
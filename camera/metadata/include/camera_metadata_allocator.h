@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CAMERA_METADATA_ALLOCATOR_H
+#define CAMERA_METADATA_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace OHOS::Camera {
+// Source of the buffers of a CameraMetadata, including the ones of later resizes
+class CameraMetadataAllocator {
+public:
+    virtual ~CameraMetadataAllocator() = default;
+    // Zero filled buffer of size bytes, nullptr on allocation failure
+    virtual void *Allocate(size_t size) = 0;
+    // size is the one passed to Allocate
+    virtual void Release(void *buffer, size_t size) = 0;
+};
+
+struct CameraMetadataPoolStats {
+    // Requests served from a cached slab
+    uint64_t hits = 0;
+    // Requests that needed a new slab or did not fit into a slab
+    uint64_t misses = 0;
+    // Requests larger than the slab size, always served by the heap
+    uint64_t oversized = 0;
+    uint32_t inUse = 0;
+    uint32_t highWaterMark = 0;
+    uint32_t freeSlabs = 0;
+};
+
+// Recycles fixed-size metadata buffers, typically one pool per stream so that
+// per-frame settings and results stop hitting the heap once the pool is warm
+class CameraMetadataPool : public CameraMetadataAllocator {
+public:
+    // Buffers of at most slabSize bytes are pooled, at most maxFreeSlabs of them are kept when released
+    CameraMetadataPool(size_t slabSize, uint32_t maxFreeSlabs);
+    ~CameraMetadataPool() override;
+    CameraMetadataPool(const CameraMetadataPool &) = delete;
+    CameraMetadataPool &operator=(const CameraMetadataPool &) = delete;
+
+    void *Allocate(size_t size) override;
+    void Release(void *buffer, size_t size) override;
+    // Allocate free slabs ahead of time, fails once maxFreeSlabs would be exceeded
+    bool Reserve(uint32_t slabCount);
+    size_t GetSlabSize() const;
+    CameraMetadataPoolStats GetStats() const;
+
+private:
+    const size_t slabSize_;
+    const uint32_t maxFreeSlabs_;
+    mutable std::mutex mutex_;
+    std::vector<void *> freeSlabs_;
+    CameraMetadataPoolStats stats_;
+};
+} // namespace OHOS::Camera
+#endif // CAMERA_METADATA_ALLOCATOR_H
@@ -18,8 +18,14 @@
 
 #include <cstdio>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 #include <parcel.h>
+#include "camera_metadata_allocator.h"
+#include "camera_metadata_item_info.h"
 #include "camera_metadata_operator.h"
 
 static constexpr uint32_t MAX_SUPPORTED_TAGS = 1000;
@@ -27,29 +33,249 @@ static constexpr uint32_t MAX_SUPPORTED_ITEMS = (12000 * 2 * 2);
 static constexpr uint32_t MAX_ITEM_CAPACITY = (1000 * 10);
 static constexpr uint32_t MAX_DATA_CAPACITY = (1000 * 10 * 10 * 10);
 static constexpr uint32_t MIN_VEC_SIZE = 12;
+// Leads a parcel carrying the whole metadata buffer, never a valid tag count
+static constexpr uint32_t METADATA_BLOB_MAGIC = 0x424C4F42;
 
 #define METADATA_PACKET_ALIGNMENT \
     MaxAlignment(MaxAlignment(DATA_ALIGNMENT, METADATA_ALIGNMENT), ITEM_ALIGNMENT)
 
 namespace OHOS::Camera {
+// Maps a payload element type to its metadata data type, unsupported types do not compile
+template <typename T>
+struct MetadataTypeTraits;
+
+template <>
+struct MetadataTypeTraits<uint8_t> {
+    static constexpr uint32_t dataType = META_TYPE_BYTE;
+};
+
+template <>
+struct MetadataTypeTraits<int32_t> {
+    static constexpr uint32_t dataType = META_TYPE_INT32;
+};
+
+template <>
+struct MetadataTypeTraits<uint32_t> {
+    static constexpr uint32_t dataType = META_TYPE_UINT32;
+};
+
+template <>
+struct MetadataTypeTraits<float> {
+    static constexpr uint32_t dataType = META_TYPE_FLOAT;
+};
+
+template <>
+struct MetadataTypeTraits<int64_t> {
+    static constexpr uint32_t dataType = META_TYPE_INT64;
+};
+
+template <>
+struct MetadataTypeTraits<double> {
+    static constexpr uint32_t dataType = META_TYPE_DOUBLE;
+};
+
+template <>
+struct MetadataTypeTraits<camera_rational_t> {
+    static constexpr uint32_t dataType = META_TYPE_RATIONAL;
+};
+
+// Maps a metadata data type back to its payload element type
+template <uint32_t dataType>
+struct MetadataElementTraits;
+
+template <>
+struct MetadataElementTraits<META_TYPE_BYTE> {
+    using type = uint8_t;
+};
+
+template <>
+struct MetadataElementTraits<META_TYPE_INT32> {
+    using type = int32_t;
+};
+
+template <>
+struct MetadataElementTraits<META_TYPE_UINT32> {
+    using type = uint32_t;
+};
+
+template <>
+struct MetadataElementTraits<META_TYPE_FLOAT> {
+    using type = float;
+};
+
+template <>
+struct MetadataElementTraits<META_TYPE_INT64> {
+    using type = int64_t;
+};
+
+template <>
+struct MetadataElementTraits<META_TYPE_DOUBLE> {
+    using type = double;
+};
+
+template <>
+struct MetadataElementTraits<META_TYPE_RATIONAL> {
+    using type = camera_rational_t;
+};
+
+// Element type an OHOS item is declared with, items missing from the tables do not compile
+template <uint32_t item>
+using MetadataItemElement = typename MetadataElementTraits<GetMetadataItemDeclaredType(item)>::type;
+
+// Keeps a template argument out of deduction, so that it falls back to its default
+template <typename T>
+struct MetadataNonDeduced {
+    using type = T;
+};
+
+// Read-only view over typed entry data, it does not own the memory it points to
+template <typename T>
+class MetadataSpan {
+public:
+    constexpr MetadataSpan() = default;
+    constexpr MetadataSpan(const T *data, size_t size) : data_(data), size_(size) {}
+    template <size_t N>
+    constexpr MetadataSpan(const T (&data)[N]) : data_(data), size_(N) {}
+    MetadataSpan(const std::vector<T> &data) : data_(data.data()), size_(data.size()) {}
+
+    constexpr const T *data() const
+    {
+        return data_;
+    }
+    constexpr size_t size() const
+    {
+        return size_;
+    }
+    constexpr bool empty() const
+    {
+        return size_ == 0;
+    }
+    constexpr const T *begin() const
+    {
+        return data_;
+    }
+    constexpr const T *end() const
+    {
+        return data_ + size_;
+    }
+    constexpr const T &operator[](size_t index) const
+    {
+        return data_[index];
+    }
+
+private:
+    const T *data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Capacity growth applied when an entry does not fit into the metadata buffer
+struct CameraMetadataGrowthPolicy {
+    // Grown capacity is at least this percentage of the current one
+    uint32_t growthFactorPercent = INDEX_COUNTER * 100;
+    uint32_t minItemIncrement = 8;
+    uint32_t minDataIncrement = 64;
+};
+
+// Generation counter and content hash of a CameraMetadata, kept next to the metadata buffer
+// instead of in common_metadata_header_t so that the shared buffer layout stays unchanged
+struct CameraMetadataStamp {
+    uint32_t generation = 0;
+    uint64_t contentHash = 0;
+};
+
+// A CameraMetadata has a single owner and is not synchronized, threads sharing
+// one must lock around it or share it through SharedCameraMetadata instead
 class CameraMetadata : public Parcelable {
 public:
     CameraMetadata(size_t itemCapacity, size_t dataCapacity);
+    // Buffers of this metadata, including the ones of later resizes, come from allocator
+    CameraMetadata(size_t itemCapacity, size_t dataCapacity, std::shared_ptr<CameraMetadataAllocator> allocator);
+    // Take over a private writable mapping holding a metadata buffer, it is unmapped instead of freed
+    CameraMetadata(common_metadata_header_t *mappedMetadata, void *mapBase, size_t mapSize);
     ~CameraMetadata();
 
     bool addEntry(uint32_t item, const void *data, size_t data_count);
     bool updateEntry(uint32_t tag, const void *data, size_t data_count);
+    // Delete item, fails if it is not present
+    bool deleteEntry(uint32_t item);
+    // Delete all entries of the given items in a single compaction pass, missing items are ignored
+    bool deleteEntries(const uint32_t *items, uint32_t itemCount);
+    // Make room for at least itemCapacity entries and dataCapacity payload bytes
+    bool reserve(size_t itemCapacity, size_t dataCapacity);
+    // Release the capacity not used by the current entries
+    bool shrink_to_fit();
+    void setGrowthPolicy(const CameraMetadataGrowthPolicy &policy);
+    // Collect entries that differ from base into changed, and tags only present in base into deletedTags
+    bool diff(const CameraMetadata &base, CameraMetadata &changed, std::vector<uint32_t> &deletedTags) const;
+    // Apply the result of diff() taken against this metadata, nothing is changed if it fails
+    bool patch(const CameraMetadata &changed, const std::vector<uint32_t> &deletedTags);
+    // Data of item viewed in place, empty if the item is missing or is not stored as T
+    template <typename T>
+    MetadataSpan<T> Get(uint32_t item) const
+    {
+        size_t count = 0;
+        const void *data = getEntryData(item, MetadataTypeTraits<T>::dataType, count);
+        return MetadataSpan<T>(static_cast<const T *>(data), count);
+    }
+    // Add or update item, fails if the item is not declared with element type T
+    template <typename T>
+    bool Set(uint32_t item, MetadataSpan<T> data)
+    {
+        return setEntry(item, MetadataTypeTraits<T>::dataType, data.data(), data.size());
+    }
+    // Same as Get(item) for an item known at compile time, the element type is checked while compiling
+    template <uint32_t item, typename T = MetadataItemElement<item>>
+    MetadataSpan<T> Get() const
+    {
+        static_assert(MetadataTypeTraits<T>::dataType == GetMetadataItemDeclaredType(item),
+            "item is not declared with element type T");
+        return Get<T>(item);
+    }
+    // Same as Set(item, data) for an item known at compile time, the element type is checked while compiling
+    template <uint32_t item, typename T = MetadataItemElement<item>>
+    bool Set(MetadataSpan<typename MetadataNonDeduced<T>::type> data)
+    {
+        static_assert(MetadataTypeTraits<T>::dataType == GetMetadataItemDeclaredType(item),
+            "item is not declared with element type T");
+        return Set<T>(item, data);
+    }
+    // Changes whenever the entries change through the member functions, 0 for a new metadata.
+    // Writes through get() and the static functions are not seen, call RecalculateContentHash() after them
+    uint32_t GetGeneration() const;
+    // Order independent hash of the entries, kept up to date by every change made through this object
+    uint64_t GetContentHash() const;
+    // Count a change made through get() and the static functions, rehashing the entries from scratch
+    void RecalculateContentHash();
     common_metadata_header_t *get();
     const common_metadata_header_t *get() const;
     bool isValid() const;
+    // Still backed by the mapping passed at construction. The mapping is copy-on-write, so writes through
+    // get() or the member functions only copy the pages they touch and never reach the file
+    bool isMapped() const;
     bool Marshalling(Parcel &parcel) const override;
     static CameraMetadata* Unmarshalling(Parcel &parcel);
 
 private:
+    friend class SharedCameraMetadata;
+
     common_metadata_header_t *metadata_;
+    CameraMetadataStamp stamp_;
+    CameraMetadataGrowthPolicy growthPolicy_;
+    void *mapBase_ = nullptr;
+    size_t mapSize_ = 0;
+    std::shared_ptr<CameraMetadataAllocator> allocator_;
+    // Size metadata_ was allocated with, the header can be overwritten and is not trusted for the release
+    size_t allocSize_ = 0;
 
+    const void *getEntryData(uint32_t item, uint32_t dataType, size_t &count) const;
+    bool setEntry(uint32_t item, uint32_t dataType, const void *data, size_t dataCount);
     bool resize_add_metadata(uint32_t item, const void *data, size_t data_count);
-    void replace_metadata(common_metadata_header_t *newMetadata);
+    bool resize_metadata(uint32_t itemCapacity, uint32_t dataCapacity);
+    uint32_t GrowCapacity(uint32_t capacity, uint64_t required, uint32_t minIncrement, uint32_t maxCapacity) const;
+    void replace_metadata(common_metadata_header_t *newMetadata, size_t allocSize);
+    void release_metadata();
+    common_metadata_header_t *allocate_metadata(uint32_t itemCapacity, uint32_t dataCapacity, size_t &allocSize);
+    void free_metadata(common_metadata_header_t *metadata, size_t allocSize);
     static uint32_t AlignTo(uint32_t val, uint32_t alignment);
     static uint32_t MaxAlignment(uint32_t dataAlignment, uint32_t metadataAlignment);
     static size_t CalculateCameraMetadataMemoryRequired(uint32_t itemCount, uint32_t dataCount);
@@ -62,6 +288,15 @@ private:
     static int copyMetadataMemory(common_metadata_header_t *dst, camera_metadata_item_entry_t *item,
         size_t dataPayloadSize, const void *data);
     static bool CheckItemDataType(camera_metadata_item_entry_t &item);
+    static uint64_t HashCameraMetadataItem(uint32_t item, uint32_t dataType, size_t dataCount, const void *data);
+    static uint64_t HashCameraMetadataItemByIndex(const common_metadata_header_t *src, uint32_t index);
+    // Same as the public functions, additionally accounting the change in stamp when it is not null
+    static int AddCameraMetadataItem(common_metadata_header_t *dst, uint32_t item, const void *data,
+        size_t dataCount, CameraMetadataStamp *stamp);
+    static int UpdateCameraMetadataItemByIndex(common_metadata_header_t *dst, uint32_t index, const void *data,
+        uint32_t dataCount, camera_metadata_item_t *updatedItem, CameraMetadataStamp *stamp);
+    static int DeleteCameraMetadataItems(common_metadata_header_t *dst, const uint32_t *items, uint32_t itemCount,
+        CameraMetadataStamp *stamp);
 
 public:
     // Allocate a new camera metadata buffer and return the metadata header
@@ -81,6 +316,9 @@ public:
     // Get camera metadata item name
     static const char *GetCameraMetadataItemName(uint32_t item);
 
+    // Get the OHOS item called name, a name shared by several items gives the lowest one
+    static int32_t GetCameraMetadataItemTagByName(const char *name, uint32_t *item);
+
     // Update camera metadata item and fill the updated item
     static int UpdateCameraMetadataItem(common_metadata_header_t *dst, uint32_t item, const void *data,
         uint32_t dataCount, camera_metadata_item_t *updatedItem);
@@ -98,13 +336,28 @@ public:
     // Delete camera metadata item by index
     static int DeleteCameraMetadataItemByIndex(common_metadata_header_t *dst, uint32_t index);
 
+    // Delete all entries of the given camera metadata items in a single compaction pass
+    static int DeleteCameraMetadataItems(common_metadata_header_t *dst, const uint32_t *items, uint32_t itemCount);
+
     // Free camera metadata buffer
     static void FreeCameraMetadataBuffer(common_metadata_header_t *dst);
 
+    // Keep camera metadata items ordered by tag so that lookups can binary search
+    static int SetCameraMetadataItemsSorted(common_metadata_header_t *dst, bool sorted);
+
+    // Are camera metadata items ordered by tag
+    static bool IsCameraMetadataItemsSorted(const common_metadata_header_t *src);
+
+    // Order independent hash of the items, metadata with equal items have equal hashes
+    static uint64_t CalculateCameraMetadataContentHash(const common_metadata_header_t *src);
+
     static std::string MetadataItemDump(const common_metadata_header_t *metadataHeader, uint32_t item);
 
     static std::string FormatCameraMetadataToString(const common_metadata_header_t *metadataHeader);
 
+    // Dump every item present in the metadata buffer in a single pass, in storage order
+    static int DumpCameraMetadata(const common_metadata_header_t *metadataHeader, const MetadataDumpSink &sink);
+
     // Internal use
     static camera_metadata_item_entry_t *GetMetadataItems(const common_metadata_header_t *metadataHeader);
     static uint8_t *GetMetadataData(const common_metadata_header_t *metadataHeader);
@@ -122,6 +375,28 @@ public:
     static int MetadataExpandItemMem(common_metadata_header_t *dst, camera_metadata_item_entry_t *item,
         size_t oldItemSize);
     static int32_t GetAllVendorTags(std::vector<vendorTag_t>& tagVec);
+    // Rebuild the cached vendor tag table after the vendor tag provider changed, a failed rebuild keeps the
+    // previous table. A table that never loaded is also retried by lookups with a bounded backoff
+    static int32_t RefreshVendorTagTable();
+};
+
+// Copy-on-write holder for metadata read by several threads: readers take an immutable
+// snapshot without locking, a writer updates a private copy that is published on success
+class SharedCameraMetadata {
+public:
+    explicit SharedCameraMetadata(std::shared_ptr<CameraMetadata> metadata);
+    SharedCameraMetadata(const SharedCameraMetadata &) = delete;
+    SharedCameraMetadata &operator=(const SharedCameraMetadata &) = delete;
+
+    // Snapshot stays valid and unchanged for as long as the caller holds it
+    std::shared_ptr<const CameraMetadata> Load() const;
+    void Store(std::shared_ptr<CameraMetadata> metadata);
+    // updater runs on a copy of the current snapshot, nothing is published if it returns false
+    bool Update(const std::function<bool(CameraMetadata &)> &updater);
+
+private:
+    std::shared_ptr<const CameraMetadata> metadata_;
+    std::mutex writeMutex_;
 };
 } // namespace Camera
 #endif /* CAMERA_METADATA_INFO_H */
@@ -0,0 +1,2065 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Generated by gen_camera_metadata_tables.py from camera_metadata_items.txt, do not edit.
+// Included by camera_metadata_item_info.h, which declares the table types and checks them against the tag enum.
+
+#ifndef CAMERA_METADATA_ITEM_TABLE_H
+#define CAMERA_METADATA_ITEM_TABLE_H
+
+namespace OHOS::Camera {
+constexpr item_info_t g_ohosCameraProperties[] = {
+    {"cameraPosition", META_TYPE_BYTE, 1},
+    {"cameraType", META_TYPE_BYTE, 1},
+    {"cameraConnectionType", META_TYPE_BYTE, 1},
+    {"cameraMemoryType", META_TYPE_BYTE, 1},
+    {"fpsAvailableRanges", META_TYPE_INT32, -1},
+    {"flashAvailable", META_TYPE_BYTE, 1},
+    {"streamId", META_TYPE_INT32, 1},
+    {"prelaunchAvailable", META_TYPE_BYTE, 1},
+    {"customVideoFps", META_TYPE_INT32, -1},
+    {"availableCameraModes", META_TYPE_BYTE, -1},
+    {"sketchEnableRatio", META_TYPE_FLOAT, -1},
+    {"sketchReferenceFovRatio", META_TYPE_FLOAT, -1},
+    {"sketchInfoNotification", META_TYPE_INT32, -1},
+    {"cameraFoldscreenType", META_TYPE_BYTE, 1},
+    {"availableColorSpaces", META_TYPE_INT32, -1},
+    {"nightModeSupportedExposureTime", META_TYPE_INT32, 1},
+    {"cameraMesureExposureTime", META_TYPE_UINT32, 1},
+    {"cameraExposureModePreviewState", META_TYPE_BYTE, 1},
+    {"cameraUserId", META_TYPE_INT32, -1},
+    {"cameraAbilityMoonCaptureBoost", META_TYPE_UINT32, -1},
+    {"cameraControlMoonCaptureBoost", META_TYPE_BYTE, 1},
+    {"cameraStatusMoonCaptureDetection", META_TYPE_UINT32, 1},
+    {"captureDurationSupported", META_TYPE_BYTE, 1},
+    {"customSnapshotDuration", META_TYPE_UINT32, 1},
+    {"cameraAbilityMovingPhoto", META_TYPE_INT32, -1},
+    {"cameraAbilityFlashSuggestionSupported", META_TYPE_UINT32, -1},
+    {"cameraControlFlashSuggestionSwitch", META_TYPE_BYTE, 1},
+    {"cameraStatusFlashSuggestion", META_TYPE_UINT32, 1},
+    {"cameraAbilityHighQualitySupport", META_TYPE_BYTE, 1},
+    {"cameraFoldStatus", META_TYPE_BYTE, 1},
+    {"cameraStatusOcclusionDetection", META_TYPE_INT32, 1},
+    {"statisticsDetectType", META_TYPE_BYTE, -1},
+    {"statisticsDetectSetting", META_TYPE_BYTE, -1},
+    {"availableExtendedStreamInfoTypes", META_TYPE_INT32, -1},
+    {"autoDeferredVideoEnhance", META_TYPE_BYTE, 1},
+    {nullptr, META_TYPE_BYTE, 0}, // OHOS_ABILITY_MOVING_PHOTO_MICRO_VIDEO_ENHANCE has no item info
+    {"controlAutoDeferredVideoEnhance", META_TYPE_BYTE, 1},
+    {"autoCloudImageEnhance", META_TYPE_INT32, -1},
+    {"controlAutoCloudImageEnhance", META_TYPE_BYTE, 1},
+    {"tripodDetection", META_TYPE_INT32, -1},
+    {"controlTripodDetection", META_TYPE_BYTE, 1},
+    {"tripodStablitation", META_TYPE_BYTE, 1},
+    {"tripodDetectionStatus", META_TYPE_BYTE, 1},
+    {"sketchPoint", META_TYPE_FLOAT, 1},
+    {"sketchStreamInfo", META_TYPE_FLOAT, -1},
+    {"lowLightBoost", META_TYPE_INT32, -1},
+    {"controlLowLightBoost", META_TYPE_BYTE, 1},
+    {"lowLightBoost", META_TYPE_BYTE, 1},
+    {"lowLightDetection", META_TYPE_BYTE, 1},
+    {"cameraLensDirtyDetection", META_TYPE_BYTE, 1},
+    {"protectionState", META_TYPE_BYTE, 1},
+    {"tofSensorAbnormal", META_TYPE_INT32, 1},
+    {"sunBlockPreviewTypes", META_TYPE_BYTE, -1},
+    {"sunBlockBlendColors", META_TYPE_BYTE, -1},
+    {"sunBlockRgbCropRegion", META_TYPE_FLOAT, -1},
+    {"sunBlockRgbUvRegion", META_TYPE_FLOAT, -1},
+    {"sunBlockHint", META_TYPE_BYTE, -1},
+    {"cameraLimitedCapability", META_TYPE_DOUBLE, -1},
+    {"cameraConcurrentType", META_TYPE_BYTE, 1},
+    {"cameraConcurrentSupportedCameras", META_TYPE_INT32, 1},
+    {"autoAigcPhoto", META_TYPE_BYTE, -1},
+    {"controlAutoAigcPhoto", META_TYPE_BYTE, 1},
+    {"logAssistanceSuppported", META_TYPE_BYTE, -1},
+    {"stageBoost", META_TYPE_BYTE, 1},
+    {"flashAdjustAvailable", META_TYPE_BYTE, 1},
+    {"controlStageBoost", META_TYPE_BYTE, 1},
+    {"automotiveCameraPositon", META_TYPE_BYTE, 1},
+    {"abilityAutoExtendedGainmapDelivery", META_TYPE_BYTE, -1},
+    {"controlAutoExtendedGainmapDelivery", META_TYPE_BYTE, 1},
+    {"cameraConcurrentCapture", META_TYPE_BYTE, 1},
+    {"cameraSpectrumAvailable", META_TYPE_BYTE, 1},
+    {"cameraSpectrumInfo", META_TYPE_FLOAT, -1},
+    {"automotiveCameraSensorType", META_TYPE_BYTE, 1},
+    {"commonPublishedFeatures", META_TYPE_UINT32, -1},
+};
+
+constexpr uint32_t g_ohosCameraPropertiesTags[] = {
+    OHOS_ABILITY_CAMERA_POSITION,
+    OHOS_ABILITY_CAMERA_TYPE,
+    OHOS_ABILITY_CAMERA_CONNECTION_TYPE,
+    OHOS_ABILITY_MEMORY_TYPE,
+    OHOS_ABILITY_FPS_RANGES,
+    OHOS_ABILITY_FLASH_AVAILABLE,
+    OHOS_CAMERA_STREAM_ID,
+    OHOS_ABILITY_PRELAUNCH_AVAILABLE,
+    OHOS_ABILITY_CUSTOM_VIDEO_FPS,
+    OHOS_ABILITY_CAMERA_MODES,
+    OHOS_ABILITY_SKETCH_ENABLE_RATIO,
+    OHOS_ABILITY_SKETCH_REFERENCE_FOV_RATIO,
+    OHOS_ABILITY_SKETCH_INFO_NOTIFICATION,
+    OHOS_ABILITY_CAMERA_FOLDSCREEN_TYPE,
+    OHOS_ABILITY_AVAILABLE_COLOR_SPACES,
+    OHOS_ABILITY_NIGHT_MODE_SUPPORTED_EXPOSURE_TIME,
+    OHOS_CAMERA_MESURE_EXPOSURE_TIME,
+    OHOS_CAMERA_EXPOSURE_MODE_PREVIEW_STATE,
+    OHOS_CAMERA_USER_ID,
+    OHOS_ABILITY_MOON_CAPTURE_BOOST,
+    OHOS_CONTROL_MOON_CAPTURE_BOOST,
+    OHOS_STATUS_MOON_CAPTURE_DETECTION,
+    OHOS_ABILITY_CAPTURE_DURATION_SUPPORTED,
+    OHOS_CAMERA_CUSTOM_SNAPSHOT_DURATION,
+    OHOS_ABILITY_MOVING_PHOTO,
+    OHOS_ABILITY_FLASH_SUGGESTION_SUPPORTED,
+    OHOS_CONTROL_FLASH_SUGGESTION_SWITCH,
+    OHOS_STATUS_FLASH_SUGGESTION,
+    OHOS_ABILITY_HIGH_QUALITY_SUPPORT,
+    OHOS_ABILITY_CAMERA_FOLD_STATUS,
+    OHOS_STATUS_CAMERA_OCCLUSION_DETECTION,
+    OHOS_ABILITY_STATISTICS_DETECT_TYPE,
+    OHOS_CONTROL_STATISTICS_DETECT_SETTING,
+    OHOS_ABILITY_AVAILABLE_EXTENDED_STREAM_INFO_TYPES,
+    OHOS_ABILITY_AUTO_DEFERRED_VIDEO_ENHANCE,
+    OHOS_ABILITY_MOVING_PHOTO_MICRO_VIDEO_ENHANCE,
+    OHOS_CONTROL_AUTO_DEFERRED_VIDEO_ENHANCE,
+    OHOS_ABILITY_AUTO_CLOUD_IMAGE_ENHANCE,
+    OHOS_CONTROL_AUTO_CLOUD_IMAGE_ENHANCE,
+    OHOS_ABILITY_TRIPOD_DETECTION,
+    OHOS_CONTROL_TRIPOD_DETECTION,
+    OHOS_CONTROL_TRIPOD_STABLITATION,
+    OHOS_STATUS_TRIPOD_DETECTION_STATUS,
+    OHOS_STATUS_SKETCH_POINT,
+    OHOS_STATUS_SKETCH_STREAM_INFO,
+    OHOS_ABILITY_LOW_LIGHT_BOOST,
+    OHOS_CONTROL_LOW_LIGHT_DETECT,
+    OHOS_CONTROL_LOW_LIGHT_BOOST,
+    OHOS_STATUS_LOW_LIGHT_DETECTION,
+    OHOS_STATUS_CAMERA_LENS_DIRTY_DETECTION,
+    OHOS_DEVICE_PROTECTION_STATE,
+    OHOS_STATUS_TOF_SENSOR_ABNORMAL,
+    OHOS_ABILITY_SUN_BLOCK_PREVIEW_TYPES,
+    OHOS_ABILITY_SUN_BLOCK_BLEND_COLORS,
+    OHOS_ABILITY_SUN_BLOCK_RGB_CROP_REGION,
+    OHOS_ABILITY_SUN_BLOCK_RGB_UV_REGION,
+    OHOS_STATUS_SUN_BLOCK_HINT,
+    OHOS_ABILITY_CAMERA_LIMITED_CAPABILITIES,
+    OHOS_ABILITY_CAMERA_CONCURRENT_TYPE,
+    OHOS_ABILITY_CONCURRENT_SUPPORTED_CAMERAS,
+    OHOS_ABILITY_AUTO_AIGC_PHOTO,
+    OHOS_CONTROL_AUTO_AIGC_PHOTO,
+    OHOS_ABILITY_LOG_ASSISTANCE_SUPPORTED,
+    OHOS_ABILITY_STAGE_BOOST,
+    OHOS_ABILITY_FLASHLIGHT_ADJUST_SUPPORTED,
+    OHOS_CONTROL_STAGE_BOOST,
+    OHOS_ABILITY_AUTOMOTIVE_CAMERA_POSITION,
+    OHOS_ABILITY_AUTO_EXTENDED_GAINMAP_DELIVERY,
+    OHOS_CONTROL_AUTO_EXTENDED_GAINMAP_DELIVERY,
+    OHOS_CONTROL_CAMERA_CONCURRENT_CAPTURE,
+    OHOS_ABILITY_SPECTRUM_SUPPORTED,
+    OHOS_ABILITY_SPECTRUM_INFOS,
+    OHOS_ABILITY_AUTOMOTIVE_CAMERA_SENSOR_TYPE,
+    OHOS_ABILITY_COMMON_PUBLISHED_FEATURES,
+};
+
+constexpr item_info_t g_ohosCameraSensor[] = {
+    {"exposureTime", META_TYPE_INT64, 1},
+    {"colorCorrectuonGain", META_TYPE_FLOAT, 1},
+    {"sensorOrientation", META_TYPE_INT32, 1},
+    {"muteAvailableModes", META_TYPE_BYTE, -1},
+    {"muteMode", META_TYPE_BYTE, 1},
+    {"halRotateAngle", META_TYPE_INT32, 1},
+    {"sensorOrientationVariable", META_TYPE_INT32, 1},
+    {"foldStateSensorOrientationMap", META_TYPE_INT32, -1},
+    {"foldStateAndNaturalDirectionSensorOrientationMap", META_TYPE_INT32, -1},
+};
+
+constexpr uint32_t g_ohosCameraSensorTags[] = {
+    OHOS_SENSOR_EXPOSURE_TIME,
+    OHOS_SENSOR_COLOR_CORRECTION_GAINS,
+    OHOS_SENSOR_ORIENTATION,
+    OHOS_ABILITY_MUTE_MODES,
+    OHOS_CONTROL_MUTE_MODE,
+    OHOS_CONTROL_ROTATE_ANGLE,
+    OHOS_ABILITY_SENSOR_ORIENTATION_VARIABLE,
+    OHOS_FOLD_STATE_SENSOR_ORIENTATION_MAP,
+    OHOS_FOLD_STATE_AND_NATURAL_DIRECTION_SENSOR_ORIENTATION_MAP,
+};
+
+constexpr item_info_t g_ohosCameraSensorInfo[] = {
+    {"activeArraySize", META_TYPE_INT32, -1},
+    {"sensitivityRange", META_TYPE_INT32, -1},
+    {"maxFrameDuration", META_TYPE_INT64, 1},
+    {"physicalSize", META_TYPE_FLOAT, 1},
+    {"pixelArraySize", META_TYPE_INT32, -1},
+    {"sensorOutputTimeStamp", META_TYPE_INT64, 1},
+};
+
+constexpr uint32_t g_ohosCameraSensorInfoTags[] = {
+    OHOS_SENSOR_INFO_ACTIVE_ARRAY_SIZE,
+    OHOS_SENSOR_INFO_SENSITIVITY_RANGE,
+    OHOS_SENSOR_INFO_MAX_FRAME_DURATION,
+    OHOS_SENSOR_INFO_PHYSICAL_SIZE,
+    OHOS_SENSOR_INFO_PIXEL_ARRAY_SIZE,
+    OHOS_SENSOR_INFO_TIMESTAMP,
+};
+
+constexpr item_info_t g_ohosCameraStatistics[] = {
+    {"faceDetectMode", META_TYPE_BYTE, 1},
+    {"faceDetectSwitch", META_TYPE_BYTE, 1},
+    {"faceDetectMaxNum", META_TYPE_BYTE, 1},
+    {"histogramMode", META_TYPE_BYTE, 1},
+    {"faceIds", META_TYPE_INT32, -1},
+    {"faceLandmarks", META_TYPE_INT32, -1},
+    {"faceRectangles", META_TYPE_FLOAT, -1},
+    {"faceScores", META_TYPE_BYTE, -1},
+    {"timestamp", META_TYPE_INT64, -1},
+    {"detectHumanFaceInfos", META_TYPE_INT32, -1},
+    {"detectHumanBodyInfos", META_TYPE_INT32, -1},
+    {"detectHumanHeadInfos", META_TYPE_INT32, -1},
+    {"detectCatFaceInfos", META_TYPE_INT32, -1},
+    {"detectCatBodyInfos", META_TYPE_INT32, -1},
+    {"detectDogFaceInfos", META_TYPE_INT32, -1},
+    {"detectDogBodyInfos", META_TYPE_INT32, -1},
+    {"detectSalientInfos", META_TYPE_INT32, -1},
+    {"detectBarCodeInfos", META_TYPE_INT32, -1},
+    {"baseFaceInfo", META_TYPE_INT32, -1},
+};
+
+constexpr uint32_t g_ohosCameraStatisticsTags[] = {
+    OHOS_STATISTICS_FACE_DETECT_MODE,
+    OHOS_STATISTICS_FACE_DETECT_SWITCH,
+    OHOS_STATISTICS_FACE_DETECT_MAX_NUM,
+    OHOS_STATISTICS_HISTOGRAM_MODE,
+    OHOS_STATISTICS_FACE_IDS,
+    OHOS_STATISTICS_FACE_LANDMARKS,
+    OHOS_STATISTICS_FACE_RECTANGLES,
+    OHOS_STATISTICS_FACE_SCORES,
+    OHOS_STATISTICS_TIMESTAMP,
+    OHOS_STATISTICS_DETECT_HUMAN_FACE_INFOS,
+    OHOS_STATISTICS_DETECT_HUMAN_BODY_INFOS,
+    OHOS_STATISTICS_DETECT_HUMAN_HEAD_INFOS,
+    OHOS_STATISTICS_DETECT_CAT_FACE_INFOS,
+    OHOS_STATISTICS_DETECT_CAT_BODY_INFOS,
+    OHOS_STATISTICS_DETECT_DOG_FACE_INFOS,
+    OHOS_STATISTICS_DETECT_DOG_BODY_INFOS,
+    OHOS_STATISTICS_DETECT_SALIENT_INFOS,
+    OHOS_STATISTICS_DETECT_BAR_CODE_INFOS,
+    OHOS_STATISTICS_DETECT_BASE_FACE_INFO,
+};
+
+constexpr item_info_t g_ohosCameraControl[] = {
+    {"aeAntibandingMode", META_TYPE_BYTE, 1},
+    {"aeExposureCompensation", META_TYPE_INT32, 1},
+    {"aeLock", META_TYPE_BYTE, 1},
+    {"aeMode", META_TYPE_BYTE, 1},
+    {"aeRegions", META_TYPE_FLOAT, -1},
+    {"aeTargetFpsRange", META_TYPE_INT32, -1},
+    {"fpsRange", META_TYPE_INT32, -1},
+    {"afMode", META_TYPE_BYTE, 1},
+    {"afRegions", META_TYPE_FLOAT, -1},
+    {"afTrigger", META_TYPE_BYTE, 1},
+    {"afTriggerId", META_TYPE_INT32, 1},
+    {"afState", META_TYPE_BYTE, 1},
+    {"awbLock", META_TYPE_BYTE, 1},
+    {"awbMode", META_TYPE_BYTE, 1},
+    {"awbRegions", META_TYPE_INT32, -1},
+    {"aeAvailableAntibandingModes", META_TYPE_BYTE, -1},
+    {"aeAvailableModes", META_TYPE_BYTE, -1},
+    {"aeAvailableTargetFpsRanges", META_TYPE_INT32, -1},
+    {"abilityAeCompensationRange", META_TYPE_INT32, -1},
+    {"abilityAeCompensationStep", META_TYPE_RATIONAL, 1},
+    {"aeCompensationRange", META_TYPE_INT32, -1},
+    {"aeCompensationStep", META_TYPE_RATIONAL, 1},
+    {"afAvailableModes", META_TYPE_BYTE, -1},
+    {"awbAvailableModes", META_TYPE_BYTE, -1},
+    {"mirrorSupported", META_TYPE_BYTE, -1},
+    {"mirror", META_TYPE_BYTE, 1},
+    {"focusState", META_TYPE_BYTE, 1},
+    {"meterPoint", META_TYPE_INT32, -1},
+    {"meterMode", META_TYPE_BYTE, 1},
+    {"exposureState", META_TYPE_BYTE, 1},
+    {"focusedPoint", META_TYPE_INT32, -1},
+    {"nightModeTryAe", META_TYPE_BYTE, 1},
+    {"manualExposureTime", META_TYPE_UINT32, -1},
+    {"currentFps", META_TYPE_UINT32, 1},
+    {"supportedIsoValues", META_TYPE_INT32, -1},
+    {"isoValues", META_TYPE_INT32, 1},
+    {"currentIsoValues", META_TYPE_INT32, 1},
+    {"sensorExposureTimeRange", META_TYPE_RATIONAL, -1},
+    {"sensorExposureTime", META_TYPE_RATIONAL, 1},
+    {"currentSensorExposureTime", META_TYPE_RATIONAL, 1},
+    {"movingPhoto", META_TYPE_BYTE, 1},
+    {"supportedSensorWbValues", META_TYPE_INT32, -1},
+    {"sensorWbValue", META_TYPE_INT32, 1},
+    {"highQualityMode", META_TYPE_BYTE, 1},
+    {"cameraAppHint", META_TYPE_UINT32, 1},
+    {"cameraControlBurstCapture", META_TYPE_BYTE, 1},
+    {"cameraUsedAsPosition", META_TYPE_BYTE, 1},
+    {"cameraSessionUsage", META_TYPE_INT32, -1},
+    {"ejectRetry", META_TYPE_BYTE, 1},
+    {"fallProtection", META_TYPE_BYTE, 1},
+    {"sunBlockPreviewType", META_TYPE_BYTE, 1},
+    {"sunBlockBlendColor", META_TYPE_BYTE, 1},
+    {"qualityPrioritization", META_TYPE_BYTE, 1},
+    {"logAssistanceEnable", META_TYPE_BYTE, 1},
+    {"supportedExernalCameraLensBoost", META_TYPE_BYTE, 1},
+    {"exernalCameraLensBoost", META_TYPE_BYTE, 1},
+    {"supportedPhotoQualityPrioritizationValues", META_TYPE_INT32, -1},
+    {"photoQualityPrioritization", META_TYPE_BYTE, 1},
+    {"requestCameraSwitch", META_TYPE_INT32, 1},
+    {"cameraSwitchInfo", META_TYPE_INT32, 1},
+    {"removeSensorRestraint", META_TYPE_BYTE, 1},
+    {"supportedPreviewQualityPrioritizationValues", META_TYPE_BYTE, -1},
+    {"previewQualityPrioritization", META_TYPE_BYTE, 1},
+    {nullptr, META_TYPE_BYTE, 0}, // OHOS_STATUS_AE_EXPOSURE_COMPENSATION has no item info
+    {"cameraControlSystemCapture", META_TYPE_BYTE, 1},
+    {"supportedImagingModeValues", META_TYPE_BYTE, -1},
+    {"imagingMode", META_TYPE_BYTE, 1},
+    {"supportedGenerateOriginalImage", META_TYPE_BYTE, -1},
+    {"generateOriginalImage", META_TYPE_BYTE, 1},
+};
+
+constexpr uint32_t g_ohosCameraControlTags[] = {
+    OHOS_CONTROL_AE_ANTIBANDING_MODE,
+    OHOS_CONTROL_AE_EXPOSURE_COMPENSATION,
+    OHOS_CONTROL_AE_LOCK,
+    OHOS_CONTROL_AE_MODE,
+    OHOS_CONTROL_AE_REGIONS,
+    OHOS_CONTROL_AE_TARGET_FPS_RANGE,
+    OHOS_CONTROL_FPS_RANGES,
+    OHOS_CONTROL_AF_MODE,
+    OHOS_CONTROL_AF_REGIONS,
+    OHOS_CONTROL_AF_TRIGGER,
+    OHOS_CONTROL_AF_TRIGGER_ID,
+    OHOS_CONTROL_AF_STATE,
+    OHOS_CONTROL_AWB_LOCK,
+    OHOS_CONTROL_AWB_MODE,
+    OHOS_CONTROL_AWB_REGIONS,
+    OHOS_CONTROL_AE_AVAILABLE_ANTIBANDING_MODES,
+    OHOS_CONTROL_AE_AVAILABLE_MODES,
+    OHOS_CONTROL_AE_AVAILABLE_TARGET_FPS_RANGES,
+    OHOS_ABILITY_AE_COMPENSATION_RANGE,
+    OHOS_ABILITY_AE_COMPENSATION_STEP,
+    OHOS_CONTROL_AE_COMPENSATION_RANGE,
+    OHOS_CONTROL_AE_COMPENSATION_STEP,
+    OHOS_CONTROL_AF_AVAILABLE_MODES,
+    OHOS_CONTROL_AWB_AVAILABLE_MODES,
+    OHOS_CONTROL_CAPTURE_MIRROR_SUPPORTED,
+    OHOS_CONTROL_CAPTURE_MIRROR,
+    OHOS_CONTROL_FOCUS_STATE,
+    OHOS_CONTROL_METER_POINT,
+    OHOS_CONTROL_METER_MODE,
+    OHOS_CONTROL_EXPOSURE_STATE,
+    OHOS_CONTROL_FOCUSED_POINT,
+    OHOS_CONTROL_NIGHT_MODE_TRY_AE,
+    OHOS_CONTROL_MANUAL_EXPOSURE_TIME,
+    OHOS_STATUS_CAMERA_CURRENT_FPS,
+    OHOS_ABILITY_ISO_VALUES,
+    OHOS_CONTROL_ISO_VALUE,
+    OHOS_STATUS_ISO_VALUE,
+    OHOS_ABILITY_SENSOR_EXPOSURE_TIME_RANGE,
+    OHOS_CONTROL_SENSOR_EXPOSURE_TIME,
+    OHOS_STATUS_SENSOR_EXPOSURE_TIME,
+    OHOS_CONTROL_MOVING_PHOTO,
+    OHOS_ABILITY_SENSOR_WB_VALUES,
+    OHOS_CONTROL_SENSOR_WB_VALUE,
+    OHOS_CONTROL_HIGH_QUALITY_MODE,
+    OHOS_CONTROL_APP_HINT,
+    OHOS_CONTROL_BURST_CAPTURE,
+    OHOS_CONTROL_CAMERA_USED_AS_POSITION,
+    OHOS_CONTROL_CAMERA_SESSION_USAGE,
+    OHOS_CONTROL_EJECT_RETRY,
+    OHOS_CONTROL_FALL_PROTECTION,
+    OHOS_CONTROL_SUN_BLOCK_PREVIEW_TYPE,
+    OHOS_CONTROL_SUN_BLOCK_BLEND_COLOR,
+    OHOS_CONTROL_QUALITY_PRIORITIZATION,
+    OHOS_CONTROL_LOG_ASSISTANCE,
+    OHOS_ABILITY_EXTERNAL_CAMERA_LENS_BOOST,
+    OHOS_CONTROL_EXTERNAL_CAMERA_LENS_BOOST,
+    OHOS_ABILITY_PHOTO_QUALITY_PRIORITIZATION,
+    OHOS_CONTROL_PHOTO_QUALITY_PRIORITIZATION,
+    OHOS_CONTROL_REQUEST_CAMERA_SWITCH,
+    OHOS_CONTROL_CAMERA_SWITCH_INFOS,
+    OHOS_CONTROL_REMOVE_SENSOR_RESTRAINT,
+    OHOS_ABILITY_CAMERA_PREVIEW_QUALITY_PRIORITIZATION,
+    OHOS_CONTROL_CAMERA_PREVIEW_QUALITY_PRIORITIZATION,
+    OHOS_STATUS_AE_EXPOSURE_COMPENSATION,
+    OHOS_CONTROL_CAPTURE_ROTATION,
+    OHOS_ABILITY_IMAGING_MODES,
+    OHOS_CONTROL_IMAGING_MODE,
+    OHOS_ABILITY_GENERATE_ORIGINAL_IMAGE,
+    OHOS_CONTROL_GENERATE_ORIGINAL_IMAGE,
+};
+
+constexpr item_info_t g_ohosDeviceExposure[] = {
+    {"exposureAvailableModes", META_TYPE_BYTE, -1},
+    {"exposureMode", META_TYPE_BYTE, 1},
+    {"exposureSupportiveModes", META_TYPE_BYTE, -1},
+    {"exMode", META_TYPE_BYTE, 1},
+    {"meterAvailableModes", META_TYPE_BYTE, -1},
+    {"sceneExposureSupportiveModes", META_TYPE_BYTE, -1},
+    {"abilityExposureTime", META_TYPE_INT32, -1},
+    {"abilityAELock", META_TYPE_BYTE, -1},
+};
+
+constexpr uint32_t g_ohosDeviceExposureTags[] = {
+    OHOS_ABILITY_DEVICE_AVAILABLE_EXPOSUREMODES,
+    OHOS_CONTROL_EXPOSUREMODE,
+    OHOS_ABILITY_EXPOSURE_MODES,
+    OHOS_CONTROL_EXPOSURE_MODE,
+    OHOS_ABILITY_METER_MODES,
+    OHOS_ABILITY_SCENE_EXPOSURE_MODES,
+    OHOS_ABILITY_EXPOSURE_TIME,
+    OHOS_ABILITY_AE_LOCK,
+};
+
+constexpr item_info_t g_ohosDeviceFocus[] = {
+    {"focusAvailablesModes", META_TYPE_BYTE, -1},
+    {"focusMode", META_TYPE_BYTE, 1},
+    {"focusSupportiveModes", META_TYPE_BYTE, -1},
+    {"fMode", META_TYPE_BYTE, 1},
+    {"focalLength", META_TYPE_FLOAT, 1},
+    {"sceneFocusSupportiveModes", META_TYPE_BYTE, -1},
+    {"focusAssistFlashSupportedModes", META_TYPE_BYTE, -1},
+    {"sceneFocusSupportiveModes", META_TYPE_BYTE, 1},
+    {"lensInfoMinimumFocusDistance", META_TYPE_FLOAT, 1},
+    {"lensFocusDistance", META_TYPE_FLOAT, 1},
+    {"equivalentFocus", META_TYPE_INT32, -1},
+    {"lensEquivalentFocus", META_TYPE_INT32, -1},
+    {"controlFocusDistance", META_TYPE_FLOAT, 1},
+    {"focusRangeTypes", META_TYPE_BYTE, -1},
+    {"focusRangeType", META_TYPE_BYTE, 1},
+    {"focusTrackingModes", META_TYPE_BYTE, -1},
+    {"focusTrackingMode", META_TYPE_BYTE, 1},
+    {"focusTrackingRegion", META_TYPE_INT32, -1},
+    {"focusDrivenTypes", META_TYPE_BYTE, -1},
+    {"focusDrivenType", META_TYPE_BYTE, 1},
+    {"focusTrackingMechAvailable", META_TYPE_BYTE, 1},
+    {"focusTrackingMech", META_TYPE_BYTE, 1},
+    {"focusTrackingObjectId", META_TYPE_INT32, 1},
+    {"fovInfos", META_TYPE_FLOAT, -1},
+    {"typicalSceneZoomPoints", META_TYPE_INT32, -1},
+    {"lockObjectTrackingAvailable", META_TYPE_INT32, -1},
+    {"lockObjectTracking", META_TYPE_INT32, -1},
+};
+
+constexpr uint32_t g_ohosDeviceFocusTags[] = {
+    OHOS_ABILITY_DEVICE_AVAILABLE_FOCUSMODES,
+    OHOS_CONTROL_FOCUSMODE,
+    OHOS_ABILITY_FOCUS_MODES,
+    OHOS_CONTROL_FOCUS_MODE,
+    OHOS_ABILITY_FOCAL_LENGTH,
+    OHOS_ABILITY_SCENE_FOCUS_MODES,
+    OHOS_ABILITY_FOCUS_ASSIST_FLASH_SUPPORTED_MODES,
+    OHOS_CONTROL_FOCUS_ASSIST_FLASH_SUPPORTED_MODE,
+    OHOS_ABILITY_LENS_INFO_MINIMUM_FOCUS_DISTANCE,
+    OHOS_CONTROL_LENS_FOCUS_DISTANCE,
+    OHOS_ABILITY_EQUIVALENT_FOCUS,
+    OHOS_ABILITY_LENS_EQUIVALENT_FOCUS,
+    OHOS_CONTROL_FOCUS_DISTANCE,
+    OHOS_ABILITY_FOCUS_RANGE_TYPES,
+    OHOS_CONTROL_FOCUS_RANGE_TYPE,
+    OHOS_ABILITY_FOCUS_TRACKING_MODES,
+    OHOS_CONTROL_FOCUS_TRACKING_MODE,
+    OHOS_ABILITY_FOCUS_TRACKING_REGION,
+    OHOS_ABILITY_FOCUS_DRIVEN_TYPES,
+    OHOS_CONTROL_FOCUS_DRIVEN_TYPE,
+    OHOS_ABILITY_FOCUS_TRACKING_MECH_AVAILABLE,
+    OHOS_CONTROL_FOCUS_TRACKING_MECH,
+    OHOS_CONTROL_FOCUS_TRACKING_OBJECT_ID,
+    OHOS_STATUS_FOV_INFOS,
+    OHOS_ABILITY_TYPICAL_SCENE_ZOOM_POINTS,
+    OHOS_ABILITY_LOCK_OBJECT_TRACKING_AVAILABLE,
+    OHOS_CONTROL_LOCK_OBJECT_TRACKING,
+};
+
+constexpr item_info_t g_ohosDeviceWhite[] = {
+    {nullptr, META_TYPE_BYTE, 0}, // OHOS_ABILITY_DEVICE_AVAILABLE_AWBMODES has no item info
+    {"whiteAvailablesModes", META_TYPE_BYTE, -1},
+    {"abilityAWBLock", META_TYPE_BYTE, 1},
+};
+
+constexpr uint32_t g_ohosDeviceWhiteTags[] = {
+    OHOS_ABILITY_DEVICE_AVAILABLE_AWBMODES,
+    OHOS_ABILITY_AWB_MODES,
+    OHOS_ABILITY_AWB_LOCK,
+};
+
+constexpr item_info_t g_ohosDeviceFlash[] = {
+    {"flashAvailablesModes", META_TYPE_BYTE, -1},
+    {"flashMode", META_TYPE_BYTE, 1},
+    {"flashSupportiveModes", META_TYPE_BYTE, -1},
+    {"flaMode", META_TYPE_BYTE, 1},
+    {"flashstate", META_TYPE_BYTE, 1},
+    {"sceneFlashSupportiveModes", META_TYPE_INT32, -1},
+};
+
+constexpr uint32_t g_ohosDeviceFlashTags[] = {
+    OHOS_ABILITY_DEVICE_AVAILABLE_FLASHMODES,
+    OHOS_CONTROL_FLASHMODE,
+    OHOS_ABILITY_FLASH_MODES,
+    OHOS_CONTROL_FLASH_MODE,
+    OHOS_CONTROL_FLASH_STATE,
+    OHOS_ABILITY_SCENE_FLASH_MODES,
+};
+
+constexpr item_info_t g_ohosDeviceZoom[] = {
+    {"zoomRange", META_TYPE_FLOAT, -1},
+    {"zoomRatio", META_TYPE_FLOAT, 1},
+    {"zoomCropRegion", META_TYPE_INT32, -1},
+    {"zoomCap", META_TYPE_INT32, -1},
+    {"sceneZoomCap", META_TYPE_INT32, -1},
+    {"currentStatusZoomRatio", META_TYPE_UINT32, 1},
+    {"controlZoomRatios", META_TYPE_UINT32, -1},
+    {"controlTargetZoomRatios", META_TYPE_FLOAT, 1},
+    {"smoothZoom", META_TYPE_UINT32, 1},
+    {"controlPreZoom", META_TYPE_BYTE, 1},
+    {"zoomPerformance", META_TYPE_UINT32, -1},
+    {"statusZoomPerformance", META_TYPE_UINT32, -1},
+    {"zoomBezierCurvePoint", META_TYPE_FLOAT, -1},
+    {"zoomRatioRange", META_TYPE_FLOAT, -1},
+    {"zoomCenterPoint", META_TYPE_FLOAT, -1},
+    {"zoomCenterPointSupported", META_TYPE_BYTE, 1},
+};
+
+constexpr uint32_t g_ohosDeviceZoomTags[] = {
+    OHOS_ABILITY_ZOOM_RATIO_RANGE,
+    OHOS_CONTROL_ZOOM_RATIO,
+    OHOS_CONTROL_ZOOM_CROP_REGION,
+    OHOS_ABILITY_ZOOM_CAP,
+    OHOS_ABILITY_SCENE_ZOOM_CAP,
+    OHOS_STATUS_CAMERA_CURRENT_ZOOM_RATIO,
+    OHOS_CONTROL_SMOOTH_ZOOM_RATIOS,
+    OHOS_CONTROL_CAMERA_TARGET_ZOOM_RATIO,
+    OHOS_ABILITY_CAMERA_NEED_SET_SMOOTH,
+    OHOS_CONTROL_PREPARE_ZOOM,
+    OHOS_ABILITY_CAMERA_ZOOM_PERFORMANCE,
+    OHOS_STATUS_CAMERA_ZOOM_PERFORMANCE,
+    OHOS_ABILITY_CAMERA_ZOOM_BEZIER_CURVC_POINT,
+    OHOS_STATUS_CAMERA_CURRENT_ZOOM_RATIO_RANGE,
+    OHOS_CONTROL_ZOOM_CENTER_POINT,
+    OHOS_ABILITY_ZOOM_CENTER_POINT_SUPPORTED,
+};
+
+constexpr item_info_t g_ohosStreamAbility[] = {
+    {"streamAvailableConfigurations", META_TYPE_INT32, -1},
+    {"streamAvailableFormats", META_TYPE_INT32, -1},
+    {"streamExtendConfigurations", META_TYPE_INT32, -1},
+    {"streamQuickThumbnailAvailable", META_TYPE_BYTE, 1},
+    {"streamPortraitResolusion", META_TYPE_INT32, -1},
+    {"sceneStreamQuickThumbnailAvailable", META_TYPE_BYTE, -1},
+    {"deferredImageDeliverySupportModes", META_TYPE_BYTE, -1},
+    {"deferredImageDeliveryMode", META_TYPE_BYTE, -1},
+    {"streamAutoFpsSupportedMode", META_TYPE_BYTE, -1},
+    {"offlineSupportedValue", META_TYPE_BYTE, -1},
+    {"offlineControlValue", META_TYPE_BYTE, -1},
+    {"rotationInIpsSupported", META_TYPE_BYTE, 1},
+    {"bandwidthCompressionAvailable", META_TYPE_BYTE, -1},
+    {"bandwidthCompressionControlValue", META_TYPE_BYTE, -1},
+    {"delayAlloc", META_TYPE_BYTE, 1},
+    {"prerecord", META_TYPE_INT32, -1},
+    {"trustedSignatureSupportModes", META_TYPE_BYTE, -1},
+    {"trustedSignatureMode", META_TYPE_INT32, -1},
+};
+
+constexpr uint32_t g_ohosStreamAbilityTags[] = {
+    OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS,
+    OHOS_STREAM_AVAILABLE_FORMATS,
+    OHOS_ABILITY_STREAM_AVAILABLE_EXTEND_CONFIGURATIONS,
+    OHOS_ABILITY_STREAM_QUICK_THUMBNAIL_AVAILABLE,
+    OHOS_ABILITY_PORTRAIT_RESOLUSION,
+    OHOS_ABILITY_SCENE_STREAM_QUICK_THUMBNAIL_AVAILABLE,
+    OHOS_ABILITY_DEFERRED_IMAGE_DELIVERY,
+    OHOS_CONTROL_DEFERRED_IMAGE_DELIVERY,
+    OHOS_ABILITY_AUTO_VIDEO_FRAME_RATE,
+    OHOS_ABILITY_CHANGETO_OFFLINE_STREAM_OPEATOR,
+    OHOS_CONTROL_CHANGETO_OFFLINE_STREAM_OPEATOR,
+    OHOS_ABILITY_ROTATION_IN_IPS_SUPPORTED,
+    OHOS_ABILITY_BANDWIDTH_COMPRESSION_AVAILABLE,
+    OHOS_CONTROL_BANDWIDTH_COMPRESSION,
+    OHOS_CONTROL_DELAY_ALLOC,
+    OHOS_ABILITY_PRERECORD,
+    OHOS_ABILITY_C2PA_SIGNATURE,
+    OHOS_CONTROL_C2PA_SIGNATURE,
+};
+
+constexpr item_info_t g_ohosStreamJpeg[] = {
+    {"gpsCoordinates", META_TYPE_DOUBLE, -1},
+    {"gpsProcessingMethod", META_TYPE_BYTE, 1},
+    {"gpsTimestamp", META_TYPE_INT64, 1},
+    {"jpegOrientation", META_TYPE_INT32, 1},
+    {"quality", META_TYPE_BYTE, 1},
+    {"compressionQuality", META_TYPE_INT32, 1},
+    {"thumbnailQuality", META_TYPE_BYTE, 1},
+    {"thumbnailSize", META_TYPE_INT32, -1},
+    {"availableThumbnailSizes", META_TYPE_INT32, -1},
+    {"maxSize", META_TYPE_INT32, 1},
+    {"size", META_TYPE_INT32, 1},
+};
+
+constexpr uint32_t g_ohosStreamJpegTags[] = {
+    OHOS_JPEG_GPS_COORDINATES,
+    OHOS_JPEG_GPS_PROCESSING_METHOD,
+    OHOS_JPEG_GPS_TIMESTAMP,
+    OHOS_JPEG_ORIENTATION,
+    OHOS_JPEG_QUALITY,
+    OHOS_PHOTO_COMPRESSION_QUALITY,
+    OHOS_JPEG_THUMBNAIL_QUALITY,
+    OHOS_JPEG_THUMBNAIL_SIZE,
+    OHOS_JPEG_AVAILABLE_THUMBNAIL_SIZES,
+    OHOS_JPEG_MAX_SIZE,
+    OHOS_JPEG_SIZE,
+};
+
+constexpr item_info_t g_ohosStreamVideo[] = {
+    {"videoAvailableStabilizationModes", META_TYPE_BYTE, -1},
+    {"videoStabilizationMode", META_TYPE_BYTE, 1},
+    {"videoDebugSwitch", META_TYPE_BYTE, 1},
+    {"cinemaVideoKeyFrameTimestamp", META_TYPE_INT64, 1},
+    {"cinemaVideoKeyFrameType", META_TYPE_BYTE, 1},
+};
+
+constexpr uint32_t g_ohosStreamVideoTags[] = {
+    OHOS_ABILITY_VIDEO_STABILIZATION_MODES,
+    OHOS_CONTROL_VIDEO_STABILIZATION_MODE,
+    OHOS_CONTROL_VIDEO_DEBUG_SWITCH,
+    OHOS_CINEMA_VIDEO_KEY_FRAME_TIMESTAMP,
+    OHOS_CINEMA_VIDEO_KEY_FRAME_TYPE,
+};
+
+constexpr item_info_t g_ohosStreamPhotoStitching[] = {
+    {"photoStitchingType", META_TYPE_BYTE, 1},
+    {"photoStitchingDirection", META_TYPE_BYTE, 1},
+    {"photoStitchingCaptureState", META_TYPE_BYTE, 1},
+    {"photoStitchingPosition", META_TYPE_FLOAT, -1},
+    {"photoStitchingAngle", META_TYPE_FLOAT, 1},
+    {"photoStitchingHint", META_TYPE_BYTE, 1},
+    {"photoStitchingMovingClockwise", META_TYPE_BYTE, 1},
+};
+
+constexpr uint32_t g_ohosStreamPhotoStitchingTags[] = {
+    OHOS_CONTROL_PHOTO_STITCHING_TYPE,
+    OHOS_CONTROL_PHOTO_STITCHING_DIRECTION,
+    OHOS_STATUS_PHOTO_STITCHING_CAPTURE_STATE,
+    OHOS_STATUS_PHOTO_STITCHING_POSITION,
+    OHOS_STATUS_PHOTO_STITCHING_ANGLE,
+    OHOS_STATUS_PHOTO_STITCHING_HINT,
+    OHOS_CONTROL_PHOTO_STITCHING_MOVING_CLOCKWISE,
+};
+
+constexpr item_info_t g_ohosPostProcess[] = {
+    {"sceneAvailableFilterTypes", META_TYPE_BYTE, -1},
+    {"filterType", META_TYPE_BYTE, 1},
+    {"sceneAvailablePotraitTypes", META_TYPE_BYTE, -1},
+    {"portraitType", META_TYPE_BYTE, 1},
+    {"sceneAvailableBeautyTypes", META_TYPE_BYTE, -1},
+    {"beautyType", META_TYPE_BYTE, 1},
+    {"availableAutoBeautyValues", META_TYPE_BYTE, -1},
+    {"autoBeautyValue", META_TYPE_BYTE, 1},
+    {"availableFaceSlenderValues", META_TYPE_BYTE, -1},
+    {"faceSlenderValue", META_TYPE_BYTE, 1},
+    {"availableSkinToneValues", META_TYPE_INT32, -1},
+    {"skinToneValue", META_TYPE_INT32, 1},
+    {"availableSkinSmoothValues", META_TYPE_BYTE, -1},
+    {"skinSmoothValue", META_TYPE_BYTE, 1},
+    {"availableSkinToneBrightValues", META_TYPE_BYTE, -1},
+    {"skinToneBrightValue", META_TYPE_BYTE, 1},
+    {"availableEyeBigEyesValues", META_TYPE_BYTE, -1},
+    {"eyeBigEyesValue", META_TYPE_BYTE, 1},
+    {"availableHairHairlineValues", META_TYPE_BYTE, -1},
+    {"hairHairlineValue", META_TYPE_BYTE, 1},
+    {"availableFaceMakeUpValues", META_TYPE_BYTE, -1},
+    {"faceMakeUpValue", META_TYPE_BYTE, 1},
+    {"availableHeadShrinkValues", META_TYPE_BYTE, -1},
+    {"headShrinkValue", META_TYPE_BYTE, 1},
+    {"availableNoseSlenderValues", META_TYPE_BYTE, -1},
+    {"noseSlenderValue", META_TYPE_BYTE, 1},
+    {"macroSupportedValue", META_TYPE_BYTE, 1},
+    {"sceneMacroCap", META_TYPE_INT32, -1},
+    {"macroStatusValue", META_TYPE_BYTE, 1},
+    {"macroStatusControlValue", META_TYPE_BYTE, 1},
+    {"cameraVirtualApertureRange", META_TYPE_FLOAT, -1},
+    {"cameraVirtualApertureControlValue", META_TYPE_FLOAT, 1},
+    {"cameraPhysicalApertureRange", META_TYPE_FLOAT, -1},
+    {"cameraPhysicalApertureControlValue", META_TYPE_FLOAT, 1},
+    {"currentCameraApertureValue", META_TYPE_FLOAT, 1},
+    {"currentCameraApertureEffect", META_TYPE_BYTE, 1},
+    {"cameraAutoFramingEnable", META_TYPE_BYTE, 1},
+    {"exitCameraEvent", META_TYPE_BYTE, 1},
+    {"superSlowMotionCheckArea", META_TYPE_FLOAT, -1},
+    {"superSlowMotionStatus", META_TYPE_BYTE, 1},
+    {"motionDetectionSupportValue", META_TYPE_BYTE, 1},
+    {"motionDetectionControlValue", META_TYPE_BYTE, 1},
+    {"exposureHintSupported", META_TYPE_BYTE, 1},
+    {"exposureHintMode", META_TYPE_BYTE, 1},
+    {"algoMeanY", META_TYPE_UINT32, 1},
+    {"previewPhysicalCameraId", META_TYPE_BYTE, 1},
+    {"captureExpectTime", META_TYPE_UINT32, -1},
+    {"effectSuggestionSupported", META_TYPE_INT32, -1},
+    {"effectSuggestion", META_TYPE_BYTE, 1},
+    {"effectSuggestionDetection", META_TYPE_BYTE, -1},
+    {"effectSuggestionType", META_TYPE_BYTE, 1},
+    {"controlEffectSuggestionType", META_TYPE_BYTE, 1},
+    {"supportedNightSubModes", META_TYPE_INT32, -1},
+    {"controlNightSubMode", META_TYPE_BYTE, 1},
+    {"controlGpsCoordinates", META_TYPE_DOUBLE, -1},
+    {"abilityConstellationDrawing", META_TYPE_INT32, -1},
+    {"controlConstellationDrawingDetect", META_TYPE_BYTE, 1},
+    {"controlConstellationDrawing", META_TYPE_BYTE, 1},
+    {"statusConstellationDrawingDetect", META_TYPE_FLOAT, -1},
+    {"statusConstellationDrawingState", META_TYPE_BYTE, -1},
+    {"abilityImageStabilizationGuide", META_TYPE_BYTE, 1},
+    {"controlImageStabilizationGuide", META_TYPE_BYTE, 1},
+    {"statusImageStabilizationGuide", META_TYPE_FLOAT, -1},
+    {"availableProfileLevel", META_TYPE_INT32, -1},
+    {"availablePreviewProfile", META_TYPE_INT32, -1},
+    {"availablePhotoProfile", META_TYPE_INT32, -1},
+    {"availableVideoProfile", META_TYPE_INT32, -1},
+    {"availableMetadataProfile", META_TYPE_INT32, -1},
+    {"availableConfigurations", META_TYPE_INT32, -1},
+    {"conflictConfigurations", META_TYPE_INT32, -1},
+    {"lightPaintingType", META_TYPE_BYTE, -1},
+    {"controlLightPaintingType", META_TYPE_BYTE, 1},
+    {"controlLightPaintingFlash", META_TYPE_BYTE, 1},
+    {"timeLapseInterval", META_TYPE_UINT32, 1},
+    {"timeLapseTryaeState", META_TYPE_BYTE, 1},
+    {"timeLapsePreviewType", META_TYPE_BYTE, 1},
+    {"timeLapseTryaeHint", META_TYPE_BYTE, 1},
+    {"timeLapseCaptureInterval", META_TYPE_UINT32, 1},
+    {"timeLapseTryaeDone", META_TYPE_BYTE, 1},
+    {"timeLapseRecordState", META_TYPE_BYTE, 1},
+    {"controlTimeLapsePreviewType", META_TYPE_BYTE, 1},
+    {"timeLapseIntervalRange", META_TYPE_UINT32, 1},
+    {"lcdFlash", META_TYPE_INT32, -1},
+    {"lcdFlashDetection", META_TYPE_BYTE, 1},
+    {"controlLcdFlash", META_TYPE_BYTE, 1},
+    {"lcdFlashStatus", META_TYPE_INT32, 1},
+    {"depthDataDelivery", META_TYPE_INT32, -1},
+    {"depthDataDeliverySwitch", META_TYPE_BYTE, 1},
+    {"depthDataProfiles", META_TYPE_INT32, -1},
+    {"depthDataAccuracy", META_TYPE_INT32, -1},
+    {"cameraIsRetractable", META_TYPE_BYTE, 1},
+    {"cameraCloseAfterSeconds", META_TYPE_UINT32, 1},
+    {"movingPhotoBufferDuration", META_TYPE_UINT32, 1},
+    {"movingPhotoStart", META_TYPE_INT64, 1},
+    {"movingPhotoEnd", META_TYPE_INT64, 1},
+    {"smoothZoomDuration", META_TYPE_INT32, 1},
+    {"captureMacroDepthFusionSupported", META_TYPE_BYTE, 1},
+    {"captureMacroDepthFussionZoomRange", META_TYPE_FLOAT, -1},
+    {"captureMacroDepthFusion", META_TYPE_BYTE, 1},
+    {"isPortraitThemeTypesSupported", META_TYPE_BYTE, 1},
+    {"supportedPortraitThemeTypes", META_TYPE_BYTE, -1},
+    {"portraitThemeType", META_TYPE_BYTE, 1},
+    {"isVideoRotationSupported", META_TYPE_BYTE, 1},
+    {"supportedVideoRotation", META_TYPE_INT32, -1},
+    {"videoRotation", META_TYPE_INT32, 1},
+    {"colorReservationTypes", META_TYPE_BYTE, -1},
+    {"colorReservationType", META_TYPE_BYTE, 1},
+    {"controlCenterSupported", META_TYPE_BYTE, 1},
+    {"controlCenterEffectType", META_TYPE_BYTE, -1},
+    {"isLogicalCamera", META_TYPE_BYTE, 1},
+    {"constituentCameraDevices", META_TYPE_BYTE, -1},
+    {"lensDistortion", META_TYPE_FLOAT, -1},
+    {"lensIntrinsicCalibration", META_TYPE_FLOAT, -1},
+    {"colorFilterArrangement", META_TYPE_BYTE, 1},
+    {"unsupportedMultiCameraCombinations", META_TYPE_INT32, -1},
+    {"modeSupportedstreams", META_TYPE_INT32, -1},
+    {"isCameraPublic", META_TYPE_BYTE, 1},
+    {"rawZoomCap", META_TYPE_FLOAT, -1},
+};
+
+constexpr uint32_t g_ohosPostProcessTags[] = {
+    OHOS_ABILITY_SCENE_FILTER_TYPES,
+    OHOS_CONTROL_FILTER_TYPE,
+    OHOS_ABILITY_SCENE_PORTRAIT_EFFECT_TYPES,
+    OHOS_CONTROL_PORTRAIT_EFFECT_TYPE,
+    OHOS_ABILITY_SCENE_BEAUTY_TYPES,
+    OHOS_CONTROL_BEAUTY_TYPE,
+    OHOS_ABILITY_BEAUTY_AUTO_VALUES,
+    OHOS_CONTROL_BEAUTY_AUTO_VALUE,
+    OHOS_ABILITY_BEAUTY_FACE_SLENDER_VALUES,
+    OHOS_CONTROL_BEAUTY_FACE_SLENDER_VALUE,
+    OHOS_ABILITY_BEAUTY_SKIN_TONE_VALUES,
+    OHOS_CONTROL_BEAUTY_SKIN_TONE_VALUE,
+    OHOS_ABILITY_BEAUTY_SKIN_SMOOTH_VALUES,
+    OHOS_CONTROL_BEAUTY_SKIN_SMOOTH_VALUE,
+    OHOS_ABILITY_BEAUTY_SKIN_TONEBRIGHT_VALUES,
+    OHOS_CONTROL_BEAUTY_SKIN_TONEBRIGHT_VALUE,
+    OHOS_ABILITY_BEAUTY_EYE_BIGEYES_VALUES,
+    OHOS_CONTROL_BEAUTY_EYE_BIGEYES_VALUE,
+    OHOS_ABILITY_BEAUTY_HAIR_HAIRLINE_VALUES,
+    OHOS_CONTROL_BEAUTY_HAIR_HAIRLINE_VALUE,
+    OHOS_ABILITY_BEAUTY_FACE_MAKEUP_VALUES,
+    OHOS_CONTROL_BEAUTY_FACE_MAKEUP_VALUE,
+    OHOS_ABILITY_BEAUTY_HEAD_SHRINK_VALUES,
+    OHOS_CONTROL_BEAUTY_HEAD_SHRINK_VALUE,
+    OHOS_ABILITY_BEAUTY_NOSE_SLENDER_VALUES,
+    OHOS_CONTROL_BEAUTY_NOSE_SLENDER_VALUE,
+    OHOS_ABILITY_CAMERA_MACRO_SUPPORTED,
+    OHOS_ABILITY_SCENE_MACRO_CAP,
+    OHOS_CAMERA_MACRO_STATUS,
+    OHOS_CONTROL_CAMERA_MACRO,
+    OHOS_ABILITY_CAMERA_VIRTUAL_APERTURE_RANGE,
+    OHOS_CONTROL_CAMERA_VIRTUAL_APERTURE_VALUE,
+    OHOS_ABILITY_CAMERA_PHYSICAL_APERTURE_RANGE,
+    OHOS_CONTROL_CAMERA_PHYSICAL_APERTURE_VALUE,
+    OHOS_STATUS_CAMERA_APERTURE_VALUE,
+    OHOS_STATUS_CAMERA_CURRENT_APERTURE_EFFECT,
+    OHOS_CONTROL_AUTO_FRAMING_ENABLE,
+    OHOS_DEVICE_EXITCAMERA_EVENT,
+    OHOS_CONTROL_MOTION_DETECTION_CHECK_AREA,
+    OHOS_STATUS_SLOW_MOTION_DETECTION,
+    OHOS_ABILITY_MOTION_DETECTION_SUPPORT,
+    OHOS_CONTROL_MOTION_DETECTION,
+    OHOS_ABILITY_EXPOSURE_HINT_SUPPORTED,
+    OHOS_CONTROL_EXPOSURE_HINT_MODE,
+    OHOS_STATUS_ALGO_MEAN_Y,
+    OHOS_STATUS_PREVIEW_PHYSICAL_CAMERA_ID,
+    OHOS_ABILITY_CAPTURE_EXPECT_TIME,
+    OHOS_ABILITY_EFFECT_SUGGESTION_SUPPORTED,
+    OHOS_CONTROL_EFFECT_SUGGESTION,
+    OHOS_CONTROL_EFFECT_SUGGESTION_DETECTION,
+    OHOS_CAMERA_EFFECT_SUGGESTION_TYPE,
+    OHOS_CONTROL_EFFECT_SUGGESTION_TYPE,
+    OHOS_ABILITY_NIGHT_SUB_MODES,
+    OHOS_CONTROL_NIGHT_SUB_MODE,
+    OHOS_CONTROL_GPS_COORDINATES,
+    OHOS_ABILITY_CONSTELLATION_DRAWING,
+    OHOS_CONTROL_CONSTELLATION_DRAWING_DETECT,
+    OHOS_CONTROL_CONSTELLATION_DRAWING,
+    OHOS_STATUS_CONSTELLATION_DRAWING_DETECT,
+    OHOS_CAMERA_CONSTELLATION_DRAWING_STATE,
+    OHOS_ABILITY_IMAGE_STABILIZATION_GUIDE,
+    OHOS_CONTROL_IMAGE_STABILIZATION_GUIDE,
+    OHOS_STATUS_IMAGE_STABILIZATION_GUIDE,
+    OHOS_ABILITY_AVAILABLE_PROFILE_LEVEL,
+    OHOS_ABILITY_AVAILABLE_PREVIEW_PROFILE,
+    OHOS_ABILITY_AVAILABLE_PHOTO_PROFILE,
+    OHOS_ABILITY_AVAILABLE_VIDEO_PROFILE,
+    OHOS_ABILITY_AVAILABLE_METADATA_PROFILE,
+    OHOS_ABILITY_AVAILABLE_CONFIGURATIONS,
+    OHOS_ABILITY_CONFLICT_CONFIGURATIONS,
+    OHOS_ABILITY_LIGHT_PAINTING_TYPE,
+    OHOS_CONTROL_LIGHT_PAINTING_TYPE,
+    OHOS_CONTROL_LIGHT_PAINTING_FLASH,
+    OHOS_CONTROL_TIME_LAPSE_INTERVAL,
+    OHOS_CONTROL_TIME_LAPSE_TRYAE_STATE,
+    OHOS_STATUS_TIME_LAPSE_PREVIEW_TYPE,
+    OHOS_STATUS_TIME_LAPSE_TRYAE_HINT,
+    OHOS_STATUS_TIME_LAPSE_CAPTURE_INTERVAL,
+    OHOS_STATUS_TIME_LAPSE_TRYAE_DONE,
+    OHOS_CONTROL_TIME_LAPSE_RECORD_STATE,
+    OHOS_CONTROL_TIME_LAPSE_PREVIEW_TYPE,
+    OHOS_ABILITY_TIME_LAPSE_INTERVAL_RANGE,
+    OHOS_ABILITY_LCD_FLASH,
+    OHOS_CONTROL_LCD_FLASH_DETECTION,
+    OHOS_CONTROL_LCD_FLASH,
+    OHOS_STATUS_LCD_FLASH_STATUS,
+    OHOS_ABILITY_DEPTH_DATA_DELIVERY,
+    OHOS_CONTROL_DEPTH_DATA_DELIVERY_SWITCH,
+    OHOS_ABILITY_DEPTH_DATA_PROFILES,
+    OHOS_CONTROL_DEPTH_DATA_ACCURACY,
+    OHOS_ABILITY_CAMERA_IS_RETRACTABLE,
+    OHOS_CONTROL_CAMERA_CLOSE_AFTER_SECONDS,
+    OHOS_MOVING_PHOTO_BUFFER_DURATION,
+    OHOS_MOVING_PHOTO_START,
+    OHOS_MOVING_PHOTO_END,
+    OHOS_SMOOTH_ZOOM_DURATION,
+    OHOS_ABILITY_CAPTURE_MACRO_DEPTH_FUSION_SUPPORTED,
+    OHOS_ABILITY_CAPTURE_MACRO_DEPTH_FUSION_ZOOM_RANGE,
+    OHOS_CONTROL_CAPTURE_MACRO_DEPTH_FUSION,
+    OHOS_ABILITY_CAMERA_PORTRAIT_THEME_SUPPORTED,
+    OHOS_ABILITY_CAMERA_PORTRAIT_THEME_TYPES,
+    OHOS_CONTROL_CAMERA_PORTRAIT_THEME_TYPE,
+    OHOS_ABILITY_CAMERA_VIDEO_ROTATION_SUPPORTED,
+    OHOS_ABILITY_CAMERA_VIDEO_ROTATION,
+    OHOS_CONTROL_CAMERA_VIDEO_ROTATION,
+    OHOS_ABILITY_COLOR_RESERVATION_TYPES,
+    OHOS_CONTROL_COLOR_RESERVATION_TYPE,
+    OHOS_ABILITY_CONTROL_CENTER_SUPPORTED,
+    OHOS_ABILITY_CONTROL_CENTER_EFFECT_TYPE,
+    OHOS_ABILITY_IS_LOGICAL_CAMERA,
+    OHOS_ABILITY_CONSTITUENT_CAMERA_DEVICES,
+    OHOS_ABILITY_LENS_DISTORTION,
+    OHOS_ABILITY_LENS_INTRINSIC_CALIBRATION,
+    OHOS_SENSOR_INFO_COLOR_FILTER_ARRANGEMENT,
+    OHOS_ABILITY_UNSUPPORTED_MULTI_CAMERA_COMBINATIONS,
+    OHOS_ABILITY_CAMERA_MODE_SUPPORTED_STREAMS,
+    OHOS_ABILITY_IS_CAMERA_PUBLIC,
+    OHOS_ABILITY_RAW_CAPTURE_SCENE_ZOOM_CAP,
+};
+
+constexpr item_info_t g_ohosCameraSecure[] = {
+    {"secureFaceMode", META_TYPE_INT32, 1},
+    {"secureFaceInfo", META_TYPE_INT32, -1},
+    {"faceAuthResult", META_TYPE_INT32, 1},
+    {"secureFlashSeq", META_TYPE_INT32, -1},
+    {"irLedSwitch", META_TYPE_BYTE, 1},
+    {"irLockaeSwitch", META_TYPE_BYTE, 1},
+};
+
+constexpr uint32_t g_ohosCameraSecureTags[] = {
+    OHOS_CONTROL_SECURE_FACE_MODE,
+    OHOS_CONTROL_SECURE_FACE_INFO,
+    OHOS_CONTROL_SECURE_FACE_AUTH_RESULT,
+    OHOS_CONTROL_SECURE_FLASH_SEQ,
+    OHOS_CONTROL_SECURE_IR_LED_SWITCH,
+    OHOS_CONTROL_SECURE_IR_LOCKAE_SWITCH,
+};
+
+constexpr item_info_t g_ohosCameraXmage[] = {
+    {"cameraXmageSupportMode", META_TYPE_INT32, 1},
+    {"sceneXmageSupportMode", META_TYPE_INT32, -1},
+    {"cameraXmageControlMode", META_TYPE_BYTE, 1},
+    {"colorStyleAvailable", META_TYPE_BYTE, 1},
+    {"colorStyleDefaultSettings", META_TYPE_FLOAT, -1},
+    {"colorStyleSetting", META_TYPE_FLOAT, -1},
+    {"colorStyleSettingStatus", META_TYPE_FLOAT, -1},
+    {"colorStyleSupportPhotoType", META_TYPE_BYTE, 1},
+    {"supportedColorTintValues", META_TYPE_INT32, -1},
+    {"colorTintValue", META_TYPE_INT32, 1},
+    {"awbgainValues", META_TYPE_INT32, -1},
+    {"awbgainRange", META_TYPE_INT32, -1},
+    {"supportedSaturationValues", META_TYPE_INT32, -1},
+    {"saturationValue", META_TYPE_INT32, 1},
+};
+
+constexpr uint32_t g_ohosCameraXmageTags[] = {
+    OHOS_ABILITY_SUPPORTED_COLOR_MODES,
+    OHOS_ABILITY_SCENE_SUPPORTED_COLOR_MODES,
+    OHOS_CONTROL_SUPPORTED_COLOR_MODES,
+    OHOS_ABILITY_COLOR_STYLE_AVAILABLE,
+    OHOS_ABILITY_COLOR_STYLE_DEFAULT_SETTINGS,
+    OHOS_CONTROL_COLOR_STYLE_SETTING,
+    OHOS_STATUS_COLOR_STYLE_SETTING,
+    OHOS_ABILITY_OUTPUT_COLOR_STYLE_PHOTO_TYPE,
+    OHOS_ABILITY_COLOR_TINT_RANGE,
+    OHOS_CONTROL_COLOR_TINT,
+    OHOS_CONTROL_RGBGAIN_VALUE,
+    OHOS_ABILITY_RGBGAIN_RANGE,
+    OHOS_ABILITY_SATURATION_RANGE,
+    OHOS_CONTROL_SATURATION,
+};
+
+constexpr item_info_t g_ohosStreamControl[] = {
+    {"streamAutoFpsControl", META_TYPE_BYTE, 1},
+    {"prerecordMode", META_TYPE_BYTE, 1},
+    {"recordState", META_TYPE_BYTE, 1},
+    {"streamSupplementaryInfo", META_TYPE_INT32, 1},
+};
+
+constexpr uint32_t g_ohosStreamControlTags[] = {
+    OHOS_CONTROL_AUTO_VIDEO_FRAME_RATE,
+    OHOS_CONTROL_PRERECORD_MODE,
+    OHOS_CONTROL_RECORD_STATE,
+    OHOS_STREAM_SUPPLEMENTARY_INFO,
+};
+
+constexpr item_info_t g_ohosCameraComposition[] = {
+    {"compositionSuggestionSupported", META_TYPE_BYTE, 1},
+    {"compositionSuggestion", META_TYPE_BYTE, 1},
+    {"compositionBegin", META_TYPE_BYTE, 1},
+    {"compositionPositionCalibration", META_TYPE_FLOAT, -1},
+    {"compositionPositionCalibrationExpand", META_TYPE_FLOAT, -1},
+    {"compositionMatched", META_TYPE_FLOAT, -1},
+    {"recommendedInfoLanguageSupported", META_TYPE_BYTE, -1},
+    {"recommendedInfoLanguage", META_TYPE_BYTE, 1},
+    {"compositionEffectPreviewSupported", META_TYPE_BYTE, 1},
+    {"compositionEffectPreview", META_TYPE_BYTE, 1},
+    {"compositionSuggestPictureSizes", META_TYPE_UINT32, -1},
+    {nullptr, META_TYPE_BYTE, 0}, // OHOS_COMPOSITION_END has no item info
+};
+
+constexpr uint32_t g_ohosCameraCompositionTags[] = {
+    OHOS_ABILITY_COMPOSITION_SUGGESTION,
+    OHOS_CONTROL_COMPOSITION_SUGGESTION,
+    OHOS_COMPOSITION_BEGIN,
+    OHOS_COMPOSITION_POSITION_CALIBRATION,
+    OHOS_COMPOSITION_POSITION_CALIBRATION_EXPAND,
+    OHOS_COMPOSITION_MATCHED,
+    OHOS_ABILITY_RECOMMENDED_INFO_LANGUAGE,
+    OHOS_CONTROL_RECOMMENDED_INFO_LANGUAGE,
+    OHOS_ABILITY_COMPOSITION_EFFECT_PREVIEW,
+    OHOS_CONTROL_COMPOSITION_EFFECT_PREVIEW,
+    OHOS_ABILITY_COMPOSITION_RECOMMENDED_PICTURE_SIZE,
+    OHOS_COMPOSITION_END,
+};
+
+constexpr item_info_t g_ohosCameraLightStatus[] = {
+    {"cameraLightStatusSupported", META_TYPE_BYTE, 1},
+    {"cameraLightStatusControl", META_TYPE_BYTE, 1},
+    {"cameraLightStatus", META_TYPE_BYTE, 1},
+};
+
+constexpr uint32_t g_ohosCameraLightStatusTags[] = {
+    OHOS_ABILITY_LIGHT_STATUS,
+    OHOS_CONTROL_LIGHT_STATUS,
+    OHOS_STATUS_LIGHT_STATUS,
+};
+
+constexpr item_info_t g_ohosCameraDataDelivery[] = {
+    {"autoMotionBoostDelivery", META_TYPE_BYTE, -1},
+    {"controlAutoMotionBoostDelivery", META_TYPE_BYTE, 1},
+    {"autoBokehDataDelivery", META_TYPE_BYTE, -1},
+    {"controlAutoBokehDataDelivery", META_TYPE_BYTE, 1},
+};
+
+constexpr uint32_t g_ohosCameraDataDeliveryTags[] = {
+    OHOS_ABILITY_AUTO_MOTION_BOOST_DELIVERY,
+    OHOS_CONTROL_AUTO_MOTION_BOOST_DELIVERY_SWITCH,
+    OHOS_ABILITY_AUTO_BOKEH_DATA_DELIVERY,
+    OHOS_CONTROL_AUTO_BOKEH_DATA_DELIVERY_SWITCH,
+};
+
+constexpr item_info_t g_ohosCameraOpticalImageStabilization[] = {
+    {"opticalImageStabilizationSupportedModes", META_TYPE_INT32, -1},
+    {"opticalImageStabilizationMode", META_TYPE_INT32, 1},
+    {"opticalImageStabilizationModeStatus", META_TYPE_INT32, 1},
+    {"opticalImageStabilizationSupportedBiasRange", META_TYPE_FLOAT, -1},
+    {"opticalImageStabilizationBias", META_TYPE_FLOAT, -1},
+};
+
+constexpr uint32_t g_ohosCameraOpticalImageStabilizationTags[] = {
+    OHOS_ABILITY_OPTICAL_IMAGE_STABILIZATION_MODES,
+    OHOS_CONTROL_OPTICAL_IMAGE_STABILIZATION_MODE,
+    OHOS_STATUS_OPTICAL_IMAGE_STABILIZATION_MODE,
+    OHOS_ABILITY_OPTICAL_IMAGE_STABILIZATION_BIAS_RANGE,
+    OHOS_CONTROL_SET_CUSTOM_OPTICAL_IMAGE_STABILIZATION_BIAS,
+};
+
+// Indexed by camera_metadata_sec_t
+constexpr metadata_section_desc_t g_ohosSectionDescs[] = {
+    MakeMetadataSectionDesc(OHOS_CAMERA_PROPERTIES_START, OHOS_CAMERA_PROPERTIES_END,
+        g_ohosCameraProperties, g_ohosCameraPropertiesTags),
+    MakeMetadataSectionDesc(OHOS_CAMERA_SENSOR_START, OHOS_CAMERA_SENSOR_END,
+        g_ohosCameraSensor, g_ohosCameraSensorTags),
+    MakeMetadataSectionDesc(OHOS_CAMERA_SENSOR_INFO_START, OHOS_CAMERA_SENSOR_INFO_END,
+        g_ohosCameraSensorInfo, g_ohosCameraSensorInfoTags),
+    MakeMetadataSectionDesc(OHOS_CAMERA_STATISTICS_START, OHOS_CAMERA_STATISTICS_END,
+        g_ohosCameraStatistics, g_ohosCameraStatisticsTags),
+    MakeMetadataSectionDesc(OHOS_DEVICE_CONTROL_START, OHOS_DEVICE_CONTROL_END,
+        g_ohosCameraControl, g_ohosCameraControlTags),
+    MakeMetadataSectionDesc(OHOS_DEVICE_EXPOSURE_START, OHOS_DEVICE_EXPOSURE_END,
+        g_ohosDeviceExposure, g_ohosDeviceExposureTags),
+    MakeMetadataSectionDesc(OHOS_DEVICE_FOCUS_START, OHOS_DEVICE_FOCUS_END, g_ohosDeviceFocus, g_ohosDeviceFocusTags),
+    MakeMetadataSectionDesc(OHOS_DEVICE_WHITE_BLANCE_START, OHOS_DEVICE_WHITE_BLANCE_END,
+        g_ohosDeviceWhite, g_ohosDeviceWhiteTags),
+    MakeMetadataSectionDesc(OHOS_DEVICE_FLASH_START, OHOS_DEVICE_FLASH_END, g_ohosDeviceFlash, g_ohosDeviceFlashTags),
+    MakeMetadataSectionDesc(OHOS_DEVICE_ZOOM_START, OHOS_DEVICE_ZOOM_END, g_ohosDeviceZoom, g_ohosDeviceZoomTags),
+    MakeMetadataSectionDesc(OHOS_STREAM_ABILITY_START, OHOS_STREAM_ABILITY_END,
+        g_ohosStreamAbility, g_ohosStreamAbilityTags),
+    MakeMetadataSectionDesc(OHOS_STREAM_JPEG_START, OHOS_STREAM_JPEG_END, g_ohosStreamJpeg, g_ohosStreamJpegTags),
+    MakeMetadataSectionDesc(OHOS_STREAM_VIDEO_START, OHOS_STREAM_VIDEO_END, g_ohosStreamVideo, g_ohosStreamVideoTags),
+    MakeMetadataSectionDesc(OHOS_STREAM_PHOTO_STITCHING_START, OHOS_STREAM_PHOTO_STITCHING_END,
+        g_ohosStreamPhotoStitching, g_ohosStreamPhotoStitchingTags),
+    MakeMetadataSectionDesc(OHOS_CAMERA_EFFECT_START, OHOS_CAMERA_EFFECT_END, g_ohosPostProcess, g_ohosPostProcessTags),
+    MakeMetadataSectionDesc(OHOS_CAMERA_SECURE_START, OHOS_CAMERA_SECURE_END,
+        g_ohosCameraSecure, g_ohosCameraSecureTags),
+    MakeMetadataSectionDesc(OHOS_XMAGE_COLOR_MODES_START, OHOS_XMAGE_COLOR_MODES_END,
+        g_ohosCameraXmage, g_ohosCameraXmageTags),
+    MakeMetadataSectionDesc(OHOS_STREAM_CONTROL_START, OHOS_STREAM_CONTROL_END,
+        g_ohosStreamControl, g_ohosStreamControlTags),
+    MakeMetadataSectionDesc(OHOS_COMPOSITION_SUGGESTION_START, OHOS_COMPOSITION_SUGGESTION_END,
+        g_ohosCameraComposition, g_ohosCameraCompositionTags),
+    MakeMetadataSectionDesc(OHOS_LIGHT_STATUS_START, OHOS_LIGHT_STATUS_END,
+        g_ohosCameraLightStatus, g_ohosCameraLightStatusTags),
+    MakeMetadataSectionDesc(OHOS_DATA_DELIVERY_START, OHOS_DATA_DELIVERY_END,
+        g_ohosCameraDataDelivery, g_ohosCameraDataDeliveryTags),
+    MakeMetadataSectionDesc(OHOS_OPTICAL_IMAGE_STABILIZATION_START, OHOS_OPTICAL_IMAGE_STABILIZATION_END,
+        g_ohosCameraOpticalImageStabilization, g_ohosCameraOpticalImageStabilizationTags),
+};
+
+constexpr uint32_t g_ohosSectionDescIds[] = {
+    OHOS_SECTION_CAMERA_PROPERTIES,
+    OHOS_SECTION_CAMERA_SENSOR,
+    OHOS_SECTION_CAMERA_SENSOR_INFO,
+    OHOS_SECTION_CAMERA_STATISTICS,
+    OHOS_SECTION_CAMERA_CONTROL,
+    OHOS_SECTION_DEVICE_EXPOSURE,
+    OHOS_SECTION_DEVICE_FOCUS,
+    OHOS_SECTION_DEVICE_WHITE,
+    OHOS_SECTION_DEVICE_FLASH,
+    OHOS_SECTION_DEVICE_ZOOM,
+    OHOS_SECTION_STREAM_ABILITY,
+    OHOS_SECTION_STREAM_JPEG,
+    OHOS_SECTION_STREAM_VIDEO,
+    OHOS_SECTION_STREAM_PHOTO_STITCHING,
+    OHOS_SECTION_CAMERA_EFFECT,
+    OHOS_SECTION_CAMERA_SECURE,
+    OHOS_SECTION_CAMERA_XMAGE,
+    OHOS_SECTION_STREAM_CONTROL,
+    OHOS_SECTION_COMPOSITION_SUGGESTION,
+    OHOS_SECTION_LIGHT_STATUS,
+    OHOS_SECTION_DATA_DELIVERY,
+    OHOS_SECTION_OPTICAL_IMAGE_STABILIZATION,
+};
+
+// Tags dumped by FormatCameraMetadataToString, in output order
+constexpr uint32_t g_metadataDumpTags[] = {
+    OHOS_ABILITY_CAMERA_POSITION,
+    OHOS_ABILITY_CAMERA_TYPE,
+    OHOS_ABILITY_CAMERA_CONNECTION_TYPE,
+    OHOS_ABILITY_MEMORY_TYPE,
+    OHOS_ABILITY_FPS_RANGES,
+    OHOS_ABILITY_FLASH_AVAILABLE,
+    OHOS_ABILITY_FLASHLIGHT_ADJUST_SUPPORTED,
+    OHOS_CAMERA_STREAM_ID,
+    OHOS_ABILITY_PRELAUNCH_AVAILABLE,
+    OHOS_ABILITY_CUSTOM_VIDEO_FPS,
+    OHOS_ABILITY_CAMERA_MODES,
+    OHOS_ABILITY_SKETCH_ENABLE_RATIO,
+    OHOS_ABILITY_SKETCH_REFERENCE_FOV_RATIO,
+    OHOS_ABILITY_SKETCH_INFO_NOTIFICATION,
+    OHOS_ABILITY_CAMERA_FOLDSCREEN_TYPE,
+    OHOS_ABILITY_AVAILABLE_COLOR_SPACES,
+    OHOS_ABILITY_NIGHT_MODE_SUPPORTED_EXPOSURE_TIME,
+    OHOS_CAMERA_MESURE_EXPOSURE_TIME,
+    OHOS_CAMERA_EXPOSURE_MODE_PREVIEW_STATE,
+    OHOS_CAMERA_USER_ID,
+    OHOS_ABILITY_MOON_CAPTURE_BOOST,
+    OHOS_CONTROL_MOON_CAPTURE_BOOST,
+    OHOS_STATUS_MOON_CAPTURE_DETECTION,
+    OHOS_ABILITY_CAPTURE_DURATION_SUPPORTED,
+    OHOS_CAMERA_CUSTOM_SNAPSHOT_DURATION,
+    OHOS_CAMERA_CONSTELLATION_DRAWING_STATE,
+    OHOS_ABILITY_MOVING_PHOTO,
+    OHOS_ABILITY_FLASH_SUGGESTION_SUPPORTED,
+    OHOS_CONTROL_FLASH_SUGGESTION_SWITCH,
+    OHOS_STATUS_FLASH_SUGGESTION,
+    OHOS_ABILITY_HIGH_QUALITY_SUPPORT,
+    OHOS_ABILITY_CAMERA_FOLD_STATUS,
+    OHOS_STATUS_CAMERA_OCCLUSION_DETECTION,
+    OHOS_ABILITY_STATISTICS_DETECT_TYPE,
+    OHOS_CONTROL_STATISTICS_DETECT_SETTING,
+    OHOS_ABILITY_AVAILABLE_EXTENDED_STREAM_INFO_TYPES,
+    OHOS_ABILITY_AUTO_DEFERRED_VIDEO_ENHANCE,
+    OHOS_CONTROL_AUTO_DEFERRED_VIDEO_ENHANCE,
+    OHOS_ABILITY_AUTO_CLOUD_IMAGE_ENHANCE,
+    OHOS_CONTROL_AUTO_CLOUD_IMAGE_ENHANCE,
+    OHOS_ABILITY_TRIPOD_DETECTION,
+    OHOS_CONTROL_TRIPOD_DETECTION,
+    OHOS_CONTROL_TRIPOD_STABLITATION,
+    OHOS_STATUS_TRIPOD_DETECTION_STATUS,
+    OHOS_STATUS_SKETCH_POINT,
+    OHOS_STATUS_SKETCH_STREAM_INFO,
+    OHOS_ABILITY_LOW_LIGHT_BOOST,
+    OHOS_CONTROL_LOW_LIGHT_DETECT,
+    OHOS_CONTROL_LOW_LIGHT_BOOST,
+    OHOS_STATUS_LOW_LIGHT_DETECTION,
+    OHOS_STATUS_CAMERA_LENS_DIRTY_DETECTION,
+    OHOS_DEVICE_PROTECTION_STATE,
+    OHOS_STATUS_TOF_SENSOR_ABNORMAL,
+    OHOS_ABILITY_SUN_BLOCK_PREVIEW_TYPES,
+    OHOS_ABILITY_SUN_BLOCK_BLEND_COLORS,
+    OHOS_ABILITY_SUN_BLOCK_RGB_CROP_REGION,
+    OHOS_ABILITY_SUN_BLOCK_RGB_UV_REGION,
+    OHOS_STATUS_SUN_BLOCK_HINT,
+    OHOS_ABILITY_AUTO_AIGC_PHOTO,
+    OHOS_CONTROL_AUTO_AIGC_PHOTO,
+    OHOS_ABILITY_CAMERA_LIMITED_CAPABILITIES,
+    OHOS_ABILITY_CAMERA_CONCURRENT_TYPE,
+    OHOS_ABILITY_CONCURRENT_SUPPORTED_CAMERAS,
+    OHOS_ABILITY_LOG_ASSISTANCE_SUPPORTED,
+    OHOS_ABILITY_STAGE_BOOST,
+    OHOS_CONTROL_STAGE_BOOST,
+    OHOS_ABILITY_AUTOMOTIVE_CAMERA_POSITION,
+    OHOS_ABILITY_AUTO_EXTENDED_GAINMAP_DELIVERY,
+    OHOS_CONTROL_AUTO_EXTENDED_GAINMAP_DELIVERY,
+    OHOS_CONTROL_CAMERA_CONCURRENT_CAPTURE,
+    OHOS_ABILITY_SPECTRUM_SUPPORTED,
+    OHOS_ABILITY_SPECTRUM_INFOS,
+    OHOS_ABILITY_AUTOMOTIVE_CAMERA_SENSOR_TYPE,
+    OHOS_ABILITY_COMMON_PUBLISHED_FEATURES,
+    OHOS_SENSOR_EXPOSURE_TIME,
+    OHOS_SENSOR_COLOR_CORRECTION_GAINS,
+    OHOS_SENSOR_ORIENTATION,
+    OHOS_ABILITY_MUTE_MODES,
+    OHOS_CONTROL_MUTE_MODE,
+    OHOS_ABILITY_SENSOR_ORIENTATION_VARIABLE,
+    OHOS_FOLD_STATE_SENSOR_ORIENTATION_MAP,
+    OHOS_FOLD_STATE_AND_NATURAL_DIRECTION_SENSOR_ORIENTATION_MAP,
+    OHOS_SENSOR_INFO_ACTIVE_ARRAY_SIZE,
+    OHOS_SENSOR_INFO_SENSITIVITY_RANGE,
+    OHOS_SENSOR_INFO_MAX_FRAME_DURATION,
+    OHOS_SENSOR_INFO_PHYSICAL_SIZE,
+    OHOS_SENSOR_INFO_PIXEL_ARRAY_SIZE,
+    OHOS_SENSOR_INFO_TIMESTAMP,
+    OHOS_STATISTICS_FACE_DETECT_MODE,
+    OHOS_STATISTICS_FACE_DETECT_SWITCH,
+    OHOS_STATISTICS_FACE_DETECT_MAX_NUM,
+    OHOS_STATISTICS_HISTOGRAM_MODE,
+    OHOS_STATISTICS_FACE_IDS,
+    OHOS_STATISTICS_FACE_LANDMARKS,
+    OHOS_STATISTICS_FACE_RECTANGLES,
+    OHOS_STATISTICS_FACE_SCORES,
+    OHOS_STATISTICS_TIMESTAMP,
+    OHOS_STATISTICS_DETECT_HUMAN_FACE_INFOS,
+    OHOS_STATISTICS_DETECT_HUMAN_BODY_INFOS,
+    OHOS_STATISTICS_DETECT_HUMAN_HEAD_INFOS,
+    OHOS_STATISTICS_DETECT_CAT_FACE_INFOS,
+    OHOS_STATISTICS_DETECT_CAT_BODY_INFOS,
+    OHOS_STATISTICS_DETECT_DOG_FACE_INFOS,
+    OHOS_STATISTICS_DETECT_DOG_BODY_INFOS,
+    OHOS_STATISTICS_DETECT_SALIENT_INFOS,
+    OHOS_STATISTICS_DETECT_BAR_CODE_INFOS,
+    OHOS_STATISTICS_DETECT_BASE_FACE_INFO,
+    OHOS_CONTROL_AE_ANTIBANDING_MODE,
+    OHOS_CONTROL_AE_EXPOSURE_COMPENSATION,
+    OHOS_CONTROL_AE_LOCK,
+    OHOS_CONTROL_AE_MODE,
+    OHOS_CONTROL_AE_REGIONS,
+    OHOS_CONTROL_AE_TARGET_FPS_RANGE,
+    OHOS_CONTROL_FPS_RANGES,
+    OHOS_CONTROL_AF_MODE,
+    OHOS_CONTROL_AF_REGIONS,
+    OHOS_CONTROL_AF_TRIGGER,
+    OHOS_CONTROL_AF_TRIGGER_ID,
+    OHOS_CONTROL_AF_STATE,
+    OHOS_CONTROL_AWB_LOCK,
+    OHOS_CONTROL_AWB_MODE,
+    OHOS_CONTROL_AWB_REGIONS,
+    OHOS_CONTROL_AE_AVAILABLE_ANTIBANDING_MODES,
+    OHOS_CONTROL_AE_AVAILABLE_MODES,
+    OHOS_CONTROL_AE_AVAILABLE_TARGET_FPS_RANGES,
+    OHOS_CONTROL_AE_COMPENSATION_RANGE,
+    OHOS_CONTROL_AE_COMPENSATION_STEP,
+    OHOS_ABILITY_AE_COMPENSATION_RANGE,
+    OHOS_ABILITY_AE_COMPENSATION_STEP,
+    OHOS_CONTROL_AF_AVAILABLE_MODES,
+    OHOS_CONTROL_AWB_AVAILABLE_MODES,
+    OHOS_CONTROL_CAPTURE_MIRROR_SUPPORTED,
+    OHOS_CONTROL_CAPTURE_MIRROR,
+    OHOS_CONTROL_FOCUS_STATE,
+    OHOS_CONTROL_METER_POINT,
+    OHOS_CONTROL_METER_MODE,
+    OHOS_CONTROL_EXPOSURE_STATE,
+    OHOS_CONTROL_FOCUSED_POINT,
+    OHOS_CONTROL_NIGHT_MODE_TRY_AE,
+    OHOS_CONTROL_MANUAL_EXPOSURE_TIME,
+    OHOS_STATUS_CAMERA_CURRENT_FPS,
+    OHOS_ABILITY_ISO_VALUES,
+    OHOS_CONTROL_ISO_VALUE,
+    OHOS_STATUS_ISO_VALUE,
+    OHOS_ABILITY_SENSOR_EXPOSURE_TIME_RANGE,
+    OHOS_CONTROL_SENSOR_EXPOSURE_TIME,
+    OHOS_STATUS_SENSOR_EXPOSURE_TIME,
+    OHOS_CONTROL_MOVING_PHOTO,
+    OHOS_ABILITY_SENSOR_WB_VALUES,
+    OHOS_CONTROL_SENSOR_WB_VALUE,
+    OHOS_CONTROL_HIGH_QUALITY_MODE,
+    OHOS_CONTROL_APP_HINT,
+    OHOS_CONTROL_BURST_CAPTURE,
+    OHOS_CONTROL_CAMERA_USED_AS_POSITION,
+    OHOS_CONTROL_CAMERA_SESSION_USAGE,
+    OHOS_CONTROL_EJECT_RETRY,
+    OHOS_CONTROL_FALL_PROTECTION,
+    OHOS_CONTROL_SUN_BLOCK_PREVIEW_TYPE,
+    OHOS_CONTROL_SUN_BLOCK_BLEND_COLOR,
+    OHOS_CONTROL_QUALITY_PRIORITIZATION,
+    OHOS_CONTROL_LOG_ASSISTANCE,
+    OHOS_CONTROL_CAPTURE_ROTATION,
+    OHOS_CONTROL_AUTO_VIDEO_FRAME_RATE,
+    OHOS_ABILITY_AUTO_VIDEO_FRAME_RATE,
+    OHOS_ABILITY_EXTERNAL_CAMERA_LENS_BOOST,
+    OHOS_CONTROL_EXTERNAL_CAMERA_LENS_BOOST,
+    OHOS_ABILITY_PHOTO_QUALITY_PRIORITIZATION,
+    OHOS_CONTROL_PHOTO_QUALITY_PRIORITIZATION,
+    OHOS_CONTROL_REQUEST_CAMERA_SWITCH,
+    OHOS_CONTROL_CAMERA_SWITCH_INFOS,
+    OHOS_CONTROL_REMOVE_SENSOR_RESTRAINT,
+    OHOS_ABILITY_CAMERA_PREVIEW_QUALITY_PRIORITIZATION,
+    OHOS_CONTROL_CAMERA_PREVIEW_QUALITY_PRIORITIZATION,
+    OHOS_ABILITY_IMAGING_MODES,
+    OHOS_CONTROL_IMAGING_MODE,
+    OHOS_ABILITY_GENERATE_ORIGINAL_IMAGE,
+    OHOS_CONTROL_GENERATE_ORIGINAL_IMAGE,
+    OHOS_ABILITY_DEVICE_AVAILABLE_EXPOSUREMODES,
+    OHOS_CONTROL_EXPOSUREMODE,
+    OHOS_ABILITY_EXPOSURE_MODES,
+    OHOS_CONTROL_EXPOSURE_MODE,
+    OHOS_ABILITY_METER_MODES,
+    OHOS_ABILITY_SCENE_EXPOSURE_MODES,
+    OHOS_ABILITY_EXPOSURE_TIME,
+    OHOS_ABILITY_AE_LOCK,
+    OHOS_ABILITY_DEVICE_AVAILABLE_FOCUSMODES,
+    OHOS_CONTROL_FOCUSMODE,
+    OHOS_ABILITY_FOCUS_MODES,
+    OHOS_CONTROL_FOCUS_MODE,
+    OHOS_ABILITY_FOCAL_LENGTH,
+    OHOS_ABILITY_SCENE_FOCUS_MODES,
+    OHOS_ABILITY_FOCUS_ASSIST_FLASH_SUPPORTED_MODES,
+    OHOS_CONTROL_FOCUS_ASSIST_FLASH_SUPPORTED_MODE,
+    OHOS_ABILITY_LENS_INFO_MINIMUM_FOCUS_DISTANCE,
+    OHOS_CONTROL_LENS_FOCUS_DISTANCE,
+    OHOS_ABILITY_EQUIVALENT_FOCUS,
+    OHOS_ABILITY_LENS_EQUIVALENT_FOCUS,
+    OHOS_CONTROL_FOCUS_DISTANCE,
+    OHOS_ABILITY_FOCUS_RANGE_TYPES,
+    OHOS_CONTROL_FOCUS_RANGE_TYPE,
+    OHOS_ABILITY_FOCUS_TRACKING_MODES,
+    OHOS_CONTROL_FOCUS_TRACKING_MODE,
+    OHOS_ABILITY_FOCUS_TRACKING_REGION,
+    OHOS_ABILITY_FOCUS_DRIVEN_TYPES,
+    OHOS_CONTROL_FOCUS_DRIVEN_TYPE,
+    OHOS_ABILITY_FOCUS_TRACKING_MECH_AVAILABLE,
+    OHOS_CONTROL_FOCUS_TRACKING_MECH,
+    OHOS_CONTROL_FOCUS_TRACKING_OBJECT_ID,
+    OHOS_STATUS_FOV_INFOS,
+    OHOS_ABILITY_TYPICAL_SCENE_ZOOM_POINTS,
+    OHOS_ABILITY_LOCK_OBJECT_TRACKING_AVAILABLE,
+    OHOS_CONTROL_LOCK_OBJECT_TRACKING,
+    OHOS_ABILITY_DEVICE_AVAILABLE_AWBMODES,
+    OHOS_ABILITY_AWB_MODES,
+    OHOS_ABILITY_AWB_LOCK,
+    OHOS_ABILITY_DEVICE_AVAILABLE_FLASHMODES,
+    OHOS_CONTROL_FLASHMODE,
+    OHOS_ABILITY_FLASH_MODES,
+    OHOS_CONTROL_FLASH_MODE,
+    OHOS_CONTROL_FLASH_STATE,
+    OHOS_ABILITY_SCENE_FLASH_MODES,
+    OHOS_ABILITY_ZOOM_RATIO_RANGE,
+    OHOS_CONTROL_ZOOM_RATIO,
+    OHOS_CONTROL_ZOOM_CROP_REGION,
+    OHOS_ABILITY_ZOOM_CAP,
+    OHOS_ABILITY_SCENE_ZOOM_CAP,
+    OHOS_STATUS_CAMERA_CURRENT_ZOOM_RATIO,
+    OHOS_CONTROL_SMOOTH_ZOOM_RATIOS,
+    OHOS_CONTROL_CAMERA_TARGET_ZOOM_RATIO,
+    OHOS_ABILITY_CAMERA_NEED_SET_SMOOTH,
+    OHOS_CONTROL_PREPARE_ZOOM,
+    OHOS_ABILITY_CAMERA_ZOOM_PERFORMANCE,
+    OHOS_STATUS_CAMERA_ZOOM_PERFORMANCE,
+    OHOS_ABILITY_CAMERA_ZOOM_BEZIER_CURVC_POINT,
+    OHOS_CONTROL_ZOOM_CENTER_POINT,
+    OHOS_ABILITY_ZOOM_CENTER_POINT_SUPPORTED,
+    OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS,
+    OHOS_STREAM_AVAILABLE_FORMATS,
+    OHOS_ABILITY_STREAM_AVAILABLE_EXTEND_CONFIGURATIONS,
+    OHOS_ABILITY_STREAM_QUICK_THUMBNAIL_AVAILABLE,
+    OHOS_ABILITY_PORTRAIT_RESOLUSION,
+    OHOS_ABILITY_SCENE_STREAM_QUICK_THUMBNAIL_AVAILABLE,
+    OHOS_ABILITY_DEFERRED_IMAGE_DELIVERY,
+    OHOS_CONTROL_DEFERRED_IMAGE_DELIVERY,
+    OHOS_ABILITY_PRERECORD,
+    OHOS_CONTROL_PRERECORD_MODE,
+    OHOS_CONTROL_RECORD_STATE,
+    OHOS_STREAM_SUPPLEMENTARY_INFO,
+    OHOS_ABILITY_CHANGETO_OFFLINE_STREAM_OPEATOR,
+    OHOS_CONTROL_CHANGETO_OFFLINE_STREAM_OPEATOR,
+    OHOS_ABILITY_ROTATION_IN_IPS_SUPPORTED,
+    OHOS_ABILITY_BANDWIDTH_COMPRESSION_AVAILABLE,
+    OHOS_CONTROL_BANDWIDTH_COMPRESSION,
+    OHOS_CONTROL_DELAY_ALLOC,
+    OHOS_ABILITY_C2PA_SIGNATURE,
+    OHOS_CONTROL_C2PA_SIGNATURE,
+    OHOS_JPEG_GPS_COORDINATES,
+    OHOS_JPEG_GPS_PROCESSING_METHOD,
+    OHOS_JPEG_GPS_TIMESTAMP,
+    OHOS_JPEG_ORIENTATION,
+    OHOS_JPEG_QUALITY,
+    OHOS_JPEG_THUMBNAIL_QUALITY,
+    OHOS_JPEG_THUMBNAIL_SIZE,
+    OHOS_JPEG_AVAILABLE_THUMBNAIL_SIZES,
+    OHOS_JPEG_MAX_SIZE,
+    OHOS_JPEG_SIZE,
+    OHOS_ABILITY_VIDEO_STABILIZATION_MODES,
+    OHOS_CONTROL_VIDEO_STABILIZATION_MODE,
+    OHOS_CONTROL_VIDEO_DEBUG_SWITCH,
+    OHOS_CINEMA_VIDEO_KEY_FRAME_TIMESTAMP,
+    OHOS_CINEMA_VIDEO_KEY_FRAME_TYPE,
+    OHOS_ABILITY_SCENE_FILTER_TYPES,
+    OHOS_CONTROL_FILTER_TYPE,
+    OHOS_ABILITY_SCENE_PORTRAIT_EFFECT_TYPES,
+    OHOS_CONTROL_PORTRAIT_EFFECT_TYPE,
+    OHOS_ABILITY_SCENE_BEAUTY_TYPES,
+    OHOS_CONTROL_BEAUTY_TYPE,
+    OHOS_ABILITY_BEAUTY_AUTO_VALUES,
+    OHOS_CONTROL_BEAUTY_AUTO_VALUE,
+    OHOS_ABILITY_BEAUTY_FACE_SLENDER_VALUES,
+    OHOS_CONTROL_BEAUTY_FACE_SLENDER_VALUE,
+    OHOS_ABILITY_BEAUTY_SKIN_TONE_VALUES,
+    OHOS_CONTROL_BEAUTY_SKIN_TONE_VALUE,
+    OHOS_ABILITY_BEAUTY_SKIN_SMOOTH_VALUES,
+    OHOS_CONTROL_BEAUTY_SKIN_SMOOTH_VALUE,
+    OHOS_ABILITY_BEAUTY_SKIN_TONEBRIGHT_VALUES,
+    OHOS_CONTROL_BEAUTY_SKIN_TONEBRIGHT_VALUE,
+    OHOS_ABILITY_BEAUTY_EYE_BIGEYES_VALUES,
+    OHOS_CONTROL_BEAUTY_EYE_BIGEYES_VALUE,
+    OHOS_ABILITY_BEAUTY_HAIR_HAIRLINE_VALUES,
+    OHOS_CONTROL_BEAUTY_HAIR_HAIRLINE_VALUE,
+    OHOS_ABILITY_BEAUTY_FACE_MAKEUP_VALUES,
+    OHOS_CONTROL_BEAUTY_FACE_MAKEUP_VALUE,
+    OHOS_ABILITY_BEAUTY_HEAD_SHRINK_VALUES,
+    OHOS_CONTROL_BEAUTY_HEAD_SHRINK_VALUE,
+    OHOS_ABILITY_BEAUTY_NOSE_SLENDER_VALUES,
+    OHOS_CONTROL_BEAUTY_NOSE_SLENDER_VALUE,
+    OHOS_ABILITY_CAMERA_MACRO_SUPPORTED,
+    OHOS_ABILITY_SCENE_MACRO_CAP,
+    OHOS_CAMERA_MACRO_STATUS,
+    OHOS_CONTROL_CAMERA_MACRO,
+    OHOS_ABILITY_CAMERA_VIRTUAL_APERTURE_RANGE,
+    OHOS_CONTROL_CAMERA_VIRTUAL_APERTURE_VALUE,
+    OHOS_ABILITY_CAMERA_PHYSICAL_APERTURE_RANGE,
+    OHOS_CONTROL_CAMERA_PHYSICAL_APERTURE_VALUE,
+    OHOS_STATUS_CAMERA_APERTURE_VALUE,
+    OHOS_STATUS_CAMERA_CURRENT_APERTURE_EFFECT,
+    OHOS_CONTROL_AUTO_FRAMING_ENABLE,
+    OHOS_DEVICE_EXITCAMERA_EVENT,
+    OHOS_CONTROL_MOTION_DETECTION_CHECK_AREA,
+    OHOS_STATUS_SLOW_MOTION_DETECTION,
+    OHOS_ABILITY_MOTION_DETECTION_SUPPORT,
+    OHOS_CONTROL_MOTION_DETECTION,
+    OHOS_ABILITY_EXPOSURE_HINT_SUPPORTED,
+    OHOS_CONTROL_EXPOSURE_HINT_MODE,
+    OHOS_STATUS_ALGO_MEAN_Y,
+    OHOS_STATUS_PREVIEW_PHYSICAL_CAMERA_ID,
+    OHOS_ABILITY_CAPTURE_EXPECT_TIME,
+    OHOS_ABILITY_EFFECT_SUGGESTION_SUPPORTED,
+    OHOS_CONTROL_EFFECT_SUGGESTION,
+    OHOS_CONTROL_EFFECT_SUGGESTION_DETECTION,
+    OHOS_CAMERA_EFFECT_SUGGESTION_TYPE,
+    OHOS_CONTROL_EFFECT_SUGGESTION_TYPE,
+    OHOS_ABILITY_NIGHT_SUB_MODES,
+    OHOS_CONTROL_NIGHT_SUB_MODE,
+    OHOS_CONTROL_GPS_COORDINATES,
+    OHOS_ABILITY_CONSTELLATION_DRAWING,
+    OHOS_CONTROL_CONSTELLATION_DRAWING_DETECT,
+    OHOS_CONTROL_CONSTELLATION_DRAWING,
+    OHOS_STATUS_CONSTELLATION_DRAWING_DETECT,
+    OHOS_ABILITY_IMAGE_STABILIZATION_GUIDE,
+    OHOS_CONTROL_IMAGE_STABILIZATION_GUIDE,
+    OHOS_STATUS_IMAGE_STABILIZATION_GUIDE,
+    OHOS_ABILITY_AVAILABLE_PROFILE_LEVEL,
+    OHOS_ABILITY_AVAILABLE_PREVIEW_PROFILE,
+    OHOS_ABILITY_AVAILABLE_PHOTO_PROFILE,
+    OHOS_ABILITY_AVAILABLE_VIDEO_PROFILE,
+    OHOS_ABILITY_AVAILABLE_METADATA_PROFILE,
+    OHOS_ABILITY_AVAILABLE_CONFIGURATIONS,
+    OHOS_ABILITY_CONFLICT_CONFIGURATIONS,
+    OHOS_ABILITY_LIGHT_PAINTING_TYPE,
+    OHOS_CONTROL_LIGHT_PAINTING_TYPE,
+    OHOS_CONTROL_LIGHT_PAINTING_FLASH,
+    OHOS_CONTROL_TIME_LAPSE_INTERVAL,
+    OHOS_CONTROL_TIME_LAPSE_TRYAE_STATE,
+    OHOS_STATUS_TIME_LAPSE_PREVIEW_TYPE,
+    OHOS_STATUS_TIME_LAPSE_TRYAE_HINT,
+    OHOS_STATUS_TIME_LAPSE_CAPTURE_INTERVAL,
+    OHOS_STATUS_TIME_LAPSE_TRYAE_DONE,
+    OHOS_CONTROL_TIME_LAPSE_RECORD_STATE,
+    OHOS_CONTROL_TIME_LAPSE_PREVIEW_TYPE,
+    OHOS_ABILITY_TIME_LAPSE_INTERVAL_RANGE,
+    OHOS_ABILITY_LCD_FLASH,
+    OHOS_CONTROL_LCD_FLASH_DETECTION,
+    OHOS_CONTROL_LCD_FLASH,
+    OHOS_STATUS_LCD_FLASH_STATUS,
+    OHOS_ABILITY_DEPTH_DATA_DELIVERY,
+    OHOS_CONTROL_DEPTH_DATA_DELIVERY_SWITCH,
+    OHOS_ABILITY_DEPTH_DATA_PROFILES,
+    OHOS_CONTROL_DEPTH_DATA_ACCURACY,
+    OHOS_ABILITY_CAMERA_IS_RETRACTABLE,
+    OHOS_CONTROL_CAMERA_CLOSE_AFTER_SECONDS,
+    OHOS_ABILITY_CAPTURE_MACRO_DEPTH_FUSION_SUPPORTED,
+    OHOS_ABILITY_CAPTURE_MACRO_DEPTH_FUSION_ZOOM_RANGE,
+    OHOS_CONTROL_CAPTURE_MACRO_DEPTH_FUSION,
+    OHOS_ABILITY_CAMERA_PORTRAIT_THEME_SUPPORTED,
+    OHOS_ABILITY_CAMERA_PORTRAIT_THEME_TYPES,
+    OHOS_CONTROL_CAMERA_PORTRAIT_THEME_TYPE,
+    OHOS_ABILITY_CAMERA_VIDEO_ROTATION_SUPPORTED,
+    OHOS_ABILITY_CAMERA_VIDEO_ROTATION,
+    OHOS_CONTROL_CAMERA_VIDEO_ROTATION,
+    OHOS_MOVING_PHOTO_BUFFER_DURATION,
+    OHOS_MOVING_PHOTO_START,
+    OHOS_MOVING_PHOTO_END,
+    OHOS_SMOOTH_ZOOM_DURATION,
+    OHOS_ABILITY_COLOR_RESERVATION_TYPES,
+    OHOS_CONTROL_COLOR_RESERVATION_TYPE,
+    OHOS_ABILITY_CONTROL_CENTER_SUPPORTED,
+    OHOS_ABILITY_CONTROL_CENTER_EFFECT_TYPE,
+    OHOS_ABILITY_IS_LOGICAL_CAMERA,
+    OHOS_ABILITY_CONSTITUENT_CAMERA_DEVICES,
+    OHOS_ABILITY_LENS_DISTORTION,
+    OHOS_ABILITY_LENS_INTRINSIC_CALIBRATION,
+    OHOS_SENSOR_INFO_COLOR_FILTER_ARRANGEMENT,
+    OHOS_ABILITY_UNSUPPORTED_MULTI_CAMERA_COMBINATIONS,
+    OHOS_ABILITY_CAMERA_MODE_SUPPORTED_STREAMS,
+    OHOS_ABILITY_IS_CAMERA_PUBLIC,
+    OHOS_ABILITY_RAW_CAPTURE_SCENE_ZOOM_CAP,
+    OHOS_CONTROL_SECURE_FACE_MODE,
+    OHOS_CONTROL_SECURE_FACE_INFO,
+    OHOS_CONTROL_SECURE_FACE_AUTH_RESULT,
+    OHOS_CONTROL_SECURE_FLASH_SEQ,
+    OHOS_CONTROL_SECURE_IR_LED_SWITCH,
+    OHOS_CONTROL_SECURE_IR_LOCKAE_SWITCH,
+    OHOS_ABILITY_SUPPORTED_COLOR_MODES,
+    OHOS_ABILITY_SCENE_SUPPORTED_COLOR_MODES,
+    OHOS_CONTROL_SUPPORTED_COLOR_MODES,
+    OHOS_ABILITY_COLOR_STYLE_AVAILABLE,
+    OHOS_ABILITY_COLOR_STYLE_DEFAULT_SETTINGS,
+    OHOS_CONTROL_COLOR_STYLE_SETTING,
+    OHOS_STATUS_COLOR_STYLE_SETTING,
+    OHOS_ABILITY_OUTPUT_COLOR_STYLE_PHOTO_TYPE,
+    OHOS_ABILITY_COLOR_TINT_RANGE,
+    OHOS_CONTROL_COLOR_TINT,
+    OHOS_CONTROL_RGBGAIN_VALUE,
+    OHOS_ABILITY_RGBGAIN_RANGE,
+    OHOS_ABILITY_SATURATION_RANGE,
+    OHOS_CONTROL_SATURATION,
+    OHOS_ABILITY_AUTO_MOTION_BOOST_DELIVERY,
+    OHOS_CONTROL_AUTO_MOTION_BOOST_DELIVERY_SWITCH,
+    OHOS_ABILITY_AUTO_BOKEH_DATA_DELIVERY,
+    OHOS_CONTROL_AUTO_BOKEH_DATA_DELIVERY_SWITCH,
+    OHOS_ABILITY_RECOMMENDED_INFO_LANGUAGE,
+    OHOS_CONTROL_RECOMMENDED_INFO_LANGUAGE,
+    OHOS_ABILITY_COMPOSITION_EFFECT_PREVIEW,
+    OHOS_CONTROL_COMPOSITION_EFFECT_PREVIEW,
+    OHOS_ABILITY_COMPOSITION_RECOMMENDED_PICTURE_SIZE,
+    OHOS_ABILITY_OPTICAL_IMAGE_STABILIZATION_MODES,
+    OHOS_CONTROL_OPTICAL_IMAGE_STABILIZATION_MODE,
+    OHOS_STATUS_OPTICAL_IMAGE_STABILIZATION_MODE,
+    OHOS_ABILITY_OPTICAL_IMAGE_STABILIZATION_BIAS_RANGE,
+    OHOS_CONTROL_SET_CUSTOM_OPTICAL_IMAGE_STABILIZATION_BIAS,
+};
+
+// Perfect hash of the item names: MetadataNameHash(0, name) picks a bucket, its seed picks the slot
+constexpr uint16_t g_metadataNameHashSeeds[] = {
+    13, 1, 9, 19, 15, 6, 5, 1, 42, 21, 6, 16,
+    61, 1, 1, 1, 104, 110, 1, 3, 11, 2, 91, 1,
+    4, 20, 23, 10, 5, 17, 2, 1, 3, 18, 8, 3,
+    15, 3, 1, 15, 62, 36, 39, 6, 2, 10, 2, 12,
+    71, 2, 2, 5, 10, 2, 74, 14, 36, 2, 56, 14,
+    6, 4, 45, 38, 35, 17, 2, 100, 4, 30, 2, 1,
+    79, 11, 1, 40, 32, 5, 3, 0, 1, 1, 23, 16,
+    1, 39, 2, 12, 18, 5, 23, 0, 14, 29, 13, 25,
+    15, 40, 30, 177, 4, 2, 108, 39, 31, 47, 90, 2,
+    43, 16,
+};
+
+constexpr metadata_item_name_t g_metadataNameHashSlots[] = {
+    {"secureFaceMode", OHOS_CONTROL_SECURE_FACE_MODE},
+    {nullptr, 0},
+    {"supportedImagingModeValues", OHOS_ABILITY_IMAGING_MODES},
+    {nullptr, 0},
+    {"flaMode", OHOS_CONTROL_FLASH_MODE},
+    {"colorFilterArrangement", OHOS_SENSOR_INFO_COLOR_FILTER_ARRANGEMENT},
+    {"activeArraySize", OHOS_SENSOR_INFO_ACTIVE_ARRAY_SIZE},
+    {"videoStabilizationMode", OHOS_CONTROL_VIDEO_STABILIZATION_MODE},
+    {"cameraType", OHOS_ABILITY_CAMERA_TYPE},
+    {"availableConfigurations", OHOS_ABILITY_AVAILABLE_CONFIGURATIONS},
+    {"abilityAeCompensationStep", OHOS_ABILITY_AE_COMPENSATION_STEP},
+    {"effectSuggestionDetection", OHOS_CONTROL_EFFECT_SUGGESTION_DETECTION},
+    {"zoomRange", OHOS_ABILITY_ZOOM_RATIO_RANGE},
+    {"cameraPhysicalApertureControlValue", OHOS_CONTROL_CAMERA_PHYSICAL_APERTURE_VALUE},
+    {"fallProtection", OHOS_CONTROL_FALL_PROTECTION},
+    {"lensIntrinsicCalibration", OHOS_ABILITY_LENS_INTRINSIC_CALIBRATION},
+    {"cameraAutoFramingEnable", OHOS_CONTROL_AUTO_FRAMING_ENABLE},
+    {"aeAvailableTargetFpsRanges", OHOS_CONTROL_AE_AVAILABLE_TARGET_FPS_RANGES},
+    {"supportedPhotoQualityPrioritizationValues", OHOS_ABILITY_PHOTO_QUALITY_PRIORITIZATION},
+    {"tripodDetectionStatus", OHOS_STATUS_TRIPOD_DETECTION_STATUS},
+    {"nightModeTryAe", OHOS_CONTROL_NIGHT_MODE_TRY_AE},
+    {"superSlowMotionStatus", OHOS_STATUS_SLOW_MOTION_DETECTION},
+    {"availableColorSpaces", OHOS_ABILITY_AVAILABLE_COLOR_SPACES},
+    {"fpsRange", OHOS_CONTROL_FPS_RANGES},
+    {"aeAvailableModes", OHOS_CONTROL_AE_AVAILABLE_MODES},
+    {"compressionQuality", OHOS_PHOTO_COMPRESSION_QUALITY},
+    {nullptr, 0},
+    {"aeAntibandingMode", OHOS_CONTROL_AE_ANTIBANDING_MODE},
+    {"bandwidthCompressionAvailable", OHOS_ABILITY_BANDWIDTH_COMPRESSION_AVAILABLE},
+    {"exMode", OHOS_CONTROL_EXPOSURE_MODE},
+    {nullptr, 0},
+    {"lockObjectTrackingAvailable", OHOS_ABILITY_LOCK_OBJECT_TRACKING_AVAILABLE},
+    {"cameraSpectrumInfo", OHOS_ABILITY_SPECTRUM_INFOS},
+    {nullptr, 0},
+    {"statusImageStabilizationGuide", OHOS_STATUS_IMAGE_STABILIZATION_GUIDE},
+    {"constituentCameraDevices", OHOS_ABILITY_CONSTITUENT_CAMERA_DEVICES},
+    {"headShrinkValue", OHOS_CONTROL_BEAUTY_HEAD_SHRINK_VALUE},
+    {"trustedSignatureSupportModes", OHOS_ABILITY_C2PA_SIGNATURE},
+    {nullptr, 0},
+    {"prelaunchAvailable", OHOS_ABILITY_PRELAUNCH_AVAILABLE},
+    {"abilityAeCompensationRange", OHOS_ABILITY_AE_COMPENSATION_RANGE},
+    {"sunBlockHint", OHOS_STATUS_SUN_BLOCK_HINT},
+    {"supportedSensorWbValues", OHOS_ABILITY_SENSOR_WB_VALUES},
+    {"timeLapseRecordState", OHOS_CONTROL_TIME_LAPSE_RECORD_STATE},
+    {"currentStatusZoomRatio", OHOS_STATUS_CAMERA_CURRENT_ZOOM_RATIO},
+    {"zoomRatioRange", OHOS_STATUS_CAMERA_CURRENT_ZOOM_RATIO_RANGE},
+    {nullptr, 0},
+    {nullptr, 0},
+    {"supportedGenerateOriginalImage", OHOS_ABILITY_GENERATE_ORIGINAL_IMAGE},
+    {"colorStyleDefaultSettings", OHOS_ABILITY_COLOR_STYLE_DEFAULT_SETTINGS},
+    {"streamAvailableFormats", OHOS_STREAM_AVAILABLE_FORMATS},
+    {nullptr, 0},
+    {nullptr, 0},
+    {"awbMode", OHOS_CONTROL_AWB_MODE},
+    {"previewPhysicalCameraId", OHOS_STATUS_PREVIEW_PHYSICAL_CAMERA_ID},
+    {"focusDrivenType", OHOS_CONTROL_FOCUS_DRIVEN_TYPE},
+    {"availableFaceMakeUpValues", OHOS_ABILITY_BEAUTY_FACE_MAKEUP_VALUES},
+    {"highQualityMode", OHOS_CONTROL_HIGH_QUALITY_MODE},
+    {"captureMacroDepthFusionSupported", OHOS_ABILITY_CAPTURE_MACRO_DEPTH_FUSION_SUPPORTED},
+    {"afTrigger", OHOS_CONTROL_AF_TRIGGER},
+    {"controlAutoMotionBoostDelivery", OHOS_CONTROL_AUTO_MOTION_BOOST_DELIVERY_SWITCH},
+    {"focusDrivenTypes", OHOS_ABILITY_FOCUS_DRIVEN_TYPES},
+    {"focusTrackingRegion", OHOS_ABILITY_FOCUS_TRACKING_REGION},
+    {"jpegOrientation", OHOS_JPEG_ORIENTATION},
+    {"isCameraPublic", OHOS_ABILITY_IS_CAMERA_PUBLIC},
+    {"availableMetadataProfile", OHOS_ABILITY_AVAILABLE_METADATA_PROFILE},
+    {nullptr, 0},
+    {nullptr, 0},
+    {"recommendedInfoLanguageSupported", OHOS_ABILITY_RECOMMENDED_INFO_LANGUAGE},
+    {"abilityAWBLock", OHOS_ABILITY_AWB_LOCK},
+    {"focusRangeType", OHOS_CONTROL_FOCUS_RANGE_TYPE},
+    {"timeLapseInterval", OHOS_CONTROL_TIME_LAPSE_INTERVAL},
+    {"focusSupportiveModes", OHOS_ABILITY_FOCUS_MODES},
+    {"filterType", OHOS_CONTROL_FILTER_TYPE},
+    {"controlLightPaintingType", OHOS_CONTROL_LIGHT_PAINTING_TYPE},
+    {"qualityPrioritization", OHOS_CONTROL_QUALITY_PRIORITIZATION},
+    {nullptr, 0},
+    {"sketchReferenceFovRatio", OHOS_ABILITY_SKETCH_REFERENCE_FOV_RATIO},
+    {"tripodDetection", OHOS_ABILITY_TRIPOD_DETECTION},
+    {"detectSalientInfos", OHOS_STATISTICS_DETECT_SALIENT_INFOS},
+    {"muteAvailableModes", OHOS_ABILITY_MUTE_MODES},
+    {nullptr, 0},
+    {"movingPhotoStart", OHOS_MOVING_PHOTO_START},
+    {"currentIsoValues", OHOS_STATUS_ISO_VALUE},
+    {"generateOriginalImage", OHOS_CONTROL_GENERATE_ORIGINAL_IMAGE},
+    {"exposureTime", OHOS_SENSOR_EXPOSURE_TIME},
+    {nullptr, 0},
+    {"supportedPreviewQualityPrioritizationValues", OHOS_ABILITY_CAMERA_PREVIEW_QUALITY_PRIORITIZATION},
+    {"controlAutoBokehDataDelivery", OHOS_CONTROL_AUTO_BOKEH_DATA_DELIVERY_SWITCH},
+    {"sensorWbValue", OHOS_CONTROL_SENSOR_WB_VALUE},
+    {"supportedExernalCameraLensBoost", OHOS_ABILITY_EXTERNAL_CAMERA_LENS_BOOST},
+    {"sensorExposureTime", OHOS_CONTROL_SENSOR_EXPOSURE_TIME},
+    {"lightPaintingType", OHOS_ABILITY_LIGHT_PAINTING_TYPE},
+    {"controlZoomRatios", OHOS_CONTROL_SMOOTH_ZOOM_RATIOS},
+    {"detectHumanFaceInfos", OHOS_STATISTICS_DETECT_HUMAN_FACE_INFOS},
+    {"cameraConcurrentSupportedCameras", OHOS_ABILITY_CONCURRENT_SUPPORTED_CAMERAS},
+    {nullptr, 0},
+    {"detectBarCodeInfos", OHOS_STATISTICS_DETECT_BAR_CODE_INFOS},
+    {"controlLowLightBoost", OHOS_CONTROL_LOW_LIGHT_DETECT},
+    {"prerecordMode", OHOS_CONTROL_PRERECORD_MODE},
+    {"statisticsDetectSetting", OHOS_CONTROL_STATISTICS_DETECT_SETTING},
+    {"compositionEffectPreview", OHOS_CONTROL_COMPOSITION_EFFECT_PREVIEW},
+    {"cameraMesureExposureTime", OHOS_CAMERA_MESURE_EXPOSURE_TIME},
+    {nullptr, 0},
+    {"sceneFlashSupportiveModes", OHOS_ABILITY_SCENE_FLASH_MODES},
+    {"streamQuickThumbnailAvailable", OHOS_ABILITY_STREAM_QUICK_THUMBNAIL_AVAILABLE},
+    {"controlTimeLapsePreviewType", OHOS_CONTROL_TIME_LAPSE_PREVIEW_TYPE},
+    {"sensorOrientationVariable", OHOS_ABILITY_SENSOR_ORIENTATION_VARIABLE},
+    {"quality", OHOS_JPEG_QUALITY},
+    {"faceSlenderValue", OHOS_CONTROL_BEAUTY_FACE_SLENDER_VALUE},
+    {"cameraAbilityMovingPhoto", OHOS_ABILITY_MOVING_PHOTO},
+    {"controlCenterEffectType", OHOS_ABILITY_CONTROL_CENTER_EFFECT_TYPE},
+    {nullptr, 0},
+    {"colorCorrectuonGain", OHOS_SENSOR_COLOR_CORRECTION_GAINS},
+    {"portraitType", OHOS_CONTROL_PORTRAIT_EFFECT_TYPE},
+    {"captureMacroDepthFussionZoomRange", OHOS_ABILITY_CAPTURE_MACRO_DEPTH_FUSION_ZOOM_RANGE},
+    {"offlineSupportedValue", OHOS_ABILITY_CHANGETO_OFFLINE_STREAM_OPEATOR},
+    {"compositionBegin", OHOS_COMPOSITION_BEGIN},
+    {nullptr, 0},
+    {"controlAutoDeferredVideoEnhance", OHOS_CONTROL_AUTO_DEFERRED_VIDEO_ENHANCE},
+    {"autoBeautyValue", OHOS_CONTROL_BEAUTY_AUTO_VALUE},
+    {"commonPublishedFeatures", OHOS_ABILITY_COMMON_PUBLISHED_FEATURES},
+    {nullptr, 0},
+    {"sceneAvailableFilterTypes", OHOS_ABILITY_SCENE_FILTER_TYPES},
+    {"flashstate", OHOS_CONTROL_FLASH_STATE},
+    {"controlAutoExtendedGainmapDelivery", OHOS_CONTROL_AUTO_EXTENDED_GAINMAP_DELIVERY},
+    {"photoStitchingHint", OHOS_STATUS_PHOTO_STITCHING_HINT},
+    {"statisticsDetectType", OHOS_ABILITY_STATISTICS_DETECT_TYPE},
+    {"captureDurationSupported", OHOS_ABILITY_CAPTURE_DURATION_SUPPORTED},
+    {"lensEquivalentFocus", OHOS_ABILITY_LENS_EQUIVALENT_FOCUS},
+    {"logAssistanceEnable", OHOS_CONTROL_LOG_ASSISTANCE},
+    {"cameraSwitchInfo", OHOS_CONTROL_CAMERA_SWITCH_INFOS},
+    {"availableThumbnailSizes", OHOS_JPEG_AVAILABLE_THUMBNAIL_SIZES},
+    {nullptr, 0},
+    {"maxSize", OHOS_JPEG_MAX_SIZE},
+    {nullptr, 0},
+    {"timeLapseIntervalRange", OHOS_ABILITY_TIME_LAPSE_INTERVAL_RANGE},
+    {"awbLock", OHOS_CONTROL_AWB_LOCK},
+    {nullptr, 0},
+    {"photoStitchingAngle", OHOS_STATUS_PHOTO_STITCHING_ANGLE},
+    {"controlLightPaintingFlash", OHOS_CONTROL_LIGHT_PAINTING_FLASH},
+    {"detectCatBodyInfos", OHOS_STATISTICS_DETECT_CAT_BODY_INFOS},
+    {"saturationValue", OHOS_CONTROL_SATURATION},
+    {"cinemaVideoKeyFrameType", OHOS_CINEMA_VIDEO_KEY_FRAME_TYPE},
+    {"gpsProcessingMethod", OHOS_JPEG_GPS_PROCESSING_METHOD},
+    {"eyeBigEyesValue", OHOS_CONTROL_BEAUTY_EYE_BIGEYES_VALUE},
+    {"photoQualityPrioritization", OHOS_CONTROL_PHOTO_QUALITY_PRIORITIZATION},
+    {nullptr, 0},
+    {"awbRegions", OHOS_CONTROL_AWB_REGIONS},
+    {"movingPhoto", OHOS_CONTROL_MOVING_PHOTO},
+    {"cameraConcurrentType", OHOS_ABILITY_CAMERA_CONCURRENT_TYPE},
+    {nullptr, 0},
+    {"cameraStatusOcclusionDetection", OHOS_STATUS_CAMERA_OCCLUSION_DETECTION},
+    {"modeSupportedstreams", OHOS_ABILITY_CAMERA_MODE_SUPPORTED_STREAMS},
+    {"cameraFoldStatus", OHOS_ABILITY_CAMERA_FOLD_STATUS},
+    {"ejectRetry", OHOS_CONTROL_EJECT_RETRY},
+    {"sunBlockPreviewType", OHOS_CONTROL_SUN_BLOCK_PREVIEW_TYPE},
+    {"colorStyleSettingStatus", OHOS_STATUS_COLOR_STYLE_SETTING},
+    {"skinSmoothValue", OHOS_CONTROL_BEAUTY_SKIN_SMOOTH_VALUE},
+    {nullptr, 0},
+    {"zoomCap", OHOS_ABILITY_ZOOM_CAP},
+    {"compositionPositionCalibration", OHOS_COMPOSITION_POSITION_CALIBRATION},
+    {"zoomRatio", OHOS_CONTROL_ZOOM_RATIO},
+    {"focusTrackingModes", OHOS_ABILITY_FOCUS_TRACKING_MODES},
+    {"availableEyeBigEyesValues", OHOS_ABILITY_BEAUTY_EYE_BIGEYES_VALUES},
+    {"previewQualityPrioritization", OHOS_CONTROL_CAMERA_PREVIEW_QUALITY_PRIORITIZATION},
+    {"controlPreZoom", OHOS_CONTROL_PREPARE_ZOOM},
+    {"faceDetectSwitch", OHOS_STATISTICS_FACE_DETECT_SWITCH},
+    {"lcdFlash", OHOS_ABILITY_LCD_FLASH},
+    {"zoomCenterPoint", OHOS_CONTROL_ZOOM_CENTER_POINT},
+    {"availableSkinToneValues", OHOS_ABILITY_BEAUTY_SKIN_TONE_VALUES},
+    {"focusMode", OHOS_CONTROL_FOCUSMODE},
+    {"compositionEffectPreviewSupported", OHOS_ABILITY_COMPOSITION_EFFECT_PREVIEW},
+    {"currentCameraApertureValue", OHOS_STATUS_CAMERA_APERTURE_VALUE},
+    {"effectSuggestionType", OHOS_CAMERA_EFFECT_SUGGESTION_TYPE},
+    {"sceneAvailablePotraitTypes", OHOS_ABILITY_SCENE_PORTRAIT_EFFECT_TYPES},
+    {nullptr, 0},
+    {"sketchInfoNotification", OHOS_ABILITY_SKETCH_INFO_NOTIFICATION},
+    {"photoStitchingCaptureState", OHOS_STATUS_PHOTO_STITCHING_CAPTURE_STATE},
+    {nullptr, 0},
+    {"unsupportedMultiCameraCombinations", OHOS_ABILITY_UNSUPPORTED_MULTI_CAMERA_COMBINATIONS},
+    {"skinToneValue", OHOS_CONTROL_BEAUTY_SKIN_TONE_VALUE},
+    {"streamAutoFpsControl", OHOS_CONTROL_AUTO_VIDEO_FRAME_RATE},
+    {"faceRectangles", OHOS_STATISTICS_FACE_RECTANGLES},
+    {"controlAutoAigcPhoto", OHOS_CONTROL_AUTO_AIGC_PHOTO},
+    {"sketchPoint", OHOS_STATUS_SKETCH_POINT},
+    {"meterPoint", OHOS_CONTROL_METER_POINT},
+    {"beautyType", OHOS_CONTROL_BEAUTY_TYPE},
+    {"algoMeanY", OHOS_STATUS_ALGO_MEAN_Y},
+    {"aeCompensationRange", OHOS_CONTROL_AE_COMPENSATION_RANGE},
+    {"controlEffectSuggestionType", OHOS_CONTROL_EFFECT_SUGGESTION_TYPE},
+    {"isPortraitThemeTypesSupported", OHOS_ABILITY_CAMERA_PORTRAIT_THEME_SUPPORTED},
+    {"depthDataAccuracy", OHOS_CONTROL_DEPTH_DATA_ACCURACY},
+    {"timeLapseCaptureInterval", OHOS_STATUS_TIME_LAPSE_CAPTURE_INTERVAL},
+    {"focusTrackingMode", OHOS_CONTROL_FOCUS_TRACKING_MODE},
+    {"compositionSuggestPictureSizes", OHOS_ABILITY_COMPOSITION_RECOMMENDED_PICTURE_SIZE},
+    {"cameraLensDirtyDetection", OHOS_STATUS_CAMERA_LENS_DIRTY_DETECTION},
+    {"awbgainValues", OHOS_CONTROL_RGBGAIN_VALUE},
+    {nullptr, 0},
+    {"photoStitchingType", OHOS_CONTROL_PHOTO_STITCHING_TYPE},
+    {"aeCompensationStep", OHOS_CONTROL_AE_COMPENSATION_STEP},
+    {"focusedPoint", OHOS_CONTROL_FOCUSED_POINT},
+    {"currentFps", OHOS_STATUS_CAMERA_CURRENT_FPS},
+    {"cameraPosition", OHOS_ABILITY_CAMERA_POSITION},
+    {"availableSkinSmoothValues", OHOS_ABILITY_BEAUTY_SKIN_SMOOTH_VALUES},
+    {"hairHairlineValue", OHOS_CONTROL_BEAUTY_HAIR_HAIRLINE_VALUE},
+    {"awbgainRange", OHOS_ABILITY_RGBGAIN_RANGE},
+    {"exposureHintMode", OHOS_CONTROL_EXPOSURE_HINT_MODE},
+    {nullptr, 0},
+    {"detectCatFaceInfos", OHOS_STATISTICS_DETECT_CAT_FACE_INFOS},
+    {"foldStateSensorOrientationMap", OHOS_FOLD_STATE_SENSOR_ORIENTATION_MAP},
+    {"streamId", OHOS_CAMERA_STREAM_ID},
+    {"motionDetectionSupportValue", OHOS_ABILITY_MOTION_DETECTION_SUPPORT},
+    {"conflictConfigurations", OHOS_ABILITY_CONFLICT_CONFIGURATIONS},
+    {"customVideoFps", OHOS_ABILITY_CUSTOM_VIDEO_FPS},
+    {"gpsCoordinates", OHOS_JPEG_GPS_COORDINATES},
+    {"gpsTimestamp", OHOS_JPEG_GPS_TIMESTAMP},
+    {"detectDogBodyInfos", OHOS_STATISTICS_DETECT_DOG_BODY_INFOS},
+    {"tripodStablitation", OHOS_CONTROL_TRIPOD_STABLITATION},
+    {"irLedSwitch", OHOS_CONTROL_SECURE_IR_LED_SWITCH},
+    {"focusAvailablesModes", OHOS_ABILITY_DEVICE_AVAILABLE_FOCUSMODES},
+    {"thumbnailQuality", OHOS_JPEG_THUMBNAIL_QUALITY},
+    {"abilityImageStabilizationGuide", OHOS_ABILITY_IMAGE_STABILIZATION_GUIDE},
+    {"detectHumanBodyInfos", OHOS_STATISTICS_DETECT_HUMAN_BODY_INFOS},
+    {nullptr, 0},
+    {"supportedColorTintValues", OHOS_ABILITY_COLOR_TINT_RANGE},
+    {nullptr, 0},
+    {"depthDataDelivery", OHOS_ABILITY_DEPTH_DATA_DELIVERY},
+    {"focalLength", OHOS_ABILITY_FOCAL_LENGTH},
+    {"sketchStreamInfo", OHOS_STATUS_SKETCH_STREAM_INFO},
+    {nullptr, 0},
+    {"statusConstellationDrawingState", OHOS_CAMERA_CONSTELLATION_DRAWING_STATE},
+    {"cameraVirtualApertureControlValue", OHOS_CONTROL_CAMERA_VIRTUAL_APERTURE_VALUE},
+    {"lensInfoMinimumFocusDistance", OHOS_ABILITY_LENS_INFO_MINIMUM_FOCUS_DISTANCE},
+    {"cameraUsedAsPosition", OHOS_CONTROL_CAMERA_USED_AS_POSITION},
+    {"macroStatusValue", OHOS_CAMERA_MACRO_STATUS},
+    {"focusAssistFlashSupportedModes", OHOS_ABILITY_FOCUS_ASSIST_FLASH_SUPPORTED_MODES},
+    {"streamSupplementaryInfo", OHOS_STREAM_SUPPLEMENTARY_INFO},
+    {"supportedNightSubModes", OHOS_ABILITY_NIGHT_SUB_MODES},
+    {"zoomCenterPointSupported", OHOS_ABILITY_ZOOM_CENTER_POINT_SUPPORTED},
+    {"muteMode", OHOS_CONTROL_MUTE_MODE},
+    {"flashAvailablesModes", OHOS_ABILITY_DEVICE_AVAILABLE_FLASHMODES},
+    {"aeLock", OHOS_CONTROL_AE_LOCK},
+    {"sensitivityRange", OHOS_SENSOR_INFO_SENSITIVITY_RANGE},
+    {nullptr, 0},
+    {"opticalImageStabilizationMode", OHOS_CONTROL_OPTICAL_IMAGE_STABILIZATION_MODE},
+    {"trustedSignatureMode", OHOS_CONTROL_C2PA_SIGNATURE},
+    {nullptr, 0},
+    {nullptr, 0},
+    {"effectSuggestion", OHOS_CONTROL_EFFECT_SUGGESTION},
+    {"sceneExposureSupportiveModes", OHOS_ABILITY_SCENE_EXPOSURE_MODES},
+    {"thumbnailSize", OHOS_JPEG_THUMBNAIL_SIZE},
+    {"typicalSceneZoomPoints", OHOS_ABILITY_TYPICAL_SCENE_ZOOM_POINTS},
+    {"depthDataProfiles", OHOS_ABILITY_DEPTH_DATA_PROFILES},
+    {"controlImageStabilizationGuide", OHOS_CONTROL_IMAGE_STABILIZATION_GUIDE},
+    {"fovInfos", OHOS_STATUS_FOV_INFOS},
+    {"flashSupportiveModes", OHOS_ABILITY_FLASH_MODES},
+    {"colorReservationTypes", OHOS_ABILITY_COLOR_RESERVATION_TYPES},
+    {"availableNoseSlenderValues", OHOS_ABILITY_BEAUTY_NOSE_SLENDER_VALUES},
+    {"availableCameraModes", OHOS_ABILITY_CAMERA_MODES},
+    {"aeTargetFpsRange", OHOS_CONTROL_AE_TARGET_FPS_RANGE},
+    {"controlConstellationDrawing", OHOS_CONTROL_CONSTELLATION_DRAWING},
+    {"nightModeSupportedExposureTime", OHOS_ABILITY_NIGHT_MODE_SUPPORTED_EXPOSURE_TIME},
+    {"detectHumanHeadInfos", OHOS_STATISTICS_DETECT_HUMAN_HEAD_INFOS},
+    {"zoomBezierCurvePoint", OHOS_ABILITY_CAMERA_ZOOM_BEZIER_CURVC_POINT},
+    {"meterAvailableModes", OHOS_ABILITY_METER_MODES},
+    {"delayAlloc", OHOS_CONTROL_DELAY_ALLOC},
+    {"protectionState", OHOS_DEVICE_PROTECTION_STATE},
+    {"manualExposureTime", OHOS_CONTROL_MANUAL_EXPOSURE_TIME},
+    {"timeLapseTryaeHint", OHOS_STATUS_TIME_LAPSE_TRYAE_HINT},
+    {"faceDetectMaxNum", OHOS_STATISTICS_FACE_DETECT_MAX_NUM},
+    {nullptr, 0},
+    {"autoBokehDataDelivery", OHOS_ABILITY_AUTO_BOKEH_DATA_DELIVERY},
+    {"halRotateAngle", OHOS_CONTROL_ROTATE_ANGLE},
+    {"colorReservationType", OHOS_CONTROL_COLOR_RESERVATION_TYPE},
+    {"exernalCameraLensBoost", OHOS_CONTROL_EXTERNAL_CAMERA_LENS_BOOST},
+    {"meterMode", OHOS_CONTROL_METER_MODE},
+    {"controlCenterSupported", OHOS_ABILITY_CONTROL_CENTER_SUPPORTED},
+    {"zoomPerformance", OHOS_ABILITY_CAMERA_ZOOM_PERFORMANCE},
+    {"fpsAvailableRanges", OHOS_ABILITY_FPS_RANGES},
+    {"pixelArraySize", OHOS_SENSOR_INFO_PIXEL_ARRAY_SIZE},
+    {"afRegions", OHOS_CONTROL_AF_REGIONS},
+    {"statusZoomPerformance", OHOS_STATUS_CAMERA_ZOOM_PERFORMANCE},
+    {"controlAutoCloudImageEnhance", OHOS_CONTROL_AUTO_CLOUD_IMAGE_ENHANCE},
+    {"aeExposureCompensation", OHOS_CONTROL_AE_EXPOSURE_COMPENSATION},
+    {nullptr, 0},
+    {"currentSensorExposureTime", OHOS_STATUS_SENSOR_EXPOSURE_TIME},
+    {"controlGpsCoordinates", OHOS_CONTROL_GPS_COORDINATES},
+    {"photoStitchingMovingClockwise", OHOS_CONTROL_PHOTO_STITCHING_MOVING_CLOCKWISE},
+    {"controlTripodDetection", OHOS_CONTROL_TRIPOD_DETECTION},
+    {"availablePhotoProfile", OHOS_ABILITY_AVAILABLE_PHOTO_PROFILE},
+    {"cameraMemoryType", OHOS_ABILITY_MEMORY_TYPE},
+    {"colorStyleSetting", OHOS_CONTROL_COLOR_STYLE_SETTING},
+    {"controlConstellationDrawingDetect", OHOS_CONTROL_CONSTELLATION_DRAWING_DETECT},
+    {"cameraStatusFlashSuggestion", OHOS_STATUS_FLASH_SUGGESTION},
+    {"offlineControlValue", OHOS_CONTROL_CHANGETO_OFFLINE_STREAM_OPEATOR},
+    {"customSnapshotDuration", OHOS_CAMERA_CUSTOM_SNAPSHOT_DURATION},
+    {"cameraVirtualApertureRange", OHOS_ABILITY_CAMERA_VIRTUAL_APERTURE_RANGE},
+    {"focusTrackingMech", OHOS_CONTROL_FOCUS_TRACKING_MECH},
+    {"cameraControlFlashSuggestionSwitch", OHOS_CONTROL_FLASH_SUGGESTION_SWITCH},
+    {"supportedVideoRotation", OHOS_ABILITY_CAMERA_VIDEO_ROTATION},
+    {"smoothZoomDuration", OHOS_SMOOTH_ZOOM_DURATION},
+    {"sketchEnableRatio", OHOS_ABILITY_SKETCH_ENABLE_RATIO},
+    {"motionDetectionControlValue", OHOS_CONTROL_MOTION_DETECTION},
+    {"aeRegions", OHOS_CONTROL_AE_REGIONS},
+    {nullptr, 0},
+    {"faceScores", OHOS_STATISTICS_FACE_SCORES},
+    {"cameraControlSystemCapture", OHOS_CONTROL_CAPTURE_ROTATION},
+    {nullptr, 0},
+    {"availableFaceSlenderValues", OHOS_ABILITY_BEAUTY_FACE_SLENDER_VALUES},
+    {nullptr, 0},
+    {"automotiveCameraSensorType", OHOS_ABILITY_AUTOMOTIVE_CAMERA_SENSOR_TYPE},
+    {"captureExpectTime", OHOS_ABILITY_CAPTURE_EXPECT_TIME},
+    {"cameraAbilityMoonCaptureBoost", OHOS_ABILITY_MOON_CAPTURE_BOOST},
+    {nullptr, 0},
+    {"opticalImageStabilizationSupportedModes", OHOS_ABILITY_OPTICAL_IMAGE_STABILIZATION_MODES},
+    {nullptr, 0},
+    {"afTriggerId", OHOS_CONTROL_AF_TRIGGER_ID},
+    {"captureMacroDepthFusion", OHOS_CONTROL_CAPTURE_MACRO_DEPTH_FUSION},
+    {"irLockaeSwitch", OHOS_CONTROL_SECURE_IR_LOCKAE_SWITCH},
+    {"flashMode", OHOS_CONTROL_FLASHMODE},
+    {"compositionMatched", OHOS_COMPOSITION_MATCHED},
+    {"sunBlockPreviewTypes", OHOS_ABILITY_SUN_BLOCK_PREVIEW_TYPES},
+    {"cameraFoldscreenType", OHOS_ABILITY_CAMERA_FOLDSCREEN_TYPE},
+    {"sunBlockBlendColor", OHOS_CONTROL_SUN_BLOCK_BLEND_COLOR},
+    {"cameraStatusMoonCaptureDetection", OHOS_STATUS_MOON_CAPTURE_DETECTION},
+    {"currentCameraApertureEffect", OHOS_STATUS_CAMERA_CURRENT_APERTURE_EFFECT},
+    {"cameraCloseAfterSeconds", OHOS_CONTROL_CAMERA_CLOSE_AFTER_SECONDS},
+    {nullptr, 0},
+    {"sceneMacroCap", OHOS_ABILITY_SCENE_MACRO_CAP},
+    {"streamExtendConfigurations", OHOS_ABILITY_STREAM_AVAILABLE_EXTEND_CONFIGURATIONS},
+    {"sensorExposureTimeRange", OHOS_ABILITY_SENSOR_EXPOSURE_TIME_RANGE},
+    {"secureFlashSeq", OHOS_CONTROL_SECURE_FLASH_SEQ},
+    {nullptr, 0},
+    {nullptr, 0},
+    {"supportedPortraitThemeTypes", OHOS_ABILITY_CAMERA_PORTRAIT_THEME_TYPES},
+    {"rawZoomCap", OHOS_ABILITY_RAW_CAPTURE_SCENE_ZOOM_CAP},
+    {"controlTargetZoomRatios", OHOS_CONTROL_CAMERA_TARGET_ZOOM_RATIO},
+    {"colorStyleAvailable", OHOS_ABILITY_COLOR_STYLE_AVAILABLE},
+    {nullptr, 0},
+    {"deferredImageDeliveryMode", OHOS_CONTROL_DEFERRED_IMAGE_DELIVERY},
+    {"photoStitchingPosition", OHOS_STATUS_PHOTO_STITCHING_POSITION},
+    {"lowLightDetection", OHOS_STATUS_LOW_LIGHT_DETECTION},
+    {"skinToneBrightValue", OHOS_CONTROL_BEAUTY_SKIN_TONEBRIGHT_VALUE},
+    {"supportedSaturationValues", OHOS_ABILITY_SATURATION_RANGE},
+    {"depthDataDeliverySwitch", OHOS_CONTROL_DEPTH_DATA_DELIVERY_SWITCH},
+    {"faceAuthResult", OHOS_CONTROL_SECURE_FACE_AUTH_RESULT},
+    {"foldStateAndNaturalDirectionSensorOrientationMap", OHOS_FOLD_STATE_AND_NATURAL_DIRECTION_SENSOR_ORIENTATION_MAP},
+    {"availableVideoProfile", OHOS_ABILITY_AVAILABLE_VIDEO_PROFILE},
+    {"videoDebugSwitch", OHOS_CONTROL_VIDEO_DEBUG_SWITCH},
+    {"exitCameraEvent", OHOS_DEVICE_EXITCAMERA_EVENT},
+    {"lcdFlashDetection", OHOS_CONTROL_LCD_FLASH_DETECTION},
+    {nullptr, 0},
+    {"abilityConstellationDrawing", OHOS_ABILITY_CONSTELLATION_DRAWING},
+    {"faceLandmarks", OHOS_STATISTICS_FACE_LANDMARKS},
+    {"lensFocusDistance", OHOS_CONTROL_LENS_FOCUS_DISTANCE},
+    {nullptr, 0},
+    {"exposureSupportiveModes", OHOS_ABILITY_EXPOSURE_MODES},
+    {"lensDistortion", OHOS_ABILITY_LENS_DISTORTION},
+    {"sceneXmageSupportMode", OHOS_ABILITY_SCENE_SUPPORTED_COLOR_MODES},
+    {"movingPhotoBufferDuration", OHOS_MOVING_PHOTO_BUFFER_DURATION},
+    {"sensorOutputTimeStamp", OHOS_SENSOR_INFO_TIMESTAMP},
+    {"streamAvailableConfigurations", OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS},
+    {"cameraConnectionType", OHOS_ABILITY_CAMERA_CONNECTION_TYPE},
+    {"aeAvailableAntibandingModes", OHOS_CONTROL_AE_AVAILABLE_ANTIBANDING_MODES},
+    {"opticalImageStabilizationModeStatus", OHOS_STATUS_OPTICAL_IMAGE_STABILIZATION_MODE},
+    {nullptr, 0},
+    {"focusRangeTypes", OHOS_ABILITY_FOCUS_RANGE_TYPES},
+    {"autoCloudImageEnhance", OHOS_ABILITY_AUTO_CLOUD_IMAGE_ENHANCE},
+    {"cameraPhysicalApertureRange", OHOS_ABILITY_CAMERA_PHYSICAL_APERTURE_RANGE},
+    {"focusTrackingObjectId", OHOS_CONTROL_FOCUS_TRACKING_OBJECT_ID},
+    {nullptr, 0},
+    {"equivalentFocus", OHOS_ABILITY_EQUIVALENT_FOCUS},
+    {"sunBlockBlendColors", OHOS_ABILITY_SUN_BLOCK_BLEND_COLORS},
+    {"afMode", OHOS_CONTROL_AF_MODE},
+    {"opticalImageStabilizationBias", OHOS_CONTROL_SET_CUSTOM_OPTICAL_IMAGE_STABILIZATION_BIAS},
+    {"lowLightBoost", OHOS_ABILITY_LOW_LIGHT_BOOST},
+    {"macroStatusControlValue", OHOS_CONTROL_CAMERA_MACRO},
+    {"noseSlenderValue", OHOS_CONTROL_BEAUTY_NOSE_SLENDER_VALUE},
+    {"aeMode", OHOS_CONTROL_AE_MODE},
+    {"sceneAvailableBeautyTypes", OHOS_ABILITY_SCENE_BEAUTY_TYPES},
+    {nullptr, 0},
+    {"tofSensorAbnormal", OHOS_STATUS_TOF_SENSOR_ABNORMAL},
+    {"focusTrackingMechAvailable", OHOS_ABILITY_FOCUS_TRACKING_MECH_AVAILABLE},
+    {"autoMotionBoostDelivery", OHOS_ABILITY_AUTO_MOTION_BOOST_DELIVERY},
+    {"availableExtendedStreamInfoTypes", OHOS_ABILITY_AVAILABLE_EXTENDED_STREAM_INFO_TYPES},
+    {nullptr, 0},
+    {"controlLcdFlash", OHOS_CONTROL_LCD_FLASH},
+    {"logAssistanceSuppported", OHOS_ABILITY_LOG_ASSISTANCE_SUPPORTED},
+    {"timeLapseTryaeDone", OHOS_STATUS_TIME_LAPSE_TRYAE_DONE},
+    {nullptr, 0},
+    {"opticalImageStabilizationSupportedBiasRange", OHOS_ABILITY_OPTICAL_IMAGE_STABILIZATION_BIAS_RANGE},
+    {nullptr, 0},
+    {"sunBlockRgbCropRegion", OHOS_ABILITY_SUN_BLOCK_RGB_CROP_REGION},
+    {"colorTintValue", OHOS_CONTROL_COLOR_TINT},
+    {nullptr, 0},
+    {"isVideoRotationSupported", OHOS_ABILITY_CAMERA_VIDEO_ROTATION_SUPPORTED},
+    {nullptr, 0},
+    {"supportedIsoValues", OHOS_ABILITY_ISO_VALUES},
+    {nullptr, 0},
+    {"timeLapseTryaeState", OHOS_CONTROL_TIME_LAPSE_TRYAE_STATE},
+    {"fMode", OHOS_CONTROL_FOCUS_MODE},
+    {"cameraControlBurstCapture", OHOS_CONTROL_BURST_CAPTURE},
+    {nullptr, 0},
+    {"videoAvailableStabilizationModes", OHOS_ABILITY_VIDEO_STABILIZATION_MODES},
+    {"faceMakeUpValue", OHOS_CONTROL_BEAUTY_FACE_MAKEUP_VALUE},
+    {"cameraSpectrumAvailable", OHOS_ABILITY_SPECTRUM_SUPPORTED},
+    {"cameraControlMoonCaptureBoost", OHOS_CONTROL_MOON_CAPTURE_BOOST},
+    {"cameraAppHint", OHOS_CONTROL_APP_HINT},
+    {"lcdFlashStatus", OHOS_STATUS_LCD_FLASH_STATUS},
+    {"exposureAvailableModes", OHOS_ABILITY_DEVICE_AVAILABLE_EXPOSUREMODES},
+    {nullptr, 0},
+    {"rotationInIpsSupported", OHOS_ABILITY_ROTATION_IN_IPS_SUPPORTED},
+    {"cameraLightStatusSupported", OHOS_ABILITY_LIGHT_STATUS},
+    {"awbAvailableModes", OHOS_CONTROL_AWB_AVAILABLE_MODES},
+    {"cameraExposureModePreviewState", OHOS_CAMERA_EXPOSURE_MODE_PREVIEW_STATE},
+    {"deferredImageDeliverySupportModes", OHOS_ABILITY_DEFERRED_IMAGE_DELIVERY},
+    {nullptr, 0},
+    {nullptr, 0},
+    {nullptr, 0},
+    {"baseFaceInfo", OHOS_STATISTICS_DETECT_BASE_FACE_INFO},
+    {nullptr, 0},
+    {nullptr, 0},
+    {"autoAigcPhoto", OHOS_ABILITY_AUTO_AIGC_PHOTO},
+    {"availablePreviewProfile", OHOS_ABILITY_AVAILABLE_PREVIEW_PROFILE},
+    {"flashAvailable", OHOS_ABILITY_FLASH_AVAILABLE},
+    {nullptr, 0},
+    {"cameraXmageControlMode", OHOS_CONTROL_SUPPORTED_COLOR_MODES},
+    {"zoomCropRegion", OHOS_CONTROL_ZOOM_CROP_REGION},
+    {"sceneStreamQuickThumbnailAvailable", OHOS_ABILITY_SCENE_STREAM_QUICK_THUMBNAIL_AVAILABLE},
+    {"compositionSuggestionSupported", OHOS_ABILITY_COMPOSITION_SUGGESTION},
+    {"faceIds", OHOS_STATISTICS_FACE_IDS},
+    {"cameraLimitedCapability", OHOS_ABILITY_CAMERA_LIMITED_CAPABILITIES},
+    {nullptr, 0},
+    {"statusConstellationDrawingDetect", OHOS_STATUS_CONSTELLATION_DRAWING_DETECT},
+    {"size", OHOS_JPEG_SIZE},
+    {"lockObjectTracking", OHOS_CONTROL_LOCK_OBJECT_TRACKING},
+    {nullptr, 0},
+    {"exposureMode", OHOS_CONTROL_EXPOSUREMODE},
+    {"videoRotation", OHOS_CONTROL_CAMERA_VIDEO_ROTATION},
+    {"whiteAvailablesModes", OHOS_ABILITY_AWB_MODES},
+    {"controlNightSubMode", OHOS_CONTROL_NIGHT_SUB_MODE},
+    {nullptr, 0},
+    {"abilityAELock", OHOS_ABILITY_AE_LOCK},
+    {"detectDogFaceInfos", OHOS_STATISTICS_DETECT_DOG_FACE_INFOS},
+    {"compositionSuggestion", OHOS_CONTROL_COMPOSITION_SUGGESTION},
+    {"requestCameraSwitch", OHOS_CONTROL_REQUEST_CAMERA_SWITCH},
+    {"histogramMode", OHOS_STATISTICS_HISTOGRAM_MODE},
+    {"sensorOrientation", OHOS_SENSOR_ORIENTATION},
+    {"streamAutoFpsSupportedMode", OHOS_ABILITY_AUTO_VIDEO_FRAME_RATE},
+    {"availableHeadShrinkValues", OHOS_ABILITY_BEAUTY_HEAD_SHRINK_VALUES},
+    {"cameraSessionUsage", OHOS_CONTROL_CAMERA_SESSION_USAGE},
+    {nullptr, 0},
+    {"smoothZoom", OHOS_ABILITY_CAMERA_NEED_SET_SMOOTH},
+    {"cameraUserId", OHOS_CAMERA_USER_ID},
+    {"bandwidthCompressionControlValue", OHOS_CONTROL_BANDWIDTH_COMPRESSION},
+    {"photoStitchingDirection", OHOS_CONTROL_PHOTO_STITCHING_DIRECTION},
+    {"availableAutoBeautyValues", OHOS_ABILITY_BEAUTY_AUTO_VALUES},
+    {"focusState", OHOS_CONTROL_FOCUS_STATE},
+    {"compositionPositionCalibrationExpand", OHOS_COMPOSITION_POSITION_CALIBRATION_EXPAND},
+    {"afAvailableModes", OHOS_CONTROL_AF_AVAILABLE_MODES},
+    {"movingPhotoEnd", OHOS_MOVING_PHOTO_END},
+    {"timestamp", OHOS_STATISTICS_TIMESTAMP},
+    {"imagingMode", OHOS_CONTROL_IMAGING_MODE},
+    {"isLogicalCamera", OHOS_ABILITY_IS_LOGICAL_CAMERA},
+    {"streamPortraitResolusion", OHOS_ABILITY_PORTRAIT_RESOLUSION},
+    {nullptr, 0},
+    {"flashAdjustAvailable", OHOS_ABILITY_FLASHLIGHT_ADJUST_SUPPORTED},
+    {"cameraLightStatusControl", OHOS_CONTROL_LIGHT_STATUS},
+    {"exposureHintSupported", OHOS_ABILITY_EXPOSURE_HINT_SUPPORTED},
+    {"macroSupportedValue", OHOS_ABILITY_CAMERA_MACRO_SUPPORTED},
+    {"availableHairHairlineValues", OHOS_ABILITY_BEAUTY_HAIR_HAIRLINE_VALUES},
+    {nullptr, 0},
+    {"cameraAbilityHighQualitySupport", OHOS_ABILITY_HIGH_QUALITY_SUPPORT},
+    {"physicalSize", OHOS_SENSOR_INFO_PHYSICAL_SIZE},
+    {"cameraAbilityFlashSuggestionSupported", OHOS_ABILITY_FLASH_SUGGESTION_SUPPORTED},
+    {"maxFrameDuration", OHOS_SENSOR_INFO_MAX_FRAME_DURATION},
+    {"sceneZoomCap", OHOS_ABILITY_SCENE_ZOOM_CAP},
+    {"portraitThemeType", OHOS_CONTROL_CAMERA_PORTRAIT_THEME_TYPE},
+    {"recordState", OHOS_CONTROL_RECORD_STATE},
+    {"autoDeferredVideoEnhance", OHOS_ABILITY_AUTO_DEFERRED_VIDEO_ENHANCE},
+    {"availableSkinToneBrightValues", OHOS_ABILITY_BEAUTY_SKIN_TONEBRIGHT_VALUES},
+    {"sunBlockRgbUvRegion", OHOS_ABILITY_SUN_BLOCK_RGB_UV_REGION},
+    {"removeSensorRestraint", OHOS_CONTROL_REMOVE_SENSOR_RESTRAINT},
+    {"prerecord", OHOS_ABILITY_PRERECORD},
+    {"stageBoost", OHOS_ABILITY_STAGE_BOOST},
+    {"cameraLightStatus", OHOS_STATUS_LIGHT_STATUS},
+    {"abilityExposureTime", OHOS_ABILITY_EXPOSURE_TIME},
+    {"recommendedInfoLanguage", OHOS_CONTROL_RECOMMENDED_INFO_LANGUAGE},
+    {"availableProfileLevel", OHOS_ABILITY_AVAILABLE_PROFILE_LEVEL},
+    {"controlFocusDistance", OHOS_CONTROL_FOCUS_DISTANCE},
+    {"exposureState", OHOS_CONTROL_EXPOSURE_STATE},
+    {nullptr, 0},
+    {"timeLapsePreviewType", OHOS_STATUS_TIME_LAPSE_PREVIEW_TYPE},
+    {"colorStyleSupportPhotoType", OHOS_ABILITY_OUTPUT_COLOR_STYLE_PHOTO_TYPE},
+    {"mirror", OHOS_CONTROL_CAPTURE_MIRROR},
+    {"secureFaceInfo", OHOS_CONTROL_SECURE_FACE_INFO},
+    {"afState", OHOS_CONTROL_AF_STATE},
+    {"cinemaVideoKeyFrameTimestamp", OHOS_CINEMA_VIDEO_KEY_FRAME_TIMESTAMP},
+    {"effectSuggestionSupported", OHOS_ABILITY_EFFECT_SUGGESTION_SUPPORTED},
+    {"sceneFocusSupportiveModes", OHOS_ABILITY_SCENE_FOCUS_MODES},
+    {"mirrorSupported", OHOS_CONTROL_CAPTURE_MIRROR_SUPPORTED},
+    {"superSlowMotionCheckArea", OHOS_CONTROL_MOTION_DETECTION_CHECK_AREA},
+    {"controlStageBoost", OHOS_CONTROL_STAGE_BOOST},
+    {"cameraIsRetractable", OHOS_ABILITY_CAMERA_IS_RETRACTABLE},
+    {nullptr, 0},
+    {"cameraXmageSupportMode", OHOS_ABILITY_SUPPORTED_COLOR_MODES},
+    {"faceDetectMode", OHOS_STATISTICS_FACE_DETECT_MODE},
+    {"automotiveCameraPositon", OHOS_ABILITY_AUTOMOTIVE_CAMERA_POSITION},
+    {"cameraConcurrentCapture", OHOS_CONTROL_CAMERA_CONCURRENT_CAPTURE},
+    {"isoValues", OHOS_CONTROL_ISO_VALUE},
+    {"abilityAutoExtendedGainmapDelivery", OHOS_ABILITY_AUTO_EXTENDED_GAINMAP_DELIVERY},
+};
+} // namespace OHOS::Camera
+#endif // CAMERA_METADATA_ITEM_TABLE_H
@@ -18,6 +18,7 @@
 
 #include <cstdio>
 #include <cstdint>
+#include <functional>
 #include <string>
 
 #include "camera_device_ability_items.h"
@@ -25,6 +26,11 @@
 /** Versioning information */
 #define CURRENT_CAMERA_METADATA_VERSION 1
 
+/** Header flags, kept in the upper half of common_metadata_header_t::version */
+#define CAMERA_METADATA_VERSION_MASK ((uint32_t) 0x0000FFFF)
+// Item entries are kept ordered by tag, lookups use binary search
+#define CAMERA_METADATA_FLAG_SORTED_ITEMS ((uint32_t) 1 << 16)
+
 #define ITEM_ALIGNMENT ((size_t) 4)
 
 #define DATA_ALIGNMENT ((size_t) 8)
@@ -175,6 +181,9 @@ int FindCameraMetadataItemIndex(const common_metadata_header_t *src, uint32_t it
 // Get camera metadata item name
 const char *GetCameraMetadataItemName(uint32_t item);
 
+// Get the OHOS item called name, a name shared by several items gives the lowest one
+int32_t GetCameraMetadataItemTagByName(const char *name, uint32_t *item);
+
 // Update camera metadata item and fill the updated item
 int UpdateCameraMetadataItem(common_metadata_header_t *dst, uint32_t item, const void *data, uint32_t dataCount,
     camera_metadata_item_t *updatedItem);
@@ -192,13 +201,31 @@ int DeleteCameraMetadataItem(common_metadata_header_t *dst, uint32_t item);
 // Delete camera metadata item by index
 int DeleteCameraMetadataItemByIndex(common_metadata_header_t *dst, uint32_t index);
 
+// Delete all entries of the given camera metadata items in a single compaction pass
+int DeleteCameraMetadataItems(common_metadata_header_t *dst, const uint32_t *items, uint32_t itemCount);
+
 // Free camera metadata buffer
 void FreeCameraMetadataBuffer(common_metadata_header_t *dst);
 
+// Keep camera metadata items ordered by tag so that lookups can binary search
+int SetCameraMetadataItemsSorted(common_metadata_header_t *dst, bool sorted);
+
+// Are camera metadata items ordered by tag
+bool IsCameraMetadataItemsSorted(const common_metadata_header_t *src);
+
+// Order independent hash of the items, metadata with equal items have equal hashes
+uint64_t CalculateCameraMetadataContentHash(const common_metadata_header_t *src);
+
 std::string MetadataItemDump(const common_metadata_header_t *metadataHeader, uint32_t item);
 
 std::string FormatCameraMetadataToString(const common_metadata_header_t *metadataHeader);
 
+// Receives the formatted dump of one metadata item, str is only valid during the call
+using MetadataDumpSink = std::function<void(const char *str, size_t length)>;
+
+// Dump every item present in the metadata buffer in a single pass, in storage order
+int DumpCameraMetadata(const common_metadata_header_t *metadataHeader, const MetadataDumpSink &sink);
+
 // Internal use
 camera_metadata_item_entry_t *GetMetadataItems(const common_metadata_header_t *metadataHeader);
 uint8_t *GetMetadataData(const common_metadata_header_t *metadataHeader);
@@ -216,5 +243,6 @@ int32_t GetMetadataSection(uint32_t itemSection, uint32_t *section);
 int MetadataExpandItemMem(common_metadata_header_t *dst, camera_metadata_item_entry_t *item,
     size_t oldItemSize);
 int32_t GetAllVendorTags(std::vector<vendorTag_t>& tagVec);
+int32_t RefreshVendorTagTable();
 } // Camera
 #endif // CAMERA_METADATA_OPERATOR_H
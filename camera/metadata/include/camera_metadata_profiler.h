@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CAMERA_METADATA_PROFILER_H
+#define CAMERA_METADATA_PROFILER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "camera_metadata_operator.h"
+
+namespace OHOS::Camera {
+enum CameraMetadataProfileOp : uint32_t {
+    METADATA_PROFILE_OP_FIND = 0,
+    METADATA_PROFILE_OP_ADD,
+    METADATA_PROFILE_OP_UPDATE,
+    METADATA_PROFILE_OP_DELETE,
+    // addEntry had to grow the buffer to fit the item
+    METADATA_PROFILE_OP_RESIZE,
+    METADATA_PROFILE_OP_COUNT
+};
+
+struct CameraMetadataTagProfile {
+    uint32_t tag = 0;
+    uint64_t counts[METADATA_PROFILE_OP_COUNT] = {};
+};
+
+struct CameraMetadataProfile {
+    // Tags with at least one recorded operation, most used first
+    std::vector<CameraMetadataTagProfile> tags;
+    // Buffer reallocations of CameraMetadata and the cost of copying the old content over
+    uint64_t resizeCount = 0;
+    uint64_t resizeBytesCopied = 0;
+    uint64_t resizeCopyNanoseconds = 0;
+    // Operations not counted because every tag slot was taken
+    uint64_t droppedRecords = 0;
+};
+
+// Counters are only compiled in with CAMERA_METADATA_PROFILING, and stay off until enabled at runtime
+bool IsCameraMetadataProfilingSupported();
+int SetCameraMetadataProfilingEnabled(bool enabled);
+bool IsCameraMetadataProfilingEnabled();
+void ResetCameraMetadataProfile();
+CameraMetadataProfile GetCameraMetadataProfile();
+
+// One line per tag, most used first, then the resize totals
+int DumpCameraMetadataProfile(const MetadataDumpSink &sink);
+std::string FormatCameraMetadataProfileToString();
+
+// Internal use
+void RecordCameraMetadataTagOp(uint32_t tag, CameraMetadataProfileOp op);
+// 0 while profiling is off, so that the matching RecordCameraMetadataResize is skipped
+uint64_t GetCameraMetadataProfileTime();
+void RecordCameraMetadataResize(uint64_t bytesCopied, uint64_t startTime);
+
+#ifdef CAMERA_METADATA_PROFILING
+#define METADATA_PROFILE_TAG_OP(tag, op) RecordCameraMetadataTagOp((tag), (op))
+#define METADATA_PROFILE_TIME() GetCameraMetadataProfileTime()
+#define METADATA_PROFILE_RESIZE(bytesCopied, startTime) RecordCameraMetadataResize((bytesCopied), (startTime))
+#else
+// Arguments are still referenced so that variables only kept for profiling do not warn
+#define METADATA_PROFILE_TAG_OP(tag, op) ((void)(tag), (void)(op))
+#define METADATA_PROFILE_TIME() ((uint64_t)0)
+#define METADATA_PROFILE_RESIZE(bytesCopied, startTime) ((void)(bytesCopied), (void)(startTime))
+#endif
+} // namespace OHOS::Camera
+#endif // CAMERA_METADATA_PROFILER_H
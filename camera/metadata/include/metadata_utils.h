@@ -16,9 +16,11 @@
 #ifndef OHOS_CAMERA_METADATA_UTILS_H
 #define OHOS_CAMERA_METADATA_UTILS_H
 
+#include <cstring>
 #include <iostream>
 #include <list>
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "camera_metadata_info.h"
@@ -33,6 +35,22 @@ public:
 
     static void ReadCameraMetadata(MessageParcel &data, common_metadata_header_t *meta, uint32_t tagCount);
     static bool WriteCameraMetadata(const common_metadata_header_t* meta, MessageParcel &data);
+    // Send the metadata buffer as one blob, the peer must understand METADATA_BLOB_MAGIC
+    static bool EncodeCameraMetadataBlob(const std::shared_ptr<CameraMetadata> &metadata, MessageParcel &data);
+    static bool WriteCameraMetadataBlob(const common_metadata_header_t* meta, MessageParcel &data);
+    // Send only the entries of metadata that changed since base, base may be null for a full snapshot.
+    // The delta records the content hash of base and only applies to metadata with the same entries
+    static bool EncodeCameraMetadataDelta(const std::shared_ptr<CameraMetadata> &base,
+        const std::shared_ptr<CameraMetadata> &metadata, MessageParcel &data);
+    // Apply a delta written by EncodeCameraMetadataDelta to the metadata it was taken against,
+    // metadata is left unchanged if it is not that base or the delta does not apply
+    static bool DecodeCameraMetadataDelta(MessageParcel &data, std::shared_ptr<CameraMetadata> &metadata);
+    // Read a blob once METADATA_BLOB_MAGIC has been consumed from the parcel
+    static std::unique_ptr<CameraMetadata> ReadCameraMetadataBlob(MessageParcel &data);
+    // Store metadata as a camera ability file that MapCameraMetadataFile can share between processes
+    static bool WriteCameraMetadataFile(const std::shared_ptr<CameraMetadata> &metadata, const std::string &path);
+    // Map a camera ability file without copying it, pages stay shared until a process writes to them
+    static std::shared_ptr<CameraMetadata> MapCameraMetadataFile(const std::string &path);
     static std::string EncodeToString(std::shared_ptr<CameraMetadata> metadata);
     static std::shared_ptr<CameraMetadata> DecodeFromString(std::string setting);
     static bool ConvertMetadataToVec(const std::shared_ptr<CameraMetadata> &metadata,
@@ -42,14 +60,16 @@ public:
     static void FreeMetadataBuffer(camera_metadata_item_t &entry);
 
     template <class T> static void WriteData(T data, std::vector<uint8_t>& cameraAbility);
+    template <class T> static void WriteDataArray(const T *data, size_t count, std::vector<uint8_t>& cameraAbility);
     template <class T> static void ReadData(T &data, int32_t &index, const std::vector<uint8_t>& cameraAbility);
 private:
     static bool WriteMetadata(const camera_metadata_item_t &item, MessageParcel &data);
-    static bool ReadMetadata(camera_metadata_item_t &item, MessageParcel &data);
-    static void ItemDataToBuffer(const camera_metadata_item_t &item, void **buffer);
+    // Payload of item in the parcel or in rationalBuffer, nullptr if it cannot be read
+    static const void *ReadMetadataData(const camera_metadata_item_t &item, MessageParcel &data,
+        std::vector<int32_t> &rationalBuffer);
+    static bool CheckCameraMetadataBlobItems(const common_metadata_header_t *meta, bool &sorted);
+    static bool CheckCameraMetadataBlobLayout(const common_metadata_header_t *blob, size_t blobSize);
     static void WriteMetadataDataToVec(const camera_metadata_item_t &entry, std::vector<uint8_t>& cameraAbility);
-    static void ReadMetadataDataFromVec(int32_t &index, camera_metadata_item_t &entry,
-        const std::vector<uint8_t>& cameraAbility);
     static int copyEncodeToStringMem(common_metadata_header_t *meta, char *encodeData, int32_t encodeDataLen);
     static int copyDecodeFromStringMem(common_metadata_header_t *meta, char *decodeData,
         char *decodeMetadataData, uint32_t totalLen);
@@ -58,11 +78,18 @@ private:
 template <class T>
 void MetadataUtils::WriteData(T data, std::vector<uint8_t>& cameraAbility)
 {
-    T dataTemp = data;
-    uint8_t *dataPtr = reinterpret_cast<uint8_t *>(&dataTemp);
-    for (size_t j = 0; j < sizeof(T); j++) {
-        cameraAbility.push_back(*(dataPtr + j));
+    WriteDataArray<T>(&data, 1, cameraAbility);
+}
+
+template <class T>
+void MetadataUtils::WriteDataArray(const T *data, size_t count, std::vector<uint8_t>& cameraAbility)
+{
+    if (data == nullptr || count == 0) {
+        return;
     }
+    size_t offset = cameraAbility.size();
+    cameraAbility.resize(offset + count * sizeof(T));
+    std::memcpy(cameraAbility.data() + offset, data, count * sizeof(T));
 }
 
 template <class T>
@@ -76,11 +103,10 @@ void MetadataUtils::ReadData(T &data, int32_t &index, const std::vector<uint8_t>
         data = *ptr;
         return;
     }
-    for (size_t j = 0; j < sizeof(T); j++) {
-        array[j] = cameraAbility.at(index++);
-    }
-    ptr = reinterpret_cast<T *>(array);
-    data = *ptr;
+    // Out of range reads throw like before, the value itself is copied in one go
+    (void)cameraAbility.at(index + sizeof(T) - 1);
+    std::memcpy(&data, cameraAbility.data() + index, sizeof(T));
+    index += static_cast<int32_t>(sizeof(T));
 }
 } // namespace Camera
 #endif // OHOS_CAMERA_METADATA_UTILS_H
@@ -0,0 +1,298 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright (c) 2026 Huawei Device Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate camera_metadata_item_table.h from camera_metadata_items.txt.
+
+Without arguments the header is rewritten in place. With --check nothing is
+written: the build fails if the schema no longer matches the tag enum of
+camera_device_ability_items.h or if the checked in header is stale.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_SCHEMA = os.path.join(SCRIPT_DIR, 'camera_metadata_items.txt')
+DEFAULT_ABILITY_ITEMS = os.path.join(SCRIPT_DIR, '..', 'include', 'camera_device_ability_items.h')
+DEFAULT_OUTPUT = os.path.join(SCRIPT_DIR, '..', 'include', 'camera_metadata_item_table.h')
+
+META_TYPES = {
+    'byte': 'META_TYPE_BYTE',
+    'int32': 'META_TYPE_INT32',
+    'uint32': 'META_TYPE_UINT32',
+    'float': 'META_TYPE_FLOAT',
+    'int64': 'META_TYPE_INT64',
+    'double': 'META_TYPE_DOUBLE',
+    'rational': 'META_TYPE_RATIONAL',
+}
+
+# Must match MetadataNameHash in camera_metadata_item_info.h
+FNV_OFFSET_BASIS = 0x811C9DC5
+FNV_PRIME = 0x01000193
+NAME_HASH_BUCKET_SIZE = 4
+NAME_HASH_MAX_SEED = 0xFFFF
+MAX_LINE_LENGTH = 120
+
+LICENSE_HEADER = '''/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+'''
+
+
+class SchemaError(Exception):
+    pass
+
+
+class Section(object):
+    def __init__(self, section_id, start, end, table):
+        self.section_id = section_id
+        self.start = start
+        self.end = end
+        self.table = table
+        # (tag, name, meta type, data count), name is None for a tag without item info
+        self.items = []
+
+
+def parse_schema(path):
+    sections = []
+    dump_tags = []
+    in_dump = False
+    with open(path, 'r') as schema:
+        for line_no, line in enumerate(schema, 1):
+            fields = line.split('#', 1)[0].split()
+            if not fields:
+                continue
+            where = '%s:%d' % (os.path.basename(path), line_no)
+            if fields[0] == 'section':
+                if len(fields) != 5 or in_dump:
+                    raise SchemaError('%s: expected "section <id> <start> <end> <table>"' % where)
+                sections.append(Section(*fields[1:]))
+            elif fields[0] == 'dump':
+                in_dump = True
+            elif in_dump:
+                if len(fields) != 1:
+                    raise SchemaError('%s: expected a single tag in the dump list' % where)
+                dump_tags.append(fields[0])
+            elif not sections:
+                raise SchemaError('%s: item outside of a section' % where)
+            elif len(fields) == 2 and fields[1] == '-':
+                sections[-1].items.append((fields[0], None, None, None))
+            elif len(fields) == 4:
+                tag, name, data_type, count = fields
+                if data_type not in META_TYPES:
+                    raise SchemaError('%s: unknown type %s' % (where, data_type))
+                if count != '*' and not count.isdigit():
+                    raise SchemaError('%s: count must be a number or *' % where)
+                sections[-1].items.append((tag, name, META_TYPES.get(data_type), -1 if count == '*' else int(count)))
+            else:
+                raise SchemaError('%s: expected "<tag> <name> <type> <count>" or "<tag> -"' % where)
+    return sections, dump_tags
+
+
+def parse_tag_enum(path):
+    """Return {section start: [tags up to and including the section end]} of camera_device_metadata_tag."""
+    with open(path, 'r') as header:
+        content = header.read()
+    match = re.search(r'typedef enum camera_device_metadata_tag \{(.*?)\} camera_device_metadata_tag_t;',
+                      content, re.S)
+    if match is None:
+        raise SchemaError('camera_device_metadata_tag not found in %s' % path)
+    body = re.sub(r'/\*.*?\*/', '', match.group(1), flags=re.S)
+    body = re.sub(r'//[^\n]*', '', body)
+    ranges = {}
+    current = None
+    for entry in (field.strip() for field in body.split(',')):
+        if not entry:
+            continue
+        if '=' in entry:
+            tag, start = (part.strip() for part in entry.split('=', 1))
+            current = ranges.setdefault(start, [])
+            current.append(tag)
+        elif current is None:
+            raise SchemaError('%s does not start at a section' % entry)
+        else:
+            current.append(entry)
+    return ranges
+
+
+def validate(sections, dump_tags, tag_ranges):
+    known_tags = set()
+    for section in sections:
+        enum_tags = tag_ranges.get(section.start)
+        if enum_tags is None:
+            raise SchemaError('%s: no tag starts at %s' % (section.section_id, section.start))
+        schema_tags = [item[0] for item in section.items] + [section.end]
+        if schema_tags != enum_tags:
+            missing = [tag for tag in enum_tags if tag not in schema_tags]
+            extra = [tag for tag in schema_tags if tag not in enum_tags]
+            raise SchemaError('%s does not follow the tag enum, missing %s, unknown %s, or out of order' %
+                              (section.section_id, missing, extra))
+        known_tags.update(schema_tags[:-1])
+    unknown = [tag for tag in dump_tags if tag not in known_tags]
+    if unknown:
+        raise SchemaError('dump list has unknown tags %s' % unknown)
+    if len(set(dump_tags)) != len(dump_tags):
+        raise SchemaError('dump list has duplicated tags')
+
+
+def name_hash(seed, name):
+    value = FNV_OFFSET_BASIS ^ seed
+    for char in name.encode('utf-8'):
+        value = ((value ^ char) * FNV_PRIME) & 0xFFFFFFFF
+    return value
+
+
+def build_name_hash(sections):
+    """Hash and displace: every name lands in a unique slot after one seed lookup."""
+    names = []
+    seen = set()
+    for section in sections:
+        for tag, name, _, _ in section.items:
+            # A name shared by several tags resolves to the first one
+            if name is not None and name not in seen:
+                seen.add(name)
+                names.append((name, tag))
+    slot_count = 1
+    while slot_count < len(names):
+        slot_count <<= 1
+    bucket_count = max(1, (len(names) + NAME_HASH_BUCKET_SIZE - 1) // NAME_HASH_BUCKET_SIZE)
+    buckets = [[] for _ in range(bucket_count)]
+    for entry in names:
+        buckets[name_hash(0, entry[0]) % bucket_count].append(entry)
+
+    seeds = [0] * bucket_count
+    slots = [None] * slot_count
+    for bucket_index in sorted(range(bucket_count), key=lambda index: -len(buckets[index])):
+        bucket = buckets[bucket_index]
+        if not bucket:
+            continue
+        for seed in range(1, NAME_HASH_MAX_SEED + 1):
+            positions = [name_hash(seed, name) & (slot_count - 1) for name, _ in bucket]
+            if len(set(positions)) == len(positions) and all(slots[pos] is None for pos in positions):
+                break
+        else:
+            raise SchemaError('no perfect hash seed found, raise NAME_HASH_MAX_SEED')
+        seeds[bucket_index] = seed
+        for pos, entry in zip(positions, bucket):
+            slots[pos] = entry
+    return seeds, slots
+
+
+def format_array(lines, indent='    '):
+    return ''.join('%s%s\n' % (indent, line) for line in lines)
+
+
+def generate(sections, dump_tags, schema_name):
+    out = [LICENSE_HEADER]
+    out.append('''
+// Generated by gen_camera_metadata_tables.py from %s, do not edit.
+// Included by camera_metadata_item_info.h, which declares the table types and checks them against the tag enum.
+
+#ifndef CAMERA_METADATA_ITEM_TABLE_H
+#define CAMERA_METADATA_ITEM_TABLE_H
+
+namespace OHOS::Camera {
+''' % schema_name)
+    for section in sections:
+        infos = []
+        tags = []
+        for tag, name, data_type, count in section.items:
+            if name is None:
+                infos.append('{nullptr, META_TYPE_BYTE, 0}, // %s has no item info' % tag)
+            else:
+                infos.append('{"%s", %s, %d},' % (name, data_type, count))
+            tags.append('%s,' % tag)
+        out.append('constexpr item_info_t %s[] = {\n%s};\n\n' % (section.table, format_array(infos)))
+        out.append('constexpr uint32_t %sTags[] = {\n%s};\n\n' % (section.table, format_array(tags)))
+
+    descs = []
+    for section in sections:
+        desc = 'MakeMetadataSectionDesc(%s, %s, %s, %sTags),' % (section.start, section.end, section.table,
+                                                                   section.table)
+        if len(desc) + len('    ') > MAX_LINE_LENGTH:
+            desc = 'MakeMetadataSectionDesc(%s, %s,\n        %s, %sTags),' % (section.start, section.end,
+                                                                             section.table, section.table)
+        descs.append(desc)
+    ids = ['%s,' % s.section_id for s in sections]
+    out.append('// Indexed by camera_metadata_sec_t\n')
+    out.append('constexpr metadata_section_desc_t g_ohosSectionDescs[] = {\n%s};\n\n' % format_array(descs))
+    out.append('constexpr uint32_t g_ohosSectionDescIds[] = {\n%s};\n\n' % format_array(ids))
+
+    out.append('// Tags dumped by FormatCameraMetadataToString, in output order\n')
+    out.append('constexpr uint32_t g_metadataDumpTags[] = {\n%s};\n\n' %
+               format_array('%s,' % tag for tag in dump_tags))
+
+    seeds, slots = build_name_hash(sections)
+    seed_lines = []
+    for index in range(0, len(seeds), 12):
+        seed_lines.append(' '.join('%d,' % seed for seed in seeds[index:index + 12]))
+    slot_lines = ['{"%s", %s},' % slot if slot is not None else '{nullptr, 0},' for slot in slots]
+    out.append('// Perfect hash of the item names: MetadataNameHash(0, name) picks a bucket, its seed picks the slot\n')
+    out.append('constexpr uint16_t g_metadataNameHashSeeds[] = {\n%s};\n\n' % format_array(seed_lines))
+    out.append('constexpr metadata_item_name_t g_metadataNameHashSlots[] = {\n%s};\n' % format_array(slot_lines))
+    out.append('} // namespace OHOS::Camera\n#endif // CAMERA_METADATA_ITEM_TABLE_H\n')
+    return ''.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the camera metadata item tables from the schema')
+    parser.add_argument('--schema', default=DEFAULT_SCHEMA)
+    parser.add_argument('--ability-items', default=DEFAULT_ABILITY_ITEMS)
+    parser.add_argument('--output', default=DEFAULT_OUTPUT)
+    parser.add_argument('--check', action='store_true', help='fail instead of writing when the output is stale')
+    parser.add_argument('--stamp', help='file touched after a successful check, for the build system')
+    args = parser.parse_args()
+
+    try:
+        sections, dump_tags = parse_schema(args.schema)
+        validate(sections, dump_tags, parse_tag_enum(args.ability_items))
+        content = generate(sections, dump_tags, os.path.basename(args.schema))
+    except SchemaError as error:
+        sys.stderr.write('error: %s\n' % error)
+        return 1
+
+    if args.check:
+        current = None
+        if os.path.exists(args.output):
+            with open(args.output, 'r') as output:
+                current = output.read()
+        if current != content:
+            sys.stderr.write('error: %s is stale, run %s\n' % (args.output, os.path.basename(__file__)))
+            return 1
+    else:
+        with open(args.output, 'w') as output:
+            output.write(content)
+
+    if args.stamp:
+        with open(args.stamp, 'w') as stamp:
+            stamp.write('')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
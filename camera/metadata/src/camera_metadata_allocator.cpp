@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "camera_metadata_allocator.h"
+#include <algorithm>
+#include <cstdlib>
+#include <securec.h>
+#include "metadata_log.h"
+
+namespace OHOS::Camera {
+CameraMetadataPool::CameraMetadataPool(size_t slabSize, uint32_t maxFreeSlabs)
+    : slabSize_(slabSize), maxFreeSlabs_(maxFreeSlabs)
+{
+    freeSlabs_.reserve(maxFreeSlabs);
+}
+
+CameraMetadataPool::~CameraMetadataPool()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stats_.inUse != 0) {
+        METADATA_ERR_LOG("CameraMetadataPool destroyed with %{public}u buffers in use", stats_.inUse);
+    }
+    for (void *slab : freeSlabs_) {
+        free(slab);
+    }
+    freeSlabs_.clear();
+}
+
+void *CameraMetadataPool::Allocate(size_t size)
+{
+    if (size == 0) {
+        return nullptr;
+    }
+    void *buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (size <= slabSize_ && !freeSlabs_.empty()) {
+            buffer = freeSlabs_.back();
+            freeSlabs_.pop_back();
+            stats_.hits++;
+        } else {
+            stats_.misses++;
+            stats_.oversized += (size > slabSize_) ? 1 : 0;
+        }
+        stats_.inUse++;
+        stats_.highWaterMark = std::max(stats_.highWaterMark, stats_.inUse);
+        stats_.freeSlabs = static_cast<uint32_t>(freeSlabs_.size());
+    }
+
+    if (buffer != nullptr) {
+        (void)memset_s(buffer, slabSize_, 0, size);
+        return buffer;
+    }
+    buffer = calloc(1, (size <= slabSize_) ? slabSize_ : size);
+    if (buffer == nullptr) {
+        METADATA_ERR_LOG("CameraMetadataPool allocation failed, size: %{public}zu", size);
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.inUse--;
+    }
+    return buffer;
+}
+
+void CameraMetadataPool::Release(void *buffer, size_t size)
+{
+    if (buffer == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.inUse--;
+        if (size <= slabSize_ && freeSlabs_.size() < maxFreeSlabs_) {
+            freeSlabs_.push_back(buffer);
+            stats_.freeSlabs = static_cast<uint32_t>(freeSlabs_.size());
+            return;
+        }
+    }
+    free(buffer);
+}
+
+bool CameraMetadataPool::Reserve(uint32_t slabCount)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (slabSize_ == 0 || slabCount > maxFreeSlabs_ - freeSlabs_.size()) {
+        METADATA_ERR_LOG("CameraMetadataPool reserve %{public}u slabs exceeds the pool limit", slabCount);
+        return false;
+    }
+    bool bRet = true;
+    for (uint32_t i = 0; i < slabCount; i++) {
+        void *slab = calloc(1, slabSize_);
+        if (slab == nullptr) {
+            METADATA_ERR_LOG("CameraMetadataPool reserve allocation failed");
+            bRet = false;
+            break;
+        }
+        freeSlabs_.push_back(slab);
+    }
+    stats_.freeSlabs = static_cast<uint32_t>(freeSlabs_.size());
+    return bRet;
+}
+
+size_t CameraMetadataPool::GetSlabSize() const
+{
+    return slabSize_;
+}
+
+CameraMetadataPoolStats CameraMetadataPool::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+} // namespace OHOS::Camera
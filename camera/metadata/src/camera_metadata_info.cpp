@@ -17,17 +17,22 @@
 #include <securec.h>
 #include "metadata_log.h"
 #include <dlfcn.h>
+#include <sys/mman.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
 #include <memory>
 #include <vector>
-#include <map>
 #include <mutex>
+#include <unordered_map>
 #include "camera_metadata_item_info.h"
+#include "camera_metadata_profiler.h"
 #include "camera_vendor_tag.h"
 #include "metadata_utils.h"
 #include "metadata/v1_0/icamera_vendor_tag.h"
 
 namespace OHOS::Camera {
-static std::mutex g_mtx;
 static std::mutex g_vendorTagImplMtx;
 #ifndef CAMERA_VENDOR_TAG
 static CameraVendorTag* g_vendorTagImpl = nullptr;
@@ -37,485 +42,12 @@ static sptr<OHOS::HDI::Camera::Metadata::V1_0::ICameraVendorTag> g_cameraVendorT
 #endif
 const int METADATA_HEADER_DATA_SIZE = 4;
 const uint32_t itemLen = sizeof(camera_metadata_item_entry_t);
-const std::vector<uint32_t> g_metadataTags = {
-    OHOS_ABILITY_CAMERA_POSITION,
-    OHOS_ABILITY_CAMERA_TYPE,
-    OHOS_ABILITY_CAMERA_CONNECTION_TYPE,
-    OHOS_ABILITY_MEMORY_TYPE,
-    OHOS_ABILITY_FPS_RANGES,
-    OHOS_ABILITY_FLASH_AVAILABLE,
-    OHOS_ABILITY_FLASHLIGHT_ADJUST_SUPPORTED,
-    OHOS_CAMERA_STREAM_ID,
-    OHOS_ABILITY_PRELAUNCH_AVAILABLE,
-    OHOS_ABILITY_CUSTOM_VIDEO_FPS,
-    OHOS_ABILITY_CAMERA_MODES,
-    OHOS_ABILITY_SKETCH_ENABLE_RATIO,
-    OHOS_ABILITY_SKETCH_REFERENCE_FOV_RATIO,
-    OHOS_ABILITY_SKETCH_INFO_NOTIFICATION,
-    OHOS_ABILITY_CAMERA_FOLDSCREEN_TYPE,
-    OHOS_ABILITY_AVAILABLE_COLOR_SPACES,
-    OHOS_ABILITY_NIGHT_MODE_SUPPORTED_EXPOSURE_TIME,
-    OHOS_CAMERA_MESURE_EXPOSURE_TIME,
-    OHOS_CAMERA_EXPOSURE_MODE_PREVIEW_STATE,
-    OHOS_CAMERA_USER_ID,
-    OHOS_ABILITY_MOON_CAPTURE_BOOST,
-    OHOS_CONTROL_MOON_CAPTURE_BOOST,
-    OHOS_STATUS_MOON_CAPTURE_DETECTION,
-    OHOS_ABILITY_CAPTURE_DURATION_SUPPORTED,
-    OHOS_CAMERA_CUSTOM_SNAPSHOT_DURATION,
-    OHOS_CAMERA_CONSTELLATION_DRAWING_STATE,
-    OHOS_ABILITY_MOVING_PHOTO,
-    OHOS_ABILITY_FLASH_SUGGESTION_SUPPORTED,
-    OHOS_CONTROL_FLASH_SUGGESTION_SWITCH,
-    OHOS_STATUS_FLASH_SUGGESTION,
-    OHOS_ABILITY_HIGH_QUALITY_SUPPORT,
-    OHOS_ABILITY_CAMERA_FOLD_STATUS,
-    OHOS_STATUS_CAMERA_OCCLUSION_DETECTION,
-    OHOS_ABILITY_STATISTICS_DETECT_TYPE,
-    OHOS_CONTROL_STATISTICS_DETECT_SETTING,
-    OHOS_ABILITY_AVAILABLE_EXTENDED_STREAM_INFO_TYPES,
-    OHOS_ABILITY_AUTO_DEFERRED_VIDEO_ENHANCE,
-    OHOS_CONTROL_AUTO_DEFERRED_VIDEO_ENHANCE,
-    OHOS_ABILITY_AUTO_CLOUD_IMAGE_ENHANCE,
-    OHOS_CONTROL_AUTO_CLOUD_IMAGE_ENHANCE,
-    OHOS_ABILITY_TRIPOD_DETECTION,
-    OHOS_CONTROL_TRIPOD_DETECTION,
-    OHOS_CONTROL_TRIPOD_STABLITATION,
-    OHOS_STATUS_TRIPOD_DETECTION_STATUS,
-    OHOS_STATUS_SKETCH_POINT,
-    OHOS_STATUS_SKETCH_STREAM_INFO,
-    OHOS_ABILITY_LOW_LIGHT_BOOST,
-    OHOS_CONTROL_LOW_LIGHT_DETECT,
-    OHOS_CONTROL_LOW_LIGHT_BOOST,
-    OHOS_STATUS_LOW_LIGHT_DETECTION,
-    OHOS_STATUS_CAMERA_LENS_DIRTY_DETECTION,
-    OHOS_DEVICE_PROTECTION_STATE,
-    OHOS_STATUS_TOF_SENSOR_ABNORMAL,
-    OHOS_ABILITY_SUN_BLOCK_PREVIEW_TYPES,
-    OHOS_ABILITY_SUN_BLOCK_BLEND_COLORS,
-    OHOS_ABILITY_SUN_BLOCK_RGB_CROP_REGION,
-    OHOS_ABILITY_SUN_BLOCK_RGB_UV_REGION,
-    OHOS_STATUS_SUN_BLOCK_HINT,
-    OHOS_ABILITY_AUTO_AIGC_PHOTO,
-    OHOS_CONTROL_AUTO_AIGC_PHOTO,
-    OHOS_ABILITY_CAMERA_LIMITED_CAPABILITIES,
-    OHOS_ABILITY_CAMERA_CONCURRENT_TYPE,
-    OHOS_ABILITY_CONCURRENT_SUPPORTED_CAMERAS,
-    OHOS_ABILITY_LOG_ASSISTANCE_SUPPORTED,
-    OHOS_ABILITY_STAGE_BOOST,
-    OHOS_CONTROL_STAGE_BOOST,
-    OHOS_ABILITY_AUTOMOTIVE_CAMERA_POSITION,
-    OHOS_ABILITY_AUTO_EXTENDED_GAINMAP_DELIVERY,
-    OHOS_CONTROL_AUTO_EXTENDED_GAINMAP_DELIVERY,
-    OHOS_CONTROL_CAMERA_CONCURRENT_CAPTURE,
-    OHOS_ABILITY_SPECTRUM_SUPPORTED,
-    OHOS_ABILITY_SPECTRUM_INFOS,
-    OHOS_ABILITY_AUTOMOTIVE_CAMERA_SENSOR_TYPE,
-
-    OHOS_ABILITY_COMMON_PUBLISHED_FEATURES,
-
-    OHOS_SENSOR_EXPOSURE_TIME,
-    OHOS_SENSOR_COLOR_CORRECTION_GAINS,
-    OHOS_SENSOR_ORIENTATION,
-    OHOS_ABILITY_MUTE_MODES,
-    OHOS_CONTROL_MUTE_MODE,
-    OHOS_ABILITY_SENSOR_ORIENTATION_VARIABLE,
-    OHOS_FOLD_STATE_SENSOR_ORIENTATION_MAP,
-    OHOS_FOLD_STATE_AND_NATURAL_DIRECTION_SENSOR_ORIENTATION_MAP,
-
-    OHOS_SENSOR_INFO_ACTIVE_ARRAY_SIZE,
-    OHOS_SENSOR_INFO_SENSITIVITY_RANGE,
-    OHOS_SENSOR_INFO_MAX_FRAME_DURATION,
-    OHOS_SENSOR_INFO_PHYSICAL_SIZE,
-    OHOS_SENSOR_INFO_PIXEL_ARRAY_SIZE,
-    OHOS_SENSOR_INFO_TIMESTAMP,
-
-    OHOS_STATISTICS_FACE_DETECT_MODE,
-    OHOS_STATISTICS_FACE_DETECT_SWITCH,
-    OHOS_STATISTICS_FACE_DETECT_MAX_NUM,
-    OHOS_STATISTICS_HISTOGRAM_MODE,
-    OHOS_STATISTICS_FACE_IDS,
-    OHOS_STATISTICS_FACE_LANDMARKS,
-    OHOS_STATISTICS_FACE_RECTANGLES,
-    OHOS_STATISTICS_FACE_SCORES,
-    OHOS_STATISTICS_TIMESTAMP,
-    OHOS_STATISTICS_DETECT_HUMAN_FACE_INFOS,
-    OHOS_STATISTICS_DETECT_HUMAN_BODY_INFOS,
-    OHOS_STATISTICS_DETECT_HUMAN_HEAD_INFOS,
-    OHOS_STATISTICS_DETECT_CAT_FACE_INFOS,
-    OHOS_STATISTICS_DETECT_CAT_BODY_INFOS,
-    OHOS_STATISTICS_DETECT_DOG_FACE_INFOS,
-    OHOS_STATISTICS_DETECT_DOG_BODY_INFOS,
-    OHOS_STATISTICS_DETECT_SALIENT_INFOS,
-    OHOS_STATISTICS_DETECT_BAR_CODE_INFOS,
-    OHOS_STATISTICS_DETECT_BASE_FACE_INFO,
-
-    OHOS_CONTROL_AE_ANTIBANDING_MODE,
-    OHOS_CONTROL_AE_EXPOSURE_COMPENSATION,
-    OHOS_CONTROL_AE_LOCK,
-    OHOS_CONTROL_AE_MODE,
-    OHOS_CONTROL_AE_REGIONS,
-    OHOS_CONTROL_AE_TARGET_FPS_RANGE,
-    OHOS_CONTROL_FPS_RANGES,
-    OHOS_CONTROL_AF_MODE,
-    OHOS_CONTROL_AF_REGIONS,
-    OHOS_CONTROL_AF_TRIGGER,
-    OHOS_CONTROL_AF_TRIGGER_ID,
-    OHOS_CONTROL_AF_STATE,
-    OHOS_CONTROL_AWB_LOCK,
-    OHOS_CONTROL_AWB_MODE,
-    OHOS_CONTROL_AWB_REGIONS,
-    OHOS_CONTROL_AE_AVAILABLE_ANTIBANDING_MODES,
-    OHOS_CONTROL_AE_AVAILABLE_MODES,
-    OHOS_CONTROL_AE_AVAILABLE_TARGET_FPS_RANGES,
-    OHOS_CONTROL_AE_COMPENSATION_RANGE,
-    OHOS_CONTROL_AE_COMPENSATION_STEP,
-    OHOS_ABILITY_AE_COMPENSATION_RANGE,
-    OHOS_ABILITY_AE_COMPENSATION_STEP,
-    OHOS_CONTROL_AF_AVAILABLE_MODES,
-    OHOS_CONTROL_AWB_AVAILABLE_MODES,
-    OHOS_CONTROL_CAPTURE_MIRROR_SUPPORTED,
-    OHOS_CONTROL_CAPTURE_MIRROR,
-    OHOS_CONTROL_FOCUS_STATE,
-    OHOS_CONTROL_METER_POINT,
-    OHOS_CONTROL_METER_MODE,
-    OHOS_CONTROL_EXPOSURE_STATE,
-    OHOS_CONTROL_FOCUSED_POINT,
-    OHOS_CONTROL_NIGHT_MODE_TRY_AE,
-    OHOS_CONTROL_MANUAL_EXPOSURE_TIME,
-    OHOS_STATUS_CAMERA_CURRENT_FPS,
-    OHOS_ABILITY_ISO_VALUES,
-    OHOS_CONTROL_ISO_VALUE,
-    OHOS_STATUS_ISO_VALUE,
-    OHOS_ABILITY_SENSOR_EXPOSURE_TIME_RANGE,
-    OHOS_CONTROL_SENSOR_EXPOSURE_TIME,
-    OHOS_STATUS_SENSOR_EXPOSURE_TIME,
-    OHOS_CONTROL_MOVING_PHOTO,
-    OHOS_ABILITY_SENSOR_WB_VALUES,
-    OHOS_CONTROL_SENSOR_WB_VALUE,
-    OHOS_CONTROL_HIGH_QUALITY_MODE,
-    OHOS_CONTROL_APP_HINT,
-    OHOS_CONTROL_BURST_CAPTURE,
-    OHOS_CONTROL_CAMERA_USED_AS_POSITION,
-    OHOS_CONTROL_CAMERA_SESSION_USAGE,
-    OHOS_CONTROL_EJECT_RETRY,
-    OHOS_CONTROL_FALL_PROTECTION,
-    OHOS_CONTROL_SUN_BLOCK_PREVIEW_TYPE,
-    OHOS_CONTROL_SUN_BLOCK_BLEND_COLOR,
-    OHOS_CONTROL_QUALITY_PRIORITIZATION,
-    OHOS_CONTROL_LOG_ASSISTANCE,
-    OHOS_CONTROL_CAPTURE_ROTATION,
-    OHOS_CONTROL_AUTO_VIDEO_FRAME_RATE,
-    OHOS_ABILITY_AUTO_VIDEO_FRAME_RATE,
-    OHOS_ABILITY_EXTERNAL_CAMERA_LENS_BOOST,
-    OHOS_CONTROL_EXTERNAL_CAMERA_LENS_BOOST,
-    OHOS_ABILITY_PHOTO_QUALITY_PRIORITIZATION,
-    OHOS_CONTROL_PHOTO_QUALITY_PRIORITIZATION,
-    OHOS_CONTROL_REQUEST_CAMERA_SWITCH,
-    OHOS_CONTROL_CAMERA_SWITCH_INFOS,
-    OHOS_CONTROL_REMOVE_SENSOR_RESTRAINT,
-    OHOS_ABILITY_CAMERA_PREVIEW_QUALITY_PRIORITIZATION,
-    OHOS_CONTROL_CAMERA_PREVIEW_QUALITY_PRIORITIZATION,
-    OHOS_ABILITY_IMAGING_MODES,
-    OHOS_CONTROL_IMAGING_MODE,
-    OHOS_ABILITY_GENERATE_ORIGINAL_IMAGE,
-    OHOS_CONTROL_GENERATE_ORIGINAL_IMAGE,
-
-    // Camera device image acquisition related
-    OHOS_ABILITY_DEVICE_AVAILABLE_EXPOSUREMODES,
-    OHOS_CONTROL_EXPOSUREMODE,
-    OHOS_ABILITY_EXPOSURE_MODES,
-    OHOS_CONTROL_EXPOSURE_MODE,
-    OHOS_ABILITY_METER_MODES,
-    OHOS_ABILITY_SCENE_EXPOSURE_MODES,
-    OHOS_ABILITY_EXPOSURE_TIME,
-    OHOS_ABILITY_AE_LOCK,
-
-    OHOS_ABILITY_DEVICE_AVAILABLE_FOCUSMODES,
-    OHOS_CONTROL_FOCUSMODE,
-    OHOS_ABILITY_FOCUS_MODES,
-    OHOS_CONTROL_FOCUS_MODE,
-    OHOS_ABILITY_FOCAL_LENGTH,
-    OHOS_ABILITY_SCENE_FOCUS_MODES,
-    OHOS_ABILITY_FOCUS_ASSIST_FLASH_SUPPORTED_MODES,
-    OHOS_CONTROL_FOCUS_ASSIST_FLASH_SUPPORTED_MODE,
-    OHOS_ABILITY_LENS_INFO_MINIMUM_FOCUS_DISTANCE,
-    OHOS_CONTROL_LENS_FOCUS_DISTANCE,
-    OHOS_ABILITY_EQUIVALENT_FOCUS,
-    OHOS_ABILITY_LENS_EQUIVALENT_FOCUS,
-    OHOS_CONTROL_FOCUS_DISTANCE,
-    OHOS_ABILITY_FOCUS_RANGE_TYPES,
-    OHOS_CONTROL_FOCUS_RANGE_TYPE,
-    OHOS_ABILITY_FOCUS_TRACKING_MODES,
-    OHOS_CONTROL_FOCUS_TRACKING_MODE,
-    OHOS_ABILITY_FOCUS_TRACKING_REGION,
-    OHOS_ABILITY_FOCUS_DRIVEN_TYPES,
-    OHOS_CONTROL_FOCUS_DRIVEN_TYPE,
-    OHOS_ABILITY_FOCUS_TRACKING_MECH_AVAILABLE,
-    OHOS_CONTROL_FOCUS_TRACKING_MECH,
-    OHOS_CONTROL_FOCUS_TRACKING_OBJECT_ID,
-    OHOS_STATUS_FOV_INFOS,
-    OHOS_ABILITY_TYPICAL_SCENE_ZOOM_POINTS,
-    OHOS_ABILITY_LOCK_OBJECT_TRACKING_AVAILABLE,
-    OHOS_CONTROL_LOCK_OBJECT_TRACKING,
-
-    OHOS_ABILITY_DEVICE_AVAILABLE_AWBMODES,
-    OHOS_ABILITY_AWB_MODES,
-    OHOS_ABILITY_AWB_LOCK,
-    OHOS_ABILITY_DEVICE_AVAILABLE_FLASHMODES,
-    OHOS_CONTROL_FLASHMODE,
-    OHOS_ABILITY_FLASH_MODES,
-    OHOS_CONTROL_FLASH_MODE,
-    OHOS_CONTROL_FLASH_STATE,
-    OHOS_ABILITY_SCENE_FLASH_MODES,
-
-    OHOS_ABILITY_ZOOM_RATIO_RANGE,
-    OHOS_CONTROL_ZOOM_RATIO,
-    OHOS_CONTROL_ZOOM_CROP_REGION,
-    OHOS_ABILITY_ZOOM_CAP,
-    OHOS_ABILITY_SCENE_ZOOM_CAP,
-    OHOS_STATUS_CAMERA_CURRENT_ZOOM_RATIO,
-    OHOS_CONTROL_SMOOTH_ZOOM_RATIOS,
-    OHOS_CONTROL_CAMERA_TARGET_ZOOM_RATIO,
-    OHOS_ABILITY_CAMERA_NEED_SET_SMOOTH,
-    OHOS_CONTROL_PREPARE_ZOOM,
-    OHOS_ABILITY_CAMERA_ZOOM_PERFORMANCE,
-    OHOS_STATUS_CAMERA_ZOOM_PERFORMANCE,
-    OHOS_ABILITY_CAMERA_ZOOM_BEZIER_CURVC_POINT,
-    OHOS_CONTROL_ZOOM_CENTER_POINT,
-    OHOS_ABILITY_ZOOM_CENTER_POINT_SUPPORTED,
-
-    // Camera flow control related
-    OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS,
-    OHOS_STREAM_AVAILABLE_FORMATS,
-    OHOS_ABILITY_STREAM_AVAILABLE_EXTEND_CONFIGURATIONS,
-    OHOS_ABILITY_STREAM_QUICK_THUMBNAIL_AVAILABLE,
-    OHOS_ABILITY_PORTRAIT_RESOLUSION,
-    OHOS_ABILITY_SCENE_STREAM_QUICK_THUMBNAIL_AVAILABLE,
-    OHOS_ABILITY_DEFERRED_IMAGE_DELIVERY,
-    OHOS_CONTROL_DEFERRED_IMAGE_DELIVERY,
-    OHOS_ABILITY_PRERECORD,
-    OHOS_CONTROL_PRERECORD_MODE,
-    OHOS_CONTROL_RECORD_STATE,
-    OHOS_STREAM_SUPPLEMENTARY_INFO,
-    OHOS_ABILITY_CHANGETO_OFFLINE_STREAM_OPEATOR,
-    OHOS_CONTROL_CHANGETO_OFFLINE_STREAM_OPEATOR,
-    OHOS_ABILITY_ROTATION_IN_IPS_SUPPORTED,
-    OHOS_ABILITY_BANDWIDTH_COMPRESSION_AVAILABLE,
-    OHOS_CONTROL_BANDWIDTH_COMPRESSION,
-    OHOS_CONTROL_DELAY_ALLOC,
-    OHOS_ABILITY_C2PA_SIGNATURE,
-    OHOS_CONTROL_C2PA_SIGNATURE,
-
-    OHOS_JPEG_GPS_COORDINATES,
-    OHOS_JPEG_GPS_PROCESSING_METHOD,
-    OHOS_JPEG_GPS_TIMESTAMP,
-    OHOS_JPEG_ORIENTATION,
-    OHOS_JPEG_QUALITY,
-    OHOS_JPEG_THUMBNAIL_QUALITY,
-    OHOS_JPEG_THUMBNAIL_SIZE,
-    OHOS_JPEG_AVAILABLE_THUMBNAIL_SIZES,
-    OHOS_JPEG_MAX_SIZE,
-    OHOS_JPEG_SIZE,
-
-    OHOS_ABILITY_VIDEO_STABILIZATION_MODES,
-    OHOS_CONTROL_VIDEO_STABILIZATION_MODE,
-    OHOS_CONTROL_VIDEO_DEBUG_SWITCH,
-    OHOS_CINEMA_VIDEO_KEY_FRAME_TIMESTAMP,
-    OHOS_CINEMA_VIDEO_KEY_FRAME_TYPE,
-
-    // camera effects & algorithms
-    OHOS_ABILITY_SCENE_FILTER_TYPES,
-    OHOS_CONTROL_FILTER_TYPE,
-    OHOS_ABILITY_SCENE_PORTRAIT_EFFECT_TYPES,
-    OHOS_CONTROL_PORTRAIT_EFFECT_TYPE,
-    OHOS_ABILITY_SCENE_BEAUTY_TYPES,
-    OHOS_CONTROL_BEAUTY_TYPE,
-    OHOS_ABILITY_BEAUTY_AUTO_VALUES,
-    OHOS_CONTROL_BEAUTY_AUTO_VALUE,
-    OHOS_ABILITY_BEAUTY_FACE_SLENDER_VALUES,
-    OHOS_CONTROL_BEAUTY_FACE_SLENDER_VALUE,
-    OHOS_ABILITY_BEAUTY_SKIN_TONE_VALUES,
-    OHOS_CONTROL_BEAUTY_SKIN_TONE_VALUE,
-    OHOS_ABILITY_BEAUTY_SKIN_SMOOTH_VALUES,
-    OHOS_CONTROL_BEAUTY_SKIN_SMOOTH_VALUE,
-    OHOS_ABILITY_BEAUTY_SKIN_TONEBRIGHT_VALUES,
-    OHOS_CONTROL_BEAUTY_SKIN_TONEBRIGHT_VALUE,
-    OHOS_ABILITY_BEAUTY_EYE_BIGEYES_VALUES,
-    OHOS_CONTROL_BEAUTY_EYE_BIGEYES_VALUE,
-    OHOS_ABILITY_BEAUTY_HAIR_HAIRLINE_VALUES,
-    OHOS_CONTROL_BEAUTY_HAIR_HAIRLINE_VALUE,
-    OHOS_ABILITY_BEAUTY_FACE_MAKEUP_VALUES,
-    OHOS_CONTROL_BEAUTY_FACE_MAKEUP_VALUE,
-    OHOS_ABILITY_BEAUTY_HEAD_SHRINK_VALUES,
-    OHOS_CONTROL_BEAUTY_HEAD_SHRINK_VALUE,
-    OHOS_ABILITY_BEAUTY_NOSE_SLENDER_VALUES,
-    OHOS_CONTROL_BEAUTY_NOSE_SLENDER_VALUE,
-    OHOS_ABILITY_CAMERA_MACRO_SUPPORTED,
-    OHOS_ABILITY_SCENE_MACRO_CAP,
-    OHOS_CAMERA_MACRO_STATUS,
-    OHOS_CONTROL_CAMERA_MACRO,
-    OHOS_ABILITY_CAMERA_VIRTUAL_APERTURE_RANGE,
-    OHOS_CONTROL_CAMERA_VIRTUAL_APERTURE_VALUE,
-    OHOS_ABILITY_CAMERA_PHYSICAL_APERTURE_RANGE,
-    OHOS_CONTROL_CAMERA_PHYSICAL_APERTURE_VALUE,
-    OHOS_STATUS_CAMERA_APERTURE_VALUE,
-    OHOS_STATUS_CAMERA_CURRENT_APERTURE_EFFECT,
-    OHOS_CONTROL_AUTO_FRAMING_ENABLE,
-    OHOS_DEVICE_EXITCAMERA_EVENT,
-    OHOS_CONTROL_MOTION_DETECTION_CHECK_AREA,
-    OHOS_STATUS_SLOW_MOTION_DETECTION,
-    OHOS_ABILITY_MOTION_DETECTION_SUPPORT,
-    OHOS_CONTROL_MOTION_DETECTION,
-    OHOS_ABILITY_EXPOSURE_HINT_SUPPORTED,
-    OHOS_CONTROL_EXPOSURE_HINT_MODE,
-    OHOS_STATUS_ALGO_MEAN_Y,
-    OHOS_STATUS_PREVIEW_PHYSICAL_CAMERA_ID,
-    OHOS_ABILITY_CAPTURE_EXPECT_TIME,
-    OHOS_ABILITY_EFFECT_SUGGESTION_SUPPORTED,
-    OHOS_CONTROL_EFFECT_SUGGESTION,
-    OHOS_CONTROL_EFFECT_SUGGESTION_DETECTION,
-    OHOS_CAMERA_EFFECT_SUGGESTION_TYPE,
-    OHOS_CONTROL_EFFECT_SUGGESTION_TYPE,
-    OHOS_ABILITY_NIGHT_SUB_MODES,
-    OHOS_CONTROL_NIGHT_SUB_MODE,
-    OHOS_CONTROL_GPS_COORDINATES,
-    OHOS_ABILITY_CONSTELLATION_DRAWING,
-    OHOS_CONTROL_CONSTELLATION_DRAWING_DETECT,
-    OHOS_CONTROL_CONSTELLATION_DRAWING,
-    OHOS_STATUS_CONSTELLATION_DRAWING_DETECT,
-    OHOS_ABILITY_IMAGE_STABILIZATION_GUIDE,
-    OHOS_CONTROL_IMAGE_STABILIZATION_GUIDE,
-    OHOS_STATUS_IMAGE_STABILIZATION_GUIDE,
-    OHOS_ABILITY_AVAILABLE_PROFILE_LEVEL,
-    OHOS_ABILITY_AVAILABLE_PREVIEW_PROFILE,
-    OHOS_ABILITY_AVAILABLE_PHOTO_PROFILE,
-    OHOS_ABILITY_AVAILABLE_VIDEO_PROFILE,
-    OHOS_ABILITY_AVAILABLE_METADATA_PROFILE,
-    OHOS_ABILITY_AVAILABLE_CONFIGURATIONS,
-    OHOS_ABILITY_CONFLICT_CONFIGURATIONS,
-    OHOS_ABILITY_LIGHT_PAINTING_TYPE,
-    OHOS_CONTROL_LIGHT_PAINTING_TYPE,
-    OHOS_CONTROL_LIGHT_PAINTING_FLASH,
-    OHOS_CONTROL_TIME_LAPSE_INTERVAL,
-    OHOS_CONTROL_TIME_LAPSE_TRYAE_STATE,
-    OHOS_STATUS_TIME_LAPSE_PREVIEW_TYPE,
-    OHOS_STATUS_TIME_LAPSE_TRYAE_HINT,
-    OHOS_STATUS_TIME_LAPSE_CAPTURE_INTERVAL,
-    OHOS_STATUS_TIME_LAPSE_TRYAE_DONE,
-    OHOS_CONTROL_TIME_LAPSE_RECORD_STATE,
-    OHOS_CONTROL_TIME_LAPSE_PREVIEW_TYPE,
-    OHOS_ABILITY_TIME_LAPSE_INTERVAL_RANGE,
-    OHOS_ABILITY_LCD_FLASH,
-    OHOS_CONTROL_LCD_FLASH_DETECTION,
-    OHOS_CONTROL_LCD_FLASH,
-    OHOS_STATUS_LCD_FLASH_STATUS,
-    OHOS_ABILITY_DEPTH_DATA_DELIVERY,
-    OHOS_CONTROL_DEPTH_DATA_DELIVERY_SWITCH,
-    OHOS_ABILITY_DEPTH_DATA_PROFILES,
-    OHOS_CONTROL_DEPTH_DATA_ACCURACY,
-    OHOS_ABILITY_CAMERA_IS_RETRACTABLE,
-    OHOS_CONTROL_CAMERA_CLOSE_AFTER_SECONDS,
-    OHOS_ABILITY_CAPTURE_MACRO_DEPTH_FUSION_SUPPORTED,
-    OHOS_ABILITY_CAPTURE_MACRO_DEPTH_FUSION_ZOOM_RANGE,
-    OHOS_CONTROL_CAPTURE_MACRO_DEPTH_FUSION,
-    OHOS_ABILITY_CAMERA_PORTRAIT_THEME_SUPPORTED,
-    OHOS_ABILITY_CAMERA_PORTRAIT_THEME_TYPES,
-    OHOS_CONTROL_CAMERA_PORTRAIT_THEME_TYPE,
-    OHOS_ABILITY_CAMERA_VIDEO_ROTATION_SUPPORTED,
-    OHOS_ABILITY_CAMERA_VIDEO_ROTATION,
-    OHOS_CONTROL_CAMERA_VIDEO_ROTATION,
-    OHOS_MOVING_PHOTO_BUFFER_DURATION,
-    OHOS_MOVING_PHOTO_START,
-    OHOS_MOVING_PHOTO_END,
-    OHOS_SMOOTH_ZOOM_DURATION,
-    OHOS_ABILITY_COLOR_RESERVATION_TYPES,
-    OHOS_CONTROL_COLOR_RESERVATION_TYPE,
-    OHOS_ABILITY_CONTROL_CENTER_SUPPORTED,
-    OHOS_ABILITY_CONTROL_CENTER_EFFECT_TYPE,
-    OHOS_ABILITY_IS_LOGICAL_CAMERA,
-    OHOS_ABILITY_CONSTITUENT_CAMERA_DEVICES,
-    OHOS_ABILITY_LENS_DISTORTION,
-    OHOS_ABILITY_LENS_INTRINSIC_CALIBRATION,
-    OHOS_SENSOR_INFO_COLOR_FILTER_ARRANGEMENT,
-    OHOS_ABILITY_UNSUPPORTED_MULTI_CAMERA_COMBINATIONS,
-    OHOS_ABILITY_CAMERA_MODE_SUPPORTED_STREAMS,
-    OHOS_ABILITY_IS_CAMERA_PUBLIC,
-    OHOS_ABILITY_RAW_CAPTURE_SCENE_ZOOM_CAP,
-
-    // camera secure related
-    OHOS_CONTROL_SECURE_FACE_MODE,
-    OHOS_CONTROL_SECURE_FACE_INFO,
-    OHOS_CONTROL_SECURE_FACE_AUTH_RESULT,
-    OHOS_CONTROL_SECURE_FLASH_SEQ,
-    OHOS_CONTROL_SECURE_IR_LED_SWITCH,
-    OHOS_CONTROL_SECURE_IR_LOCKAE_SWITCH,
-
-    // XMAGE MODES
-    OHOS_ABILITY_SUPPORTED_COLOR_MODES,
-    OHOS_ABILITY_SCENE_SUPPORTED_COLOR_MODES,
-    OHOS_CONTROL_SUPPORTED_COLOR_MODES,
-
-    // COLOR STYLE
-    OHOS_ABILITY_COLOR_STYLE_AVAILABLE,
-    OHOS_ABILITY_COLOR_STYLE_DEFAULT_SETTINGS,
-    OHOS_CONTROL_COLOR_STYLE_SETTING,
-    OHOS_STATUS_COLOR_STYLE_SETTING,
-    OHOS_ABILITY_OUTPUT_COLOR_STYLE_PHOTO_TYPE,
-    OHOS_ABILITY_COLOR_TINT_RANGE,
-    OHOS_CONTROL_COLOR_TINT,
-    OHOS_CONTROL_RGBGAIN_VALUE,
-    OHOS_ABILITY_RGBGAIN_RANGE,
-    OHOS_ABILITY_SATURATION_RANGE,
-    OHOS_CONTROL_SATURATION,
-
-    // BOKEH DELIVERY
-    OHOS_ABILITY_AUTO_MOTION_BOOST_DELIVERY,
-    OHOS_CONTROL_AUTO_MOTION_BOOST_DELIVERY_SWITCH,
-    OHOS_ABILITY_AUTO_BOKEH_DATA_DELIVERY,
-    OHOS_CONTROL_AUTO_BOKEH_DATA_DELIVERY_SWITCH,
-
-    // COMPOSITION
-    OHOS_ABILITY_RECOMMENDED_INFO_LANGUAGE,
-    OHOS_CONTROL_RECOMMENDED_INFO_LANGUAGE,
-    OHOS_ABILITY_COMPOSITION_EFFECT_PREVIEW,
-    OHOS_CONTROL_COMPOSITION_EFFECT_PREVIEW,
-    OHOS_ABILITY_COMPOSITION_RECOMMENDED_PICTURE_SIZE,
-
-    // OPTICAL_IMAGE_STABILIZATION
-    OHOS_ABILITY_OPTICAL_IMAGE_STABILIZATION_MODES,
-    OHOS_CONTROL_OPTICAL_IMAGE_STABILIZATION_MODE,
-    OHOS_STATUS_OPTICAL_IMAGE_STABILIZATION_MODE,
-    OHOS_ABILITY_OPTICAL_IMAGE_STABILIZATION_BIAS_RANGE,
-    OHOS_CONTROL_SET_CUSTOM_OPTICAL_IMAGE_STABILIZATION_BIAS,
-};
-
-std::map<uint32_t, uint32_t> g_metadataSectionMap = {
-    {OHOS_CAMERA_PROPERTIES, OHOS_SECTION_CAMERA_PROPERTIES},
-    {OHOS_CAMERA_SENSOR, OHOS_SECTION_CAMERA_SENSOR},
-    {OHOS_CAMERA_SENSOR_INFO, OHOS_SECTION_CAMERA_SENSOR_INFO},
-    {OHOS_CAMERA_STATISTICS, OHOS_SECTION_CAMERA_STATISTICS},
-    {OHOS_DEVICE_CONTROL, OHOS_SECTION_CAMERA_CONTROL},
-    {OHOS_DEVICE_EXPOSURE, OHOS_SECTION_DEVICE_EXPOSURE},
-    {OHOS_DEVICE_FOCUS, OHOS_SECTION_DEVICE_FOCUS},
-    {OHOS_DEVICE_WHITE_BLANCE, OHOS_SECTION_DEVICE_WHITE},
-    {OHOS_DEVICE_FLASH, OHOS_SECTION_DEVICE_FLASH},
-    {OHOS_DEVICE_ZOOM, OHOS_SECTION_DEVICE_ZOOM},
-    {OHOS_STREAM_ABILITY, OHOS_SECTION_STREAM_ABILITY},
-    {OHOS_STREAM_JPEG, OHOS_SECTION_STREAM_JPEG},
-    {OHOS_STREAM_VIDEO, OHOS_SECTION_STREAM_VIDEO},
-    {OHOS_STREAM_PHOTO_STITCHING, OHOS_SECTION_STREAM_PHOTO_STITCHING},
-    {OHOS_CAMERA_EFFECT, OHOS_SECTION_CAMERA_EFFECT},
-    {OHOS_CAMERA_SECURE, OHOS_SECTION_CAMERA_SECURE},
-    {OHOS_XMAGE_COLOR_ABILITY, OHOS_SECTION_CAMERA_XMAGE},
-    {OHOS_STREAM_CONTROL, OHOS_SECTION_STREAM_CONTROL},
-    {OHOS_COMPOSITION_SUGGESTION, OHOS_SECTION_COMPOSITION_SUGGESTION},
-    {OHOS_LIGHT_STATUS, OHOS_SECTION_LIGHT_STATUS},
-    {OHOS_DATA_DELIVERY, OHOS_SECTION_DATA_DELIVERY},
-    {OHOS_OPTICAL_IMAGE_STABILIZATION, OHOS_SECTION_OPTICAL_IMAGE_STABILIZATION},
-};
-
-std::map<uint32_t, uint32_t> g_itemDataTypeMap {
+const size_t DUMP_ITEM_RESERVE_LENGTH = 128;
+// Items whose data type is checked when unmarshalled from a parcel
+constexpr struct {
+    uint32_t item;
+    uint32_t dataType;
+} g_itemDataTypes[] = {
     { OHOS_ABILITY_STREAM_AVAILABLE_BASIC_CONFIGURATIONS, META_TYPE_INT32 },
     { OHOS_ABILITY_STREAM_AVAILABLE_EXTEND_CONFIGURATIONS, META_TYPE_INT32 },
     { OHOS_SENSOR_INFO_MAX_FRAME_DURATION, META_TYPE_INT64 },
@@ -532,12 +64,75 @@ CameraMetadata::CameraMetadata(size_t itemCapacity, size_t dataCapacity)
     }
 }
 
+CameraMetadata::CameraMetadata(size_t itemCapacity, size_t dataCapacity,
+    std::shared_ptr<CameraMetadataAllocator> allocator)
+    : allocator_(std::move(allocator))
+{
+    metadata_ = allocate_metadata(itemCapacity, AlignTo(dataCapacity, DATA_ALIGNMENT), allocSize_);
+    if (metadata_ == nullptr) {
+        METADATA_ERR_LOG("CameraMetadata: allocate_metadata failed, itemCapacity: %{public}zu,"
+                         "dataCapacity: %{public}zu", itemCapacity, dataCapacity);
+    }
+}
+
+CameraMetadata::CameraMetadata(common_metadata_header_t *mappedMetadata, void *mapBase, size_t mapSize)
+    : metadata_(mappedMetadata), mapBase_(mapBase), mapSize_(mapSize)
+{
+    stamp_.contentHash = CalculateCameraMetadataContentHash(metadata_);
+}
+
 CameraMetadata::~CameraMetadata()
 {
-    std::lock_guard<std::mutex> lockGuard(g_mtx);
-    if (metadata_) {
-        FreeCameraMetadataBuffer(metadata_);
-        metadata_ = nullptr;
+    release_metadata();
+}
+
+void CameraMetadata::release_metadata()
+{
+    if (mapBase_ != nullptr) {
+        munmap(mapBase_, mapSize_);
+        mapBase_ = nullptr;
+        mapSize_ = 0;
+    } else if (metadata_ != nullptr) {
+        free_metadata(metadata_, allocSize_);
+    }
+    metadata_ = nullptr;
+    allocSize_ = 0;
+}
+
+common_metadata_header_t *CameraMetadata::allocate_metadata(uint32_t itemCapacity, uint32_t dataCapacity,
+    size_t &allocSize)
+{
+    allocSize = 0;
+    if (allocator_ == nullptr) {
+        return AllocateCameraMetadataBuffer(itemCapacity, dataCapacity);
+    }
+    if (itemCapacity > MAX_ITEM_CAPACITY || dataCapacity > MAX_DATA_CAPACITY) {
+        METADATA_ERR_LOG("allocate_metadata invalid itemCapacity or dataCapacity");
+        return nullptr;
+    }
+    size_t memoryRequired = CalculateCameraMetadataMemoryRequired(itemCapacity, dataCapacity);
+    void *buffer = allocator_->Allocate(memoryRequired);
+    if (buffer == nullptr) {
+        return nullptr;
+    }
+    common_metadata_header_t *metadataHeader = FillCameraMetadata(reinterpret_cast<common_metadata_header_t *>(buffer),
+        memoryRequired, itemCapacity, dataCapacity);
+    if (metadataHeader == nullptr) {
+        allocator_->Release(buffer, memoryRequired);
+        return nullptr;
+    }
+    allocSize = memoryRequired;
+    return metadataHeader;
+}
+
+void CameraMetadata::free_metadata(common_metadata_header_t *metadata, size_t allocSize)
+{
+    if (allocator_ == nullptr) {
+        FreeCameraMetadataBuffer(metadata);
+        return;
+    }
+    if (metadata != nullptr) {
+        allocator_->Release(metadata, allocSize);
     }
 }
 
@@ -548,7 +143,7 @@ bool CameraMetadata::addEntry(uint32_t item, const void *data, size_t data_count
         return false;
     }
 
-    auto result = AddCameraMetadataItem(metadata_, item, data, data_count);
+    auto result = AddCameraMetadataItem(metadata_, item, data, data_count, &stamp_);
     if (!result) {
         return true;
     }
@@ -567,13 +162,50 @@ bool CameraMetadata::addEntry(uint32_t item, const void *data, size_t data_count
     return resize_add_metadata(item, data, data_count);
 }
 
+uint32_t CameraMetadata::GrowCapacity(uint32_t capacity, uint64_t required, uint32_t minIncrement,
+    uint32_t maxCapacity) const
+{
+    constexpr uint64_t percent = 100;
+    uint64_t grown = static_cast<uint64_t>(capacity) * growthPolicy_.growthFactorPercent / percent;
+    grown = std::max(grown, static_cast<uint64_t>(capacity) + minIncrement);
+    grown = std::max(grown, required);
+    return static_cast<uint32_t>(std::min(grown, static_cast<uint64_t>(maxCapacity)));
+}
+
+bool CameraMetadata::resize_metadata(uint32_t itemCapacity, uint32_t dataCapacity)
+{
+    if (itemCapacity < metadata_->item_count || dataCapacity < metadata_->data_count) {
+        METADATA_ERR_LOG("resize_metadata capacity is less than the used size");
+        return false;
+    }
+
+    size_t allocSize = 0;
+    common_metadata_header_t *newMetadata =
+        allocate_metadata(itemCapacity, AlignTo(dataCapacity, DATA_ALIGNMENT), allocSize);
+    if (newMetadata == nullptr) {
+        METADATA_ERR_LOG("Failed to resize the metadata buffer");
+        return false;
+    }
+
+    uint64_t copyStartTime = METADATA_PROFILE_TIME();
+    auto result = CopyCameraMetadataItems(newMetadata, metadata_);
+    if (result != CAM_META_SUCCESS) {
+        METADATA_ERR_LOG("Failed to copy the old metadata to new metadata");
+        free_metadata(newMetadata, allocSize);
+        newMetadata = nullptr;
+        return false;
+    }
+    METADATA_PROFILE_RESIZE(sizeof(camera_metadata_item_entry_t) * metadata_->item_count + metadata_->data_count,
+        copyStartTime);
+    replace_metadata(newMetadata, allocSize);
+
+    return true;
+}
+
 bool CameraMetadata::resize_add_metadata(uint32_t item, const void *data, size_t data_count)
 {
     uint32_t data_type;
 
-    auto itemCapacity = GetCameraMetadataItemCapacity(metadata_);
-    auto data_capacity = GetCameraMetadataDataSize(metadata_);
-
     int32_t ret = GetCameraMetadataItemType(item, &data_type);
     if (ret != CAM_META_SUCCESS) {
         METADATA_ERR_LOG("GetCameraMetadataItemType invalid item type");
@@ -585,45 +217,173 @@ bool CameraMetadata::resize_add_metadata(uint32_t item, const void *data, size_t
         return false;
     }
 
-    common_metadata_header_t *newMetadata = AllocateCameraMetadataBuffer((itemCapacity + 1) * INDEX_COUNTER,
-        AlignTo((data_capacity + size) * INDEX_COUNTER, DATA_ALIGNMENT));
-
-    if (newMetadata == nullptr) {
-        METADATA_ERR_LOG("Failed to resize the metadata buffer");
+    // Grow geometrically so that adding entries one by one does not copy the whole buffer every time
+    uint32_t itemCapacity = GrowCapacity(metadata_->item_capacity, static_cast<uint64_t>(metadata_->item_count) + 1,
+        growthPolicy_.minItemIncrement, MAX_ITEM_CAPACITY);
+    uint32_t dataCapacity = GrowCapacity(metadata_->data_capacity,
+        static_cast<uint64_t>(metadata_->data_count) + static_cast<uint32_t>(size),
+        growthPolicy_.minDataIncrement, MAX_DATA_CAPACITY);
+    METADATA_PROFILE_TAG_OP(item, METADATA_PROFILE_OP_RESIZE);
+    if (!resize_metadata(itemCapacity, dataCapacity)) {
         return false;
     }
 
-    auto result = CopyCameraMetadataItems(newMetadata, metadata_);
+    auto result = AddCameraMetadataItem(metadata_, item, data, data_count, &stamp_);
     if (result != CAM_META_SUCCESS) {
-        METADATA_ERR_LOG("Failed to copy the old metadata to new metadata");
-        FreeCameraMetadataBuffer(newMetadata);
-        newMetadata = nullptr;
+        METADATA_ERR_LOG("Failed to add new entry");
         return false;
     }
 
-    result = AddCameraMetadataItem(newMetadata, item, data, data_count);
-    if (result != CAM_META_SUCCESS) {
-        METADATA_ERR_LOG("Failed to add new entry");
-        FreeCameraMetadataBuffer(newMetadata);
-        newMetadata = nullptr;
+    return true;
+}
+
+bool CameraMetadata::reserve(size_t itemCapacity, size_t dataCapacity)
+{
+    if (metadata_ == nullptr) {
+        METADATA_ERR_LOG("metadata_ is null");
+        return false;
+    }
+
+    if (itemCapacity > MAX_ITEM_CAPACITY || dataCapacity > MAX_DATA_CAPACITY) {
+        METADATA_ERR_LOG("reserve invalid itemCapacity: %{public}zu or dataCapacity: %{public}zu",
+            itemCapacity, dataCapacity);
+        return false;
+    }
+
+    if (itemCapacity <= metadata_->item_capacity && dataCapacity <= metadata_->data_capacity) {
+        return true;
+    }
+
+    return resize_metadata(std::max(static_cast<uint32_t>(itemCapacity), metadata_->item_capacity),
+        std::max(static_cast<uint32_t>(dataCapacity), metadata_->data_capacity));
+}
+
+bool CameraMetadata::shrink_to_fit()
+{
+    if (metadata_ == nullptr) {
+        METADATA_ERR_LOG("metadata_ is null");
         return false;
     }
-    replace_metadata(newMetadata);
 
+    if (metadata_->item_count == metadata_->item_capacity && metadata_->data_count == metadata_->data_capacity) {
+        return true;
+    }
+
+    return resize_metadata(metadata_->item_count, metadata_->data_count);
+}
+
+void CameraMetadata::setGrowthPolicy(const CameraMetadataGrowthPolicy &policy)
+{
+    growthPolicy_ = policy;
+}
+
+static bool IsSameItemData(const camera_metadata_item_t &lhs, const camera_metadata_item_t &rhs)
+{
+    if (lhs.data_type != rhs.data_type || lhs.count != rhs.count || lhs.data_type >= META_NUM_TYPES) {
+        return false;
+    }
+    return memcmp(lhs.data.u8, rhs.data.u8, lhs.count * OHOS_CAMERA_METADATA_TYPE_SIZE[lhs.data_type]) == 0;
+}
+
+bool CameraMetadata::diff(const CameraMetadata &base, CameraMetadata &changed,
+    std::vector<uint32_t> &deletedTags) const
+{
+    deletedTags.clear();
+    if (metadata_ == nullptr || base.metadata_ == nullptr || changed.metadata_ == nullptr) {
+        METADATA_ERR_LOG("diff metadata is null");
+        return false;
+    }
+
+    // Index base by tag once instead of searching it for every entry
+    std::vector<std::pair<uint32_t, uint32_t>> baseIndex;
+    camera_metadata_item_entry_t *baseItems = GetMetadataItems(base.metadata_);
+    if (baseItems == nullptr) {
+        return false;
+    }
+    baseIndex.reserve(base.metadata_->item_count);
+    for (uint32_t i = 0; i < base.metadata_->item_count; i++) {
+        baseIndex.emplace_back(baseItems[i].item, i);
+    }
+    std::sort(baseIndex.begin(), baseIndex.end());
+    std::vector<bool> baseMatched(baseIndex.size(), false);
+
+    for (uint32_t i = 0; i < metadata_->item_count; i++) {
+        camera_metadata_item_t item;
+        if (GetCameraMetadataItem(metadata_, i, &item) != CAM_META_SUCCESS) {
+            return false;
+        }
+        auto iter = std::lower_bound(baseIndex.begin(), baseIndex.end(), std::make_pair(item.item, 0U));
+        if (iter != baseIndex.end() && iter->first == item.item) {
+            baseMatched[iter - baseIndex.begin()] = true;
+            camera_metadata_item_t baseItem;
+            if (GetCameraMetadataItem(base.metadata_, iter->second, &baseItem) == CAM_META_SUCCESS &&
+                IsSameItemData(item, baseItem)) {
+                continue;
+            }
+        }
+        if (!changed.addEntry(item.item, item.data.u8, item.count)) {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < baseIndex.size(); i++) {
+        if (!baseMatched[i]) {
+            deletedTags.push_back(baseIndex[i].first);
+        }
+    }
+    return true;
+}
+
+bool CameraMetadata::patch(const CameraMetadata &changed, const std::vector<uint32_t> &deletedTags)
+{
+    if (metadata_ == nullptr || changed.metadata_ == nullptr) {
+        METADATA_ERR_LOG("patch metadata is null");
+        return false;
+    }
+
+    // Work on a copy so that a delta failing halfway leaves this metadata untouched
+    CameraMetadata patched(metadata_->item_capacity, metadata_->data_capacity, allocator_);
+    if (!patched.isValid() || CopyCameraMetadataItems(patched.metadata_, metadata_) != CAM_META_SUCCESS) {
+        METADATA_ERR_LOG("patch copy failed");
+        return false;
+    }
+    patched.stamp_ = stamp_;
+    patched.growthPolicy_ = growthPolicy_;
+
+    int ret = DeleteCameraMetadataItems(patched.metadata_, deletedTags.data(),
+        static_cast<uint32_t>(deletedTags.size()), &patched.stamp_);
+    if (ret != CAM_META_SUCCESS) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < changed.metadata_->item_count; i++) {
+        camera_metadata_item_t item;
+        if (GetCameraMetadataItem(changed.metadata_, i, &item) != CAM_META_SUCCESS) {
+            return false;
+        }
+        bool ret = IsCameraMetadataItemExist(patched.metadata_, item.item) ?
+            patched.updateEntry(item.item, item.data.u8, item.count) :
+            patched.addEntry(item.item, item.data.u8, item.count);
+        if (!ret) {
+            return false;
+        }
+    }
+
+    replace_metadata(patched.metadata_, patched.allocSize_);
+    patched.metadata_ = nullptr;
+    stamp_ = patched.stamp_;
     return true;
 }
 
-void CameraMetadata::replace_metadata(common_metadata_header_t *newMetadata)
+void CameraMetadata::replace_metadata(common_metadata_header_t *newMetadata, size_t allocSize)
 {
     if (metadata_ == newMetadata) {
         return;
     }
 
-    std::lock_guard<std::mutex> lockGuard(g_mtx);
-    if (metadata_ != nullptr) {
-        FreeCameraMetadataBuffer(metadata_);
-    }
+    release_metadata();
     metadata_ = newMetadata;
+    allocSize_ = allocSize;
 }
 
 bool CameraMetadata::updateEntry(uint32_t tag, const void *data, size_t dataCount)
@@ -643,7 +403,15 @@ bool CameraMetadata::updateEntry(uint32_t tag, const void *data, size_t dataCoun
     }
     METADATA_DEBUG_LOG("updateEntry item id: %{public}d, name: %{public}s, dataCount: %{public}zu",
         tag, name ? name : "<unknown>", dataCount);
-    ret = UpdateCameraMetadataItemByIndex(metadata_, item.index, data, dataCount, nullptr);
+    ret = UpdateCameraMetadataItemByIndex(metadata_, item.index, data, dataCount, nullptr, &stamp_);
+    if (ret == CAM_META_DATA_CAP_EXCEED) {
+        int32_t size = CalculateCameraMetadataItemDataSize(item.data_type, dataCount);
+        if (size != CAM_META_FAILURE && resize_metadata(metadata_->item_capacity,
+            GrowCapacity(metadata_->data_capacity, static_cast<uint64_t>(metadata_->data_count) + size,
+                growthPolicy_.minDataIncrement, MAX_DATA_CAPACITY))) {
+            ret = UpdateCameraMetadataItemByIndex(metadata_, item.index, data, dataCount, nullptr, &stamp_);
+        }
+    }
     if (ret) {
         const char *name_ = GetCameraMetadataItemName(tag);
         (void)name_;
@@ -654,6 +422,69 @@ bool CameraMetadata::updateEntry(uint32_t tag, const void *data, size_t dataCoun
     return true;
 }
 
+bool CameraMetadata::deleteEntry(uint32_t item)
+{
+    if (metadata_ == nullptr) {
+        METADATA_ERR_LOG("metadata_ is null");
+        return false;
+    }
+    if (!IsCameraMetadataItemExist(metadata_, item)) {
+        const char *name = GetCameraMetadataItemName(item);
+        (void)name;
+        METADATA_ERR_LOG("Failed to delete tag tagname = %{public}s : not present", (name ? name : "<unknown>"));
+        return false;
+    }
+    return deleteEntries(&item, 1);
+}
+
+bool CameraMetadata::deleteEntries(const uint32_t *items, uint32_t itemCount)
+{
+    if (metadata_ == nullptr) {
+        METADATA_ERR_LOG("metadata_ is null");
+        return false;
+    }
+    int ret = DeleteCameraMetadataItems(metadata_, items, itemCount, &stamp_);
+    if (ret != CAM_META_SUCCESS) {
+        METADATA_ERR_LOG("Failed to delete %{public}u tags, ret = %{public}d", itemCount, ret);
+        return false;
+    }
+    return true;
+}
+
+const void *CameraMetadata::getEntryData(uint32_t item, uint32_t dataType, size_t &count) const
+{
+    count = 0;
+    camera_metadata_item_t entry;
+    if (metadata_ == nullptr || FindCameraMetadataItem(metadata_, item, &entry) != CAM_META_SUCCESS) {
+        return nullptr;
+    }
+    if (entry.data_type != dataType) {
+        METADATA_ERR_LOG("getEntryData item %{public}u type %{public}u is not %{public}u",
+            item, entry.data_type, dataType);
+        return nullptr;
+    }
+    count = entry.count;
+    return entry.data.u8;
+}
+
+bool CameraMetadata::setEntry(uint32_t item, uint32_t dataType, const void *data, size_t dataCount)
+{
+    if (metadata_ == nullptr) {
+        METADATA_ERR_LOG("metadata_ is null");
+        return false;
+    }
+    uint32_t itemType = META_NUM_TYPES;
+    if (GetCameraMetadataItemType(item, &itemType) != CAM_META_SUCCESS || itemType != dataType) {
+        METADATA_ERR_LOG("setEntry item %{public}u type %{public}u is not %{public}u", item, itemType, dataType);
+        return false;
+    }
+    uint32_t index = 0;
+    if (FindCameraMetadataItemIndex(metadata_, item, &index) == CAM_META_SUCCESS) {
+        return updateEntry(item, data, dataCount);
+    }
+    return addEntry(item, data, dataCount);
+}
+
 common_metadata_header_t *CameraMetadata::get()
 {
     return metadata_;
@@ -669,6 +500,30 @@ bool CameraMetadata::isValid() const
     return metadata_ != nullptr;
 }
 
+bool CameraMetadata::isMapped() const
+{
+    return mapBase_ != nullptr;
+}
+
+uint32_t CameraMetadata::GetGeneration() const
+{
+    return stamp_.generation;
+}
+
+uint64_t CameraMetadata::GetContentHash() const
+{
+    return stamp_.contentHash;
+}
+
+void CameraMetadata::RecalculateContentHash()
+{
+    if (metadata_ == nullptr) {
+        return;
+    }
+    stamp_.contentHash = CalculateCameraMetadataContentHash(metadata_);
+    stamp_.generation++;
+}
+
 bool CameraMetadata::Marshalling(Parcel &parcel) const
 {
     return MetadataUtils::WriteCameraMetadata(metadata_, static_cast<MessageParcel&>(parcel));
@@ -677,6 +532,9 @@ bool CameraMetadata::Marshalling(Parcel &parcel) const
 CameraMetadata* CameraMetadata::Unmarshalling(Parcel &parcel)
 {
     uint32_t tagCount = parcel.ReadUint32();
+    if (tagCount == METADATA_BLOB_MAGIC) {
+        return MetadataUtils::ReadCameraMetadataBlob(static_cast<MessageParcel&>(parcel)).release();
+    }
     uint32_t itemCapacity = parcel.ReadUint32();
     uint32_t dataCapacity = parcel.ReadUint32();
 
@@ -700,6 +558,7 @@ CameraMetadata* CameraMetadata::Unmarshalling(Parcel &parcel)
         return nullptr;
     }
     MetadataUtils::ReadCameraMetadata(static_cast<MessageParcel&>(parcel), metadata->get(), tagCount);
+    metadata->RecalculateContentHash();
 
     return metadata;
 }
@@ -779,10 +638,10 @@ size_t CameraMetadata::CalculateCameraMetadataMemoryRequired(uint32_t itemCount,
     size_t memoryRequired = sizeof(common_metadata_header_t);
     memoryRequired = CameraMetadata::AlignTo(memoryRequired, ITEM_ALIGNMENT);
 
-    memoryRequired += sizeof(camera_metadata_item_entry_t[itemCount]);
+    memoryRequired += sizeof(camera_metadata_item_entry_t) * itemCount;
     memoryRequired = CameraMetadata::AlignTo(memoryRequired, DATA_ALIGNMENT);
 
-    memoryRequired += sizeof(uint8_t[dataCount]);
+    memoryRequired += sizeof(uint8_t) * dataCount;
     memoryRequired = CameraMetadata::AlignTo(memoryRequired, METADATA_PACKET_ALIGNMENT);
 
     METADATA_DEBUG_LOG("CalculateCameraMetadataMemoryRequired memoryRequired: %{public}zu", memoryRequired);
@@ -858,6 +717,100 @@ int32_t LoadVendorTagImpl()
     return CAM_META_SUCCESS;
 }
 
+// Immutable snapshot of the vendor tags, published once and then read without locking
+struct VendorTagTable {
+    struct Entry {
+        std::string name;
+        uint32_t type;
+    };
+    std::unordered_map<uint32_t, Entry> tags;
+    // False for the empty table published while the provider fails to load
+    bool loaded = false;
+};
+
+static std::atomic<const VendorTagTable *> g_vendorTagTable = nullptr;
+static std::mutex g_vendorTagTableMtx;
+// Names handed out by GetCameraMetadataItemName point into the tables, so replaced ones are kept alive
+static std::vector<std::unique_ptr<const VendorTagTable>> g_vendorTagTables;
+// A failed load is retried by the next lookup after this steady clock time, the delay doubles up to the max
+static std::atomic<int64_t> g_vendorTagRetryTimeMs = 0;
+static int64_t g_vendorTagRetryDelayMs = 0;
+constexpr int64_t VENDOR_TAG_RETRY_MIN_DELAY_MS = 100;
+constexpr int64_t VENDOR_TAG_RETRY_MAX_DELAY_MS = 5000;
+
+static int64_t SteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool NeedBuildVendorTagTable(const VendorTagTable *table)
+{
+    return table == nullptr ||
+        (!table->loaded && SteadyTimeMs() >= g_vendorTagRetryTimeMs.load(std::memory_order_relaxed));
+}
+
+static int32_t BuildVendorTagTableLocked()
+{
+    std::vector<vendorTag_t> tagVec;
+    int32_t ret = CameraMetadata::GetAllVendorTags(tagVec);
+    if (ret != CAM_META_SUCCESS) {
+        METADATA_ERR_LOG("BuildVendorTagTable GetAllVendorTags failed");
+        // Misses are answered by an empty table until the next retry, the provider is not asked per tag
+        if (g_vendorTagTable.load(std::memory_order_relaxed) == nullptr) {
+            auto empty = std::make_unique<VendorTagTable>();
+            g_vendorTagTable.store(empty.get(), std::memory_order_release);
+            g_vendorTagTables.push_back(std::move(empty));
+        }
+        g_vendorTagRetryDelayMs = std::clamp(g_vendorTagRetryDelayMs * 2,
+            VENDOR_TAG_RETRY_MIN_DELAY_MS, VENDOR_TAG_RETRY_MAX_DELAY_MS);
+        g_vendorTagRetryTimeMs.store(SteadyTimeMs() + g_vendorTagRetryDelayMs, std::memory_order_relaxed);
+        return ret;
+    }
+    g_vendorTagRetryDelayMs = 0;
+
+    auto table = std::make_unique<VendorTagTable>();
+    table->loaded = true;
+    table->tags.reserve(tagVec.size());
+    for (const auto &tag : tagVec) {
+        table->tags.emplace(tag.tagId,
+            VendorTagTable::Entry { tag.tagName != nullptr ? tag.tagName : "", tag.tagType });
+    }
+    g_vendorTagTable.store(table.get(), std::memory_order_release);
+    g_vendorTagTables.push_back(std::move(table));
+    return CAM_META_SUCCESS;
+}
+
+// providerLoaded tells whether a tag missing from the table is worth asking the provider for
+static const VendorTagTable::Entry *FindVendorTag(uint32_t item, bool &providerLoaded)
+{
+    const VendorTagTable *table = g_vendorTagTable.load(std::memory_order_acquire);
+    if (NeedBuildVendorTagTable(table)) {
+        std::lock_guard<std::mutex> lock(g_vendorTagTableMtx);
+        table = g_vendorTagTable.load(std::memory_order_acquire);
+        if (NeedBuildVendorTagTable(table)) {
+            (void)BuildVendorTagTableLocked();
+            table = g_vendorTagTable.load(std::memory_order_acquire);
+        }
+    }
+    providerLoaded = table->loaded;
+    auto iter = table->tags.find(item);
+    return iter != table->tags.end() ? &iter->second : nullptr;
+}
+
+int32_t CameraMetadata::RefreshVendorTagTable()
+{
+    std::lock_guard<std::mutex> lock(g_vendorTagTableMtx);
+    {
+        std::lock_guard<std::mutex> implLock(g_vendorTagImplMtx);
+#ifdef CAMERA_VENDOR_TAG
+        // Reconnect so that a restarted or replaced vendor tag service is picked up
+        g_cameraVendorTagService = nullptr;
+#endif
+    }
+    return BuildVendorTagTableLocked();
+}
+
 int32_t CameraMetadata::GetMetadataSection(uint32_t itemSection, uint32_t *section)
 {
     METADATA_DEBUG_LOG("GetMetadataSection start");
@@ -873,9 +826,11 @@ int32_t CameraMetadata::GetMetadataSection(uint32_t itemSection, uint32_t *secti
     }
 
     int32_t ret = CAM_META_SUCCESS;
-    auto iter = g_metadataSectionMap.find(itemSection);
-    if (iter != g_metadataSectionMap.end()) {
-        *section = iter->second;
+    uint32_t slot = itemSection & ((1 << METADATA_SECTION_GROUP_SHIFT) - 1);
+    uint8_t index = (slot < METADATA_SECTION_GROUP_SLOTS) ?
+        g_ohosSectionIndex.section[itemSection >> METADATA_SECTION_GROUP_SHIFT][slot] : METADATA_SECTION_INVALID;
+    if (index != METADATA_SECTION_INVALID) {
+        *section = index;
     } else {
         METADATA_ERR_LOG("GetMetadataSection item section is not defined");
         ret = CAM_META_FAILURE;
@@ -895,6 +850,15 @@ int32_t CameraMetadata::GetCameraMetadataItemType(uint32_t item, uint32_t *dataT
     uint32_t section;
     uint32_t itemTag = item >> BITWISE_SHIFT_16;
     if (itemTag >= OHOS_VENDOR_SECTION) {
+        bool providerLoaded = false;
+        const VendorTagTable::Entry *vendorTag = FindVendorTag(item, providerLoaded);
+        if (vendorTag != nullptr) {
+            *dataType = vendorTag->type;
+            return CAM_META_SUCCESS;
+        }
+        if (!providerLoaded) {
+            return CAM_META_FAILURE;
+        }
         int32_t ret = LoadVendorTagImpl();
         if (ret != CAM_META_SUCCESS) {
             METADATA_ERR_LOG("LoadVendorTagImpl failed");
@@ -920,18 +884,14 @@ int32_t CameraMetadata::GetCameraMetadataItemType(uint32_t item, uint32_t *dataT
         return ret;
     }
 
-    if (item >= g_ohosCameraSectionBounds[section][1]) {
+    const metadata_section_desc_t &desc = g_ohosSectionDescs[section];
+    if (item >= desc.end) {
         METADATA_ERR_LOG("GetCameraMetadataItemType item is not in section bound");
         return CAM_META_FAILURE;
     }
 
-    uint32_t itemIndex = item & 0xFFFF;
-    if (g_ohosItemInfo[section][itemIndex].item_type < META_TYPE_BYTE) {
-        METADATA_ERR_LOG("GetCameraMetadataItemType item is not initialized");
-        return CAM_META_FAILURE;
-    }
-
-    *dataType = g_ohosItemInfo[section][itemIndex].item_type;
+    // The generated tables hold a valid type for every tag of the section, see IsMetadataItemTableValid
+    *dataType = desc.itemInfo[item & 0xFFFF].item_type;
 
     METADATA_DEBUG_LOG("GetCameraMetadataItemType end");
     return CAM_META_SUCCESS;
@@ -944,6 +904,14 @@ const char *CameraMetadata::GetCameraMetadataItemName(uint32_t item)
     uint32_t section;
     uint32_t itemTag = item >> BITWISE_SHIFT_16;
     if (itemTag >= OHOS_VENDOR_SECTION) {
+        bool providerLoaded = false;
+        const VendorTagTable::Entry *vendorTag = FindVendorTag(item, providerLoaded);
+        if (vendorTag != nullptr) {
+            return vendorTag->name.c_str();
+        }
+        if (!providerLoaded) {
+            return nullptr;
+        }
         int32_t ret = LoadVendorTagImpl();
         if (ret != CAM_META_SUCCESS) {
             METADATA_ERR_LOG("LoadVendorTagImpl failed");
@@ -964,14 +932,30 @@ const char *CameraMetadata::GetCameraMetadataItemName(uint32_t item)
         return nullptr;
     }
 
-    if (item >= g_ohosCameraSectionBounds[section][1]) {
+    const metadata_section_desc_t &desc = g_ohosSectionDescs[section];
+    if (item >= desc.end) {
         METADATA_ERR_LOG("GetCameraMetadataItemName item is not in section bound");
         return nullptr;
     }
 
     uint32_t itemIndex = item & 0xFFFF;
     METADATA_DEBUG_LOG("GetCameraMetadataItemName end");
-    return g_ohosItemInfo[section][itemIndex].item_name;
+    return desc.itemInfo[itemIndex].item_name;
+}
+
+int32_t CameraMetadata::GetCameraMetadataItemTagByName(const char *name, uint32_t *item)
+{
+    if (name == nullptr || item == nullptr) {
+        METADATA_ERR_LOG("GetCameraMetadataItemTagByName name or item is null");
+        return CAM_META_INVALID_PARAM;
+    }
+    const metadata_item_name_t *itemName = FindMetadataItemName(name);
+    if (itemName == nullptr) {
+        METADATA_ERR_LOG("GetCameraMetadataItemTagByName unknown item name %{public}s", name);
+        return CAM_META_ITEM_NOT_FOUND;
+    }
+    *item = itemName->item;
+    return CAM_META_SUCCESS;
 }
 
 int32_t CameraMetadata::CalculateCameraMetadataItemDataSize(uint32_t type, size_t dataCount)
@@ -1029,8 +1013,46 @@ int CameraMetadata::AddCameraMetadataItemVerify(common_metadata_header_t *dst,
     return CAM_META_SUCCESS;
 }
 
+static bool ItemEntryTagLess(const camera_metadata_item_entry_t &entry, uint32_t item)
+{
+    return entry.item < item;
+}
+
+static bool TagItemEntryLess(uint32_t item, const camera_metadata_item_entry_t &entry)
+{
+    return item < entry.item;
+}
+
+static bool ItemEntryLess(const camera_metadata_item_entry_t &lhs, const camera_metadata_item_entry_t &rhs)
+{
+    return lhs.item < rhs.item;
+}
+
+// The new entry has been written just past the sorted range, shift it in after entries with the same tag
+static int MoveLastItemToSortedPosition(camera_metadata_item_entry_t *items, uint32_t lastIndex)
+{
+    camera_metadata_item_entry_t newItem = items[lastIndex];
+    camera_metadata_item_entry_t *pos = std::upper_bound(items, items + lastIndex, newItem.item, TagItemEntryLess);
+    size_t length = sizeof(camera_metadata_item_entry_t) * static_cast<size_t>(items + lastIndex - pos);
+    if (length != 0) {
+        int32_t ret = memmove_s(pos + 1, length, pos, length);
+        if (ret != EOK) {
+            METADATA_ERR_LOG("MoveLastItemToSortedPosition memory move failed");
+            return CAM_META_FAILURE;
+        }
+        *pos = newItem;
+    }
+    return CAM_META_SUCCESS;
+}
+
 int CameraMetadata::AddCameraMetadataItem(common_metadata_header_t *dst, uint32_t item,
     const void *data, size_t dataCount)
+{
+    return AddCameraMetadataItem(dst, item, data, dataCount, nullptr);
+}
+
+int CameraMetadata::AddCameraMetadataItem(common_metadata_header_t *dst, uint32_t item,
+    const void *data, size_t dataCount, CameraMetadataStamp *stamp)
 {
     METADATA_DEBUG_LOG("AddCameraMetadataItem start");
     uint32_t dataType;
@@ -1097,9 +1119,20 @@ int CameraMetadata::AddCameraMetadataItem(common_metadata_header_t *dst, uint32_
             METADATA_ERR_LOG("AddCameraMetadataItem ");
             return CAM_META_FAILURE;
         }
-        dst->data_count += (uint32_t)dataBytes;
+        dst->data_count += (uint32_t)dataBytes;
+    }
+    if (IsCameraMetadataItemsSorted(dst)) {
+        ret = MoveLastItemToSortedPosition(pItem, dst->item_count);
+        if (ret != CAM_META_SUCCESS) {
+            return ret;
+        }
     }
     dst->item_count++;
+    if (stamp != nullptr) {
+        stamp->contentHash += HashCameraMetadataItem(item, dataType, dataCount, data);
+        stamp->generation++;
+    }
+    METADATA_PROFILE_TAG_OP(item, METADATA_PROFILE_OP_ADD);
 
     METADATA_DEBUG_LOG("AddCameraMetadataItem end");
     return CAM_META_SUCCESS;
@@ -1181,9 +1214,17 @@ int CameraMetadata::FindCameraMetadataItemIndex(const common_metadata_header_t *
         return CAM_META_INVALID_PARAM;
     }
     uint32_t index;
-    for (index = 0; index < src->item_count; index++, searchItem++) {
-        if (searchItem->item == item) {
-            break;
+    if (IsCameraMetadataItemsSorted(src)) {
+        camera_metadata_item_entry_t *end = searchItem + src->item_count;
+        camera_metadata_item_entry_t *found = std::lower_bound(searchItem, end, item, ItemEntryTagLess);
+        index = (found != end && found->item == item) ?
+            static_cast<uint32_t>(found - searchItem) : src->item_count;
+        searchItem = found;
+    } else {
+        for (index = 0; index < src->item_count; index++, searchItem++) {
+            if (searchItem->item == item) {
+                break;
+            }
         }
     }
 
@@ -1213,6 +1254,7 @@ int CameraMetadata::FindCameraMetadataItem(const common_metadata_header_t *src,
         name = "<unknown>";
     }
     METADATA_DEBUG_LOG("FindCameraMetadataItem item id: %{public}u, name: %{public}s", item, name);
+    METADATA_PROFILE_TAG_OP(item, METADATA_PROFILE_OP_FIND);
     int ret = FindCameraMetadataItemIndex(src, item, &index);
     if (ret != CAM_META_SUCCESS) {
         return ret;
@@ -1223,6 +1265,7 @@ int CameraMetadata::FindCameraMetadataItem(const common_metadata_header_t *src,
 
 bool CameraMetadata::IsCameraMetadataItemExist(const common_metadata_header_t *src, uint32_t item)
 {
+    METADATA_PROFILE_TAG_OP(item, METADATA_PROFILE_OP_FIND);
     uint32_t index = 0;
     int ret = FindCameraMetadataItemIndex(src, item, &index, false);
     return ret == CAM_META_SUCCESS;
@@ -1373,6 +1416,12 @@ int CameraMetadata::UpdateCameraMetadataItemSize(camera_metadata_item_entry_t *i
 
 int CameraMetadata::UpdateCameraMetadataItemByIndex(common_metadata_header_t *dst, uint32_t index,
     const void *data, uint32_t dataCount, camera_metadata_item_t *updatedItem)
+{
+    return UpdateCameraMetadataItemByIndex(dst, index, data, dataCount, updatedItem, nullptr);
+}
+
+int CameraMetadata::UpdateCameraMetadataItemByIndex(common_metadata_header_t *dst, uint32_t index,
+    const void *data, uint32_t dataCount, camera_metadata_item_t *updatedItem, CameraMetadataStamp *stamp)
 {
     METADATA_DEBUG_LOG("UpdateCameraMetadataItemByIndex start");
     if ((dst == nullptr) || (index >= dst->item_count)) {
@@ -1393,6 +1442,7 @@ int CameraMetadata::UpdateCameraMetadataItemByIndex(common_metadata_header_t *ds
         return CAM_META_INVALID_PARAM;
     }
     camera_metadata_item_entry_t *item = metadataItem + index;
+    uint64_t oldItemHash = stamp != nullptr ? HashCameraMetadataItemByIndex(dst, index) : 0;
 
     ret = UpdateCameraMetadataItemSize(item, dataCount, dst, data);
     if (ret != CAM_META_SUCCESS) {
@@ -1400,6 +1450,11 @@ int CameraMetadata::UpdateCameraMetadataItemByIndex(common_metadata_header_t *ds
     }
 
     item->count = dataCount;
+    if (stamp != nullptr) {
+        stamp->contentHash += HashCameraMetadataItem(item->item, item->data_type, dataCount, data) - oldItemHash;
+        stamp->generation++;
+    }
+    METADATA_PROFILE_TAG_OP(item->item, METADATA_PROFILE_OP_UPDATE);
     if (updatedItem != nullptr) {
         ret = GetCameraMetadataItem(dst, index, updatedItem);
         if (ret != CAM_META_SUCCESS) {
@@ -1482,6 +1537,7 @@ int CameraMetadata::DeleteCameraMetadataItemByIndex(common_metadata_header_t *ds
         return CAM_META_INVALID_PARAM;
     }
     camera_metadata_item_entry_t *itemToDelete = pItem + index;
+    uint32_t deletedTag = itemToDelete->item;
     int32_t dataBytes = CalculateCameraMetadataItemDataSize(itemToDelete->data_type, itemToDelete->count);
     if (dataBytes > 0) {
         ret = moveMetadataMemery(dst, itemToDelete, dataBytes);
@@ -1516,6 +1572,7 @@ int CameraMetadata::DeleteCameraMetadataItemByIndex(common_metadata_header_t *ds
         }
     }
     dst->item_count -= 1;
+    METADATA_PROFILE_TAG_OP(deletedTag, METADATA_PROFILE_OP_DELETE);
     METADATA_DEBUG_LOG("DeleteCameraMetadataItemByIndex end");
     return ret;
 }
@@ -1532,6 +1589,100 @@ int CameraMetadata::DeleteCameraMetadataItem(common_metadata_header_t *dst, uint
     return DeleteCameraMetadataItemByIndex(dst, index);
 }
 
+static bool ItemEntryOffsetLess(const camera_metadata_item_entry_t *lhs, const camera_metadata_item_entry_t *rhs)
+{
+    return lhs->data.offset < rhs->data.offset;
+}
+
+// Move the payloads of the remaining entries down to the start of the data region, keeping their order
+static int CompactMetadataData(common_metadata_header_t *dst, camera_metadata_item_entry_t *entries)
+{
+    std::vector<camera_metadata_item_entry_t *> payloads;
+    for (uint32_t i = 0; i < dst->item_count; i++) {
+        if (CalculateCameraMetadataItemDataSize(entries[i].data_type, entries[i].count) > 0) {
+            payloads.push_back(entries + i);
+        }
+    }
+    std::sort(payloads.begin(), payloads.end(), ItemEntryOffsetLess);
+
+    uint8_t *data = GetMetadataData(dst);
+    uint32_t dataCount = 0;
+    for (camera_metadata_item_entry_t *entry : payloads) {
+        uint32_t dataBytes = static_cast<uint32_t>(CalculateCameraMetadataItemDataSize(entry->data_type, entry->count));
+        if (entry->data.offset != dataCount) {
+            int32_t ret = memmove_s(data + dataCount, dst->data_capacity - dataCount,
+                data + entry->data.offset, dataBytes);
+            if (ret != EOK) {
+                METADATA_ERR_LOG("CompactMetadataData memory move failed");
+                return CAM_META_FAILURE;
+            }
+            entry->data.offset = dataCount;
+        }
+        dataCount += dataBytes;
+    }
+    dst->data_count = dataCount;
+    return CAM_META_SUCCESS;
+}
+
+int CameraMetadata::DeleteCameraMetadataItems(common_metadata_header_t *dst, const uint32_t *items,
+    uint32_t itemCount)
+{
+    return DeleteCameraMetadataItems(dst, items, itemCount, nullptr);
+}
+
+int CameraMetadata::DeleteCameraMetadataItems(common_metadata_header_t *dst, const uint32_t *items,
+    uint32_t itemCount, CameraMetadataStamp *stamp)
+{
+    METADATA_DEBUG_LOG("DeleteCameraMetadataItems itemCount: %{public}u", itemCount);
+    if (dst == nullptr || (items == nullptr && itemCount != 0)) {
+        METADATA_ERR_LOG("DeleteCameraMetadataItems dst or items is null");
+        return CAM_META_INVALID_PARAM;
+    }
+    camera_metadata_item_entry_t *entries = GetMetadataItems(dst);
+    if (entries == nullptr || GetMetadataData(dst) == nullptr) {
+        METADATA_ERR_LOG("DeleteCameraMetadataItems entries is null");
+        return CAM_META_INVALID_PARAM;
+    }
+    std::vector<uint32_t> tags(items, items + itemCount);
+    std::sort(tags.begin(), tags.end());
+
+    // Tombstone the entries first, so that a corrupted entry leaves the buffer untouched
+    std::vector<bool> tombstones(dst->item_count, false);
+    uint64_t deletedHash = 0;
+    for (uint32_t i = 0; i < dst->item_count; i++) {
+        int32_t dataBytes = CalculateCameraMetadataItemDataSize(entries[i].data_type, entries[i].count);
+        if (dataBytes == CAM_META_FAILURE || (dataBytes > 0 && (entries[i].data.offset > dst->data_count ||
+            dst->data_count - entries[i].data.offset < static_cast<uint32_t>(dataBytes)))) {
+            METADATA_ERR_LOG("DeleteCameraMetadataItems invalid item: %{public}u", entries[i].item);
+            return CAM_META_FAILURE;
+        }
+        tombstones[i] = std::binary_search(tags.begin(), tags.end(), entries[i].item);
+        if (tombstones[i] && stamp != nullptr) {
+            deletedHash += HashCameraMetadataItemByIndex(dst, i);
+        }
+        if (tombstones[i]) {
+            METADATA_PROFILE_TAG_OP(entries[i].item, METADATA_PROFILE_OP_DELETE);
+        }
+    }
+
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < dst->item_count; i++) {
+        if (!tombstones[i]) {
+            entries[kept++] = entries[i];
+        }
+    }
+    if (kept == dst->item_count) {
+        return CAM_META_SUCCESS;
+    }
+    dst->item_count = kept;
+    if (stamp != nullptr) {
+        stamp->contentHash -= deletedHash;
+        stamp->generation++;
+    }
+
+    return CompactMetadataData(dst, entries);
+}
+
 void CameraMetadata::FreeCameraMetadataBuffer(common_metadata_header_t *dst)
 {
     if (dst != nullptr) {
@@ -1539,6 +1690,105 @@ void CameraMetadata::FreeCameraMetadataBuffer(common_metadata_header_t *dst)
     }
 }
 
+int CameraMetadata::SetCameraMetadataItemsSorted(common_metadata_header_t *dst, bool sorted)
+{
+    if (dst == nullptr) {
+        METADATA_ERR_LOG("SetCameraMetadataItemsSorted dst is null");
+        return CAM_META_INVALID_PARAM;
+    }
+
+    if (!sorted) {
+        dst->version &= ~CAMERA_METADATA_FLAG_SORTED_ITEMS;
+        return CAM_META_SUCCESS;
+    }
+
+    camera_metadata_item_entry_t *items = GetMetadataItems(dst);
+    if (items == nullptr) {
+        METADATA_ERR_LOG("SetCameraMetadataItemsSorted items is null");
+        return CAM_META_INVALID_PARAM;
+    }
+    // Data offsets are kept in the entries, so reordering them leaves the data region untouched
+    std::stable_sort(items, items + dst->item_count, ItemEntryLess);
+    dst->version |= CAMERA_METADATA_FLAG_SORTED_ITEMS;
+    return CAM_META_SUCCESS;
+}
+
+bool CameraMetadata::IsCameraMetadataItemsSorted(const common_metadata_header_t *src)
+{
+    return src != nullptr && (src->version & CAMERA_METADATA_FLAG_SORTED_ITEMS) != 0;
+}
+
+// Items are hashed a word at a time and finished with the splitmix64 mixer so that sums of item hashes stay
+// well distributed. Summing instead of xor-ing keeps duplicated entries from cancelling each other out.
+static constexpr uint64_t HASH_MULTIPLIER = 0x9e3779b97f4a7c15ULL;
+static constexpr uint32_t HASH_ROTATE_BITS = 31;
+static constexpr uint32_t HASH_WORD_BITS = 64;
+static constexpr uint32_t HASH_HIGH_HALF_SHIFT = 32;
+
+static inline uint64_t HashWord(uint64_t hash, uint64_t word)
+{
+    hash ^= word * HASH_MULTIPLIER;
+    return ((hash << HASH_ROTATE_BITS) | (hash >> (HASH_WORD_BITS - HASH_ROTATE_BITS))) * HASH_MULTIPLIER;
+}
+
+static uint64_t HashBytes(uint64_t hash, const uint8_t *bytes, size_t length)
+{
+    uint64_t word;
+    for (; length >= sizeof(word); bytes += sizeof(word), length -= sizeof(word)) {
+        (void)memcpy_s(&word, sizeof(word), bytes, sizeof(word));
+        hash = HashWord(hash, word);
+    }
+    if (length > 0) {
+        word = 0;
+        (void)memcpy_s(&word, sizeof(word), bytes, length);
+        hash = HashWord(hash, word);
+    }
+    return hash;
+}
+
+static inline uint64_t MixHash(uint64_t hash)
+{
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL; // 30: splitmix64 shift
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL; // 27: splitmix64 shift
+    return hash ^ (hash >> 31); // 31: splitmix64 shift
+}
+
+uint64_t CameraMetadata::HashCameraMetadataItem(uint32_t item, uint32_t dataType, size_t dataCount, const void *data)
+{
+    uint64_t hash = HashWord((static_cast<uint64_t>(item) << HASH_HIGH_HALF_SHIFT) | dataType, dataCount);
+    if (dataType < META_NUM_TYPES && data != nullptr) {
+        hash = HashBytes(hash, static_cast<const uint8_t *>(data), dataCount * OHOS_CAMERA_METADATA_TYPE_SIZE[dataType]);
+    }
+    return MixHash(hash);
+}
+
+uint64_t CameraMetadata::HashCameraMetadataItemByIndex(const common_metadata_header_t *src, uint32_t index)
+{
+    const camera_metadata_item_entry_t *entry = GetMetadataItems(src) + index;
+    int32_t dataBytes = CalculateCameraMetadataItemDataSize(entry->data_type, entry->count);
+    const void *data = nullptr;
+    if (dataBytes == 0) {
+        data = entry->data.value;
+    } else if (dataBytes > 0 && entry->data.offset <= src->data_count &&
+        src->data_count - entry->data.offset >= static_cast<uint32_t>(dataBytes)) {
+        data = GetMetadataData(src) + entry->data.offset;
+    }
+    return HashCameraMetadataItem(entry->item, entry->data_type, entry->count, data);
+}
+
+uint64_t CameraMetadata::CalculateCameraMetadataContentHash(const common_metadata_header_t *src)
+{
+    if (src == nullptr) {
+        METADATA_ERR_LOG("CalculateCameraMetadataContentHash src is null");
+        return 0;
+    }
+    uint64_t hash = 0;
+    for (uint32_t i = 0; i < src->item_count; i++) {
+        hash += HashCameraMetadataItemByIndex(src, i);
+    }
+    return hash;
+}
+
 uint32_t CameraMetadata::GetCameraMetadataItemCount(const common_metadata_header_t *metadataHeader)
 {
     if (!metadataHeader) {
@@ -1602,264 +1852,98 @@ int32_t CameraMetadata::CopyCameraMetadataItems(common_metadata_header_t *newMet
 
     newMetadata->item_count = oldMetadata->item_count;
     newMetadata->data_count = oldMetadata->data_count;
+    newMetadata->version = (newMetadata->version & ~CAMERA_METADATA_FLAG_SORTED_ITEMS) |
+        (oldMetadata->version & CAMERA_METADATA_FLAG_SORTED_ITEMS);
 
     return CAM_META_SUCCESS;
 }
 
-std::string U8ItemToString(int32_t item, const camera_metadata_item_t entry)
-{
-    std::string st = {};
-    uint32_t count = entry.count;
-    if (entry.data.u8 == nullptr) {
-        METADATA_ERR_LOG("U8ItemToString: entry.data.u8 is null");
-        return st;
-    }
-    std::string dataStr = std::to_string(*(entry.data.u8));
-    for (uint32_t i = 1; i < count; i++) {
-        if ((i % WRAP_LENGTH) == 0) {
-            dataStr += "]\n\t[" + std::to_string(*(entry.data.u8 + i));
-        } else {
-            dataStr += " " + std::to_string(*(entry.data.u8 + i));
-        }
-    }
-
-    const char *name = GetCameraMetadataItemName(item);
-    if (name == nullptr) {
-        METADATA_ERR_LOG("U8ItemToString: get u8 item name fail");
-        return st;
-    }
-    std::string nameStr(name);
-
-    st = nameStr + " (" + std::to_string(entry.index) + "): " +
-        OHOS_CAMERA_METADATA_TYPE[entry.data_type] + "[" + std::to_string(count) + "]" + "\n\t[" + dataStr + "]";
-
-    return st;
-}
-
-std::string I32ItemToString(int32_t item, const camera_metadata_item_t entry)
-{
-    std::string st = {};
-    uint32_t count = entry.count;
-    if (entry.data.i32 == nullptr) {
-        METADATA_ERR_LOG("I32ItemToString: entry.data.i32 is null");
-        return st;
-    }
-    std::string dataStr = std::to_string(*(entry.data.i32));
-    for (uint32_t i = 1; i < count; i++) {
-        if ((i % WRAP_LENGTH) == 0) {
-            dataStr += "]\n\t[" + std::to_string(*(entry.data.i32 + i));
-        } else {
-            dataStr += " " + std::to_string(*(entry.data.i32 + i));
-        }
-    }
-
-    const char *name = GetCameraMetadataItemName(item);
-    if (name == nullptr) {
-        METADATA_ERR_LOG("I32ItemToString: get i32 item name fail");
-        return st;
-    }
-    std::string nameStr(name);
-
-    st = nameStr + " (" + std::to_string(entry.index) + "): " +
-        OHOS_CAMERA_METADATA_TYPE[entry.data_type] + "[" + std::to_string(count) + "]" + "\n\t[" + dataStr + "]";
-
-    return st;
-}
-
-std::string U32ItemToString(int32_t item, const camera_metadata_item_t entry)
-{
-    std::string st = {};
-    uint32_t count = entry.count;
-    if (entry.data.ui32 == nullptr) {
-        METADATA_ERR_LOG("U32ItemToString: entry.data.ui32 is null");
-        return st;
-    }
-    std::string dataStr = std::to_string(*(entry.data.ui32));
-    for (uint32_t i = 1; i < count; i++) {
-        if ((i % WRAP_LENGTH) == 0) {
-            dataStr += "]\n\t[" + std::to_string(*(entry.data.ui32 + i));
-        } else {
-            dataStr += " " + std::to_string(*(entry.data.ui32 + i));
-        }
-    }
-
-    const char *name = GetCameraMetadataItemName(item);
-    if (name == nullptr) {
-        METADATA_ERR_LOG("U32ItemToString: get u32 item name fail");
-        return st;
-    }
-    std::string nameStr(name);
-
-    st = nameStr + " (" + std::to_string(entry.index) + "): " +
-        OHOS_CAMERA_METADATA_TYPE[entry.data_type] + "[" + std::to_string(count) + "]" + "\n\t[" + dataStr + "]";
-
-    return st;
-}
-
-std::string I64ItemToString(int32_t item, const camera_metadata_item_t entry)
+template <typename T>
+static void AppendItemValue(std::string &out, T value)
 {
-    std::string st = {};
-    uint32_t count = entry.count;
-    if (entry.data.i64 == nullptr) {
-        METADATA_ERR_LOG("I64ItemToString: entry.data.i64 is null");
-        return st;
-    }
-    std::string dataStr = std::to_string(*(entry.data.i64));
-    for (uint32_t i = 1; i < count; i++) {
-        if ((i % WRAP_LENGTH) == 0) {
-            dataStr += "]\n\t[" + std::to_string(*(entry.data.i64 + i));
-        } else {
-            dataStr += " " + std::to_string(*(entry.data.i64 + i));
-        }
-    }
-
-    const char *name = GetCameraMetadataItemName(item);
-    if (name == nullptr) {
-        METADATA_ERR_LOG("I64ItemToString: get i64 item name fail");
-        return st;
-    }
-    std::string nameStr(name);
-
-    st = nameStr + " (" + std::to_string(entry.index) + "): " +
-        OHOS_CAMERA_METADATA_TYPE[entry.data_type] + "[" + std::to_string(count) + "]" + "\n\t[" + dataStr + "]";
-
-    return st;
+    out += std::to_string(value);
 }
 
-std::string FloatItemToString(int32_t item, const camera_metadata_item_t entry)
+static void AppendItemValue(std::string &out, const camera_rational_t &value)
 {
-    std::string st = {};
-    uint32_t count = entry.count;
-    if (entry.data.f == nullptr) {
-        METADATA_ERR_LOG("FloatItemToString: entry.data.f is null");
-        return st;
-    }
-    std::string dataStr = std::to_string(*(entry.data.f));
-    for (uint32_t i = 1; i < count; i++) {
-        if ((i % WRAP_LENGTH) == 0) {
-            dataStr += "]\n\t[" + std::to_string(*(entry.data.f + i));
-        } else {
-            dataStr += " " + std::to_string(*(entry.data.f + i));
-        }
-    }
-
-    const char *name = GetCameraMetadataItemName(item);
-    if (name == nullptr) {
-        METADATA_ERR_LOG("FloatItemToString: get float item name fail");
-        return st;
-    }
-    std::string nameStr(name);
-
-    st = nameStr + " (" + std::to_string(entry.index) + "): " +
-        OHOS_CAMERA_METADATA_TYPE[entry.data_type] + "[" + std::to_string(count) + "]" + "\n\t[" + dataStr + "]";
-
-    return st;
+    out += std::to_string(value.numerator);
+    out += '/';
+    out += std::to_string(value.denominator);
 }
 
-std::string DoubleItemToString(int32_t item, const camera_metadata_item_t entry)
+template <typename T>
+static void AppendItemValues(std::string &out, const T *data, uint32_t count)
 {
-    std::string st = {};
-    uint32_t count = entry.count;
-    if (entry.data.d == nullptr) {
-        METADATA_ERR_LOG("DoubleItemToString: entry.data.d is null");
-        return st;
-    }
-    std::string dataStr = std::to_string(*(entry.data.d));
-    for (uint32_t i = 1; i < count; i++) {
-        if ((i % WRAP_LENGTH) == 0) {
-            dataStr += "]\n\t[" + std::to_string(*(entry.data.d + i));
-        } else {
-            dataStr += " " + std::to_string(*(entry.data.d + i));
+    for (uint32_t i = 0; i < count; i++) {
+        if (i != 0) {
+            out += ((i % WRAP_LENGTH) == 0) ? "]\n\t[" : " ";
         }
+        AppendItemValue(out, data[i]);
     }
-
-    const char *name = GetCameraMetadataItemName(item);
-    if (name == nullptr) {
-        METADATA_ERR_LOG("DoubleItemToString: get double item name fail");
-        return st;
-    }
-    std::string nameStr(name);
-
-    st = nameStr + " (" + std::to_string(entry.index) + "): " +
-        OHOS_CAMERA_METADATA_TYPE[entry.data_type] + "[" + std::to_string(count) + "]" + "\n\t[" + dataStr + "]";
-
-    return st;
 }
 
-std::string RationalItemToString(int32_t item, const camera_metadata_item_t entry)
+// Append the dump of one item to out, nothing is appended if the item cannot be formatted
+static bool AppendItemToString(std::string &out, const camera_metadata_item_t &entry)
 {
-    std::string st = {};
-    uint32_t count = entry.count;
-    if (entry.data.r == nullptr) {
-        METADATA_ERR_LOG("RationalItemToString: entry.data.r is null");
-        return st;
-    }
-    std::string dataStr = std::to_string((*(entry.data.r)).numerator) + "/" +
-        std::to_string((*(entry.data.r)).denominator);
-    for (uint32_t i = 1; i < count; i++) {
-        if ((i % WRAP_LENGTH) == 0) {
-            dataStr += "]\n\t[" + std::to_string((*(entry.data.r + i)).numerator) + "/" +
-                std::to_string((*(entry.data.r + i)).denominator);
-        } else {
-            dataStr += " " + std::to_string((*(entry.data.r + i)).numerator) + "/" +
-                std::to_string((*(entry.data.r + i)).denominator);
-        }
+    if (entry.data.u8 == nullptr || entry.data_type >= META_NUM_TYPES) {
+        METADATA_ERR_LOG("AppendItemToString: invalid entry and item = %{public}u", entry.item);
+        return false;
     }
-
-    const char *name = GetCameraMetadataItemName(item);
+    const char *name = GetCameraMetadataItemName(entry.item);
     if (name == nullptr) {
-        METADATA_ERR_LOG("RationalItemToString: get rational item name fail");
-        return st;
-    }
-    std::string nameStr(name);
-
-    st = nameStr + " (" + std::to_string(entry.index) + "): " +
-        OHOS_CAMERA_METADATA_TYPE[entry.data_type] + "[" + std::to_string(count) + "]" + "\n\t[" + dataStr + "]";
-
-    return st;
-}
-
-std::string CameraMetadata::MetadataItemDump(const common_metadata_header_t *metadataHeader, uint32_t item)
-{
-    camera_metadata_item_t entry;
-    std::string st = {};
-
-    int ret = FindCameraMetadataItem(metadataHeader, item, &entry);
-    if (ret != 0) {
-        METADATA_ERR_LOG("get item error and item = %{public}d", item);
-        return st;
+        METADATA_ERR_LOG("AppendItemToString: get item name fail and item = %{public}u", entry.item);
+        return false;
     }
 
+    out += name;
+    out += " (";
+    out += std::to_string(entry.index);
+    out += "): ";
+    out += OHOS_CAMERA_METADATA_TYPE[entry.data_type];
+    out += '[';
+    out += std::to_string(entry.count);
+    out += "]\n\t[";
     switch (entry.data_type) {
         case META_TYPE_BYTE:
-            st = U8ItemToString(item, entry);
+            AppendItemValues(out, entry.data.u8, entry.count);
             break;
         case META_TYPE_INT32:
-            st = I32ItemToString(item, entry);
+            AppendItemValues(out, entry.data.i32, entry.count);
             break;
         case META_TYPE_UINT32:
-            st = U32ItemToString(item, entry);
+            AppendItemValues(out, entry.data.ui32, entry.count);
             break;
         case META_TYPE_FLOAT:
-            st = FloatItemToString(item, entry);
+            AppendItemValues(out, entry.data.f, entry.count);
             break;
         case META_TYPE_INT64:
-            st = I64ItemToString(item, entry);
+            AppendItemValues(out, entry.data.i64, entry.count);
             break;
         case META_TYPE_DOUBLE:
-            st = DoubleItemToString(item, entry);
+            AppendItemValues(out, entry.data.d, entry.count);
             break;
         case META_TYPE_RATIONAL:
-            st = RationalItemToString(item, entry);
+            AppendItemValues(out, entry.data.r, entry.count);
             break;
         default:
-            METADATA_ERR_LOG("invalid param and item = %{public}d", item);
             break;
     }
+    out += "]\n";
+    return true;
+}
 
-    if (!st.empty()) {
-        st += "\n";
+std::string CameraMetadata::MetadataItemDump(const common_metadata_header_t *metadataHeader, uint32_t item)
+{
+    camera_metadata_item_t entry;
+    std::string st = {};
+
+    int ret = FindCameraMetadataItem(metadataHeader, item, &entry);
+    if (ret != 0) {
+        METADATA_ERR_LOG("get item error and item = %{public}d", item);
+        return st;
     }
+
+    AppendItemToString(st, entry);
     return st;
 }
 
@@ -1871,13 +1955,66 @@ std::string CameraMetadata::FormatCameraMetadataToString(const common_metadata_h
         return metaStr;
     }
 
-    for (auto it = g_metadataTags.begin(); it != g_metadataTags.end(); it++) {
-        metaStr += MetadataItemDump(metadataHeader, *it);
+    // (tag, position in g_metadataDumpTags) sorted by tag, so each stored item is matched with one binary search
+    static const std::vector<std::pair<uint32_t, uint32_t>> dumpTags = [] {
+        std::vector<std::pair<uint32_t, uint32_t>> tags;
+        tags.reserve(std::size(g_metadataDumpTags));
+        for (uint32_t i = 0; i < std::size(g_metadataDumpTags); i++) {
+            tags.emplace_back(g_metadataDumpTags[i], i);
+        }
+        std::sort(tags.begin(), tags.end());
+        return tags;
+    }();
+
+    // (position in g_metadataDumpTags, item index), the output keeps the g_metadataDumpTags order
+    std::vector<std::pair<uint32_t, uint32_t>> dumpOrder;
+    camera_metadata_item_entry_t *items = GetMetadataItems(metadataHeader);
+    for (uint32_t i = 0; items != nullptr && i < metadataHeader->item_count; i++) {
+        auto iter = std::lower_bound(dumpTags.begin(), dumpTags.end(), std::make_pair(items[i].item, 0u));
+        if (iter != dumpTags.end() && iter->first == items[i].item) {
+            dumpOrder.emplace_back(iter->second, i);
+        }
+    }
+    std::sort(dumpOrder.begin(), dumpOrder.end());
+
+    metaStr.reserve(dumpOrder.size() * DUMP_ITEM_RESERVE_LENGTH);
+    camera_metadata_item_t entry;
+    for (size_t i = 0; i < dumpOrder.size(); i++) {
+        // Like FindCameraMetadataItem, only the first entry of a duplicated tag is dumped
+        if (i != 0 && dumpOrder[i].first == dumpOrder[i - 1].first) {
+            continue;
+        }
+        if (GetCameraMetadataItem(metadataHeader, dumpOrder[i].second, &entry) == CAM_META_SUCCESS) {
+            AppendItemToString(metaStr, entry);
+        }
     }
     METADATA_DEBUG_LOG("metadataHeader item = %{public}s", metaStr.c_str());
     return metaStr;
 }
 
+int CameraMetadata::DumpCameraMetadata(const common_metadata_header_t *metadataHeader,
+    const MetadataDumpSink &sink)
+{
+    if (metadataHeader == nullptr || !sink) {
+        METADATA_ERR_LOG("DumpCameraMetadata metadataHeader or sink is null");
+        return CAM_META_INVALID_PARAM;
+    }
+
+    std::string itemStr;
+    itemStr.reserve(DUMP_ITEM_RESERVE_LENGTH);
+    camera_metadata_item_t entry;
+    for (uint32_t i = 0; i < metadataHeader->item_count; i++) {
+        if (GetCameraMetadataItem(metadataHeader, i, &entry) != CAM_META_SUCCESS) {
+            continue;
+        }
+        itemStr.clear();
+        if (AppendItemToString(itemStr, entry)) {
+            sink(itemStr.data(), itemStr.size());
+        }
+    }
+    return CAM_META_SUCCESS;
+}
+
 int32_t CameraMetadata::GetAllVendorTags(std::vector<vendorTag_t>& tagVec)
 {
     int32_t ret = LoadVendorTagImpl();
@@ -1903,13 +2040,54 @@ int32_t CameraMetadata::GetAllVendorTags(std::vector<vendorTag_t>& tagVec)
 
 bool CameraMetadata::CheckItemDataType(camera_metadata_item_entry_t &item)
 {
-    auto iter = g_itemDataTypeMap.find(item.item);
-    if (iter != g_itemDataTypeMap.end()) {
-        if (iter->second != item.data_type) {
+    for (const auto &itemDataType : g_itemDataTypes) {
+        if (itemDataType.item != item.item) {
+            continue;
+        }
+        if (itemDataType.dataType != item.data_type) {
             METADATA_ERR_LOG("Invalid data type :%{public}u, item :%{public}u", item.data_type, item.item);
             return false;
         }
+        break;
+    }
+    return true;
+}
+
+SharedCameraMetadata::SharedCameraMetadata(std::shared_ptr<CameraMetadata> metadata)
+    : metadata_(std::move(metadata))
+{
+}
+
+std::shared_ptr<const CameraMetadata> SharedCameraMetadata::Load() const
+{
+    return std::atomic_load(&metadata_);
+}
+
+void SharedCameraMetadata::Store(std::shared_ptr<CameraMetadata> metadata)
+{
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    std::atomic_store(&metadata_, std::shared_ptr<const CameraMetadata>(std::move(metadata)));
+}
+
+bool SharedCameraMetadata::Update(const std::function<bool(CameraMetadata &)> &updater)
+{
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    std::shared_ptr<const CameraMetadata> current = std::atomic_load(&metadata_);
+    if (current == nullptr || current->get() == nullptr) {
+        METADATA_ERR_LOG("SharedCameraMetadata::Update metadata is null");
+        return false;
+    }
+    const common_metadata_header_t *src = current->get();
+    auto copy = std::make_shared<CameraMetadata>(src->item_capacity, src->data_capacity, current->allocator_);
+    if (!copy->isValid() || CopyCameraMetadataItems(copy->get(), src) != CAM_META_SUCCESS) {
+        METADATA_ERR_LOG("SharedCameraMetadata::Update copy failed");
+        return false;
+    }
+    copy->stamp_ = current->stamp_;
+    if (!updater(*copy)) {
+        return false;
     }
+    std::atomic_store(&metadata_, std::shared_ptr<const CameraMetadata>(std::move(copy)));
     return true;
 }
 } // Camera
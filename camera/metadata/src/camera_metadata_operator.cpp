@@ -52,6 +52,11 @@ const char *GetCameraMetadataItemName(uint32_t item)
     return CameraMetadata::GetCameraMetadataItemName(item);
 }
 
+int32_t GetCameraMetadataItemTagByName(const char *name, uint32_t *item)
+{
+    return CameraMetadata::GetCameraMetadataItemTagByName(name, item);
+}
+
 int32_t CalculateCameraMetadataItemDataSize(uint32_t type, size_t dataCount)
 {
     return CameraMetadata::CalculateCameraMetadataItemDataSize(type, dataCount);
@@ -110,11 +115,31 @@ int DeleteCameraMetadataItem(common_metadata_header_t *dst, uint32_t item)
     return CameraMetadata::DeleteCameraMetadataItem(dst, item);
 }
 
+int DeleteCameraMetadataItems(common_metadata_header_t *dst, const uint32_t *items, uint32_t itemCount)
+{
+    return CameraMetadata::DeleteCameraMetadataItems(dst, items, itemCount);
+}
+
 void FreeCameraMetadataBuffer(common_metadata_header_t *dst)
 {
     CameraMetadata::FreeCameraMetadataBuffer(dst);
 }
 
+int SetCameraMetadataItemsSorted(common_metadata_header_t *dst, bool sorted)
+{
+    return CameraMetadata::SetCameraMetadataItemsSorted(dst, sorted);
+}
+
+bool IsCameraMetadataItemsSorted(const common_metadata_header_t *src)
+{
+    return CameraMetadata::IsCameraMetadataItemsSorted(src);
+}
+
+uint64_t CalculateCameraMetadataContentHash(const common_metadata_header_t *src)
+{
+    return CameraMetadata::CalculateCameraMetadataContentHash(src);
+}
+
 uint32_t GetCameraMetadataItemCount(const common_metadata_header_t *metadataHeader)
 {
     return CameraMetadata::GetCameraMetadataItemCount(metadataHeader);
@@ -145,8 +170,18 @@ std::string FormatCameraMetadataToString(const common_metadata_header_t *metadat
     return CameraMetadata::FormatCameraMetadataToString(metadataHeader);
 }
 
+int DumpCameraMetadata(const common_metadata_header_t *metadataHeader, const MetadataDumpSink &sink)
+{
+    return CameraMetadata::DumpCameraMetadata(metadataHeader, sink);
+}
+
 int32_t GetAllVendorTags(std::vector<vendorTag_t>& tagVec)
 {
     return CameraMetadata::GetAllVendorTags(tagVec);
 }
+
+int32_t RefreshVendorTagTable()
+{
+    return CameraMetadata::RefreshVendorTagTable();
+}
 } // Camera
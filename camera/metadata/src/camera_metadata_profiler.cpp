@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "camera_metadata_profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include "metadata_log.h"
+
+namespace OHOS::Camera {
+// Open addressing table keyed by tag, a slot is claimed once and never released so that the
+// hot path only needs relaxed atomics. Sized well above the number of tags a camera uses.
+static constexpr uint32_t PROFILE_TABLE_BITS = 10;
+static constexpr uint32_t PROFILE_TABLE_SIZE = 1U << PROFILE_TABLE_BITS;
+static constexpr uint32_t PROFILE_HASH_MULTIPLIER = 0x9E3779B1;
+static constexpr uint32_t PROFILE_EMPTY_TAG = UINT32_MAX;
+static constexpr uint64_t NANOSECONDS_PER_MICROSECOND = 1000;
+static constexpr uint32_t PROFILE_LINE_RESERVE_LENGTH = 128;
+
+static const char *const PROFILE_OP_NAMES[METADATA_PROFILE_OP_COUNT] = {
+    "find", "add", "update", "delete", "resize"
+};
+
+struct TagCounters {
+    std::atomic<uint32_t> tag {PROFILE_EMPTY_TAG};
+    std::atomic<uint64_t> counts[METADATA_PROFILE_OP_COUNT] {};
+};
+
+static std::atomic<bool> g_profilingEnabled {false};
+static TagCounters g_tagCounters[PROFILE_TABLE_SIZE];
+static std::atomic<uint64_t> g_resizeCount {0};
+static std::atomic<uint64_t> g_resizeBytesCopied {0};
+static std::atomic<uint64_t> g_resizeCopyNanoseconds {0};
+static std::atomic<uint64_t> g_droppedRecords {0};
+
+static TagCounters *FindTagCounters(uint32_t tag)
+{
+    if (tag == PROFILE_EMPTY_TAG) {
+        return nullptr;
+    }
+    uint32_t slot = (tag * PROFILE_HASH_MULTIPLIER) >> (32 - PROFILE_TABLE_BITS); // 32: bits of the hash
+    for (uint32_t probe = 0; probe < PROFILE_TABLE_SIZE; probe++, slot = (slot + 1) & (PROFILE_TABLE_SIZE - 1)) {
+        TagCounters &counters = g_tagCounters[slot];
+        uint32_t current = counters.tag.load(std::memory_order_acquire);
+        if (current == PROFILE_EMPTY_TAG &&
+            counters.tag.compare_exchange_strong(current, tag, std::memory_order_acq_rel)) {
+            return &counters;
+        }
+        // A failed claim leaves the tag of the thread that won the slot in current
+        if (current == tag) {
+            return &counters;
+        }
+    }
+    return nullptr;
+}
+
+bool IsCameraMetadataProfilingSupported()
+{
+#ifdef CAMERA_METADATA_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+int SetCameraMetadataProfilingEnabled(bool enabled)
+{
+    if (enabled && !IsCameraMetadataProfilingSupported()) {
+        METADATA_ERR_LOG("SetCameraMetadataProfilingEnabled metadata profiling is not compiled in");
+        return CAM_META_FAILURE;
+    }
+    g_profilingEnabled.store(enabled, std::memory_order_relaxed);
+    return CAM_META_SUCCESS;
+}
+
+bool IsCameraMetadataProfilingEnabled()
+{
+    return g_profilingEnabled.load(std::memory_order_relaxed);
+}
+
+void ResetCameraMetadataProfile()
+{
+    for (TagCounters &counters : g_tagCounters) {
+        for (std::atomic<uint64_t> &count : counters.counts) {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+    g_resizeCount.store(0, std::memory_order_relaxed);
+    g_resizeBytesCopied.store(0, std::memory_order_relaxed);
+    g_resizeCopyNanoseconds.store(0, std::memory_order_relaxed);
+    g_droppedRecords.store(0, std::memory_order_relaxed);
+}
+
+static uint64_t TotalCount(const CameraMetadataTagProfile &profile)
+{
+    uint64_t total = 0;
+    for (uint64_t count : profile.counts) {
+        total += count;
+    }
+    return total;
+}
+
+static bool TagProfileMoreUsed(const CameraMetadataTagProfile &lhs, const CameraMetadataTagProfile &rhs)
+{
+    uint64_t lhsTotal = TotalCount(lhs);
+    uint64_t rhsTotal = TotalCount(rhs);
+    return lhsTotal != rhsTotal ? lhsTotal > rhsTotal : lhs.tag < rhs.tag;
+}
+
+CameraMetadataProfile GetCameraMetadataProfile()
+{
+    CameraMetadataProfile profile;
+    for (const TagCounters &counters : g_tagCounters) {
+        uint32_t tag = counters.tag.load(std::memory_order_acquire);
+        if (tag == PROFILE_EMPTY_TAG) {
+            continue;
+        }
+        CameraMetadataTagProfile tagProfile;
+        tagProfile.tag = tag;
+        for (uint32_t op = 0; op < METADATA_PROFILE_OP_COUNT; op++) {
+            tagProfile.counts[op] = counters.counts[op].load(std::memory_order_relaxed);
+        }
+        if (TotalCount(tagProfile) != 0) {
+            profile.tags.push_back(tagProfile);
+        }
+    }
+    std::sort(profile.tags.begin(), profile.tags.end(), TagProfileMoreUsed);
+    profile.resizeCount = g_resizeCount.load(std::memory_order_relaxed);
+    profile.resizeBytesCopied = g_resizeBytesCopied.load(std::memory_order_relaxed);
+    profile.resizeCopyNanoseconds = g_resizeCopyNanoseconds.load(std::memory_order_relaxed);
+    profile.droppedRecords = g_droppedRecords.load(std::memory_order_relaxed);
+    return profile;
+}
+
+int DumpCameraMetadataProfile(const MetadataDumpSink &sink)
+{
+    if (!sink) {
+        METADATA_ERR_LOG("DumpCameraMetadataProfile sink is null");
+        return CAM_META_INVALID_PARAM;
+    }
+
+    CameraMetadataProfile profile = GetCameraMetadataProfile();
+    std::string line;
+    line.reserve(PROFILE_LINE_RESERVE_LENGTH);
+    for (const CameraMetadataTagProfile &tagProfile : profile.tags) {
+        const char *name = GetCameraMetadataItemName(tagProfile.tag);
+        line.clear();
+        line += (name != nullptr) ? name : "<unknown>";
+        line += '(';
+        line += std::to_string(tagProfile.tag);
+        line += "):";
+        for (uint32_t op = 0; op < METADATA_PROFILE_OP_COUNT; op++) {
+            line += ' ';
+            line += PROFILE_OP_NAMES[op];
+            line += '=';
+            line += std::to_string(tagProfile.counts[op]);
+        }
+        line += '\n';
+        sink(line.data(), line.size());
+    }
+    line = "resize count=" + std::to_string(profile.resizeCount) +
+        " bytes copied=" + std::to_string(profile.resizeBytesCopied) +
+        " copy time(us)=" + std::to_string(profile.resizeCopyNanoseconds / NANOSECONDS_PER_MICROSECOND) +
+        " dropped=" + std::to_string(profile.droppedRecords) + "\n";
+    sink(line.data(), line.size());
+    return CAM_META_SUCCESS;
+}
+
+std::string FormatCameraMetadataProfileToString()
+{
+    std::string profileStr;
+    DumpCameraMetadataProfile([&profileStr](const char *str, size_t length) { profileStr.append(str, length); });
+    return profileStr;
+}
+
+void RecordCameraMetadataTagOp(uint32_t tag, CameraMetadataProfileOp op)
+{
+    if (!g_profilingEnabled.load(std::memory_order_relaxed) || op >= METADATA_PROFILE_OP_COUNT) {
+        return;
+    }
+    TagCounters *counters = FindTagCounters(tag);
+    if (counters == nullptr) {
+        g_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    counters->counts[op].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t GetCameraMetadataProfileTime()
+{
+    if (!g_profilingEnabled.load(std::memory_order_relaxed)) {
+        return 0;
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void RecordCameraMetadataResize(uint64_t bytesCopied, uint64_t startTime)
+{
+    if (startTime == 0) {
+        return;
+    }
+    uint64_t now = GetCameraMetadataProfileTime();
+    g_resizeCount.fetch_add(1, std::memory_order_relaxed);
+    g_resizeBytesCopied.fetch_add(bytesCopied, std::memory_order_relaxed);
+    if (now > startTime) {
+        g_resizeCopyNanoseconds.fetch_add(now - startTime, std::memory_order_relaxed);
+    }
+}
+} // namespace OHOS::Camera
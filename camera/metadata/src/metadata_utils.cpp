@@ -14,7 +14,12 @@
  */
 
 #include "metadata_utils.h"
+#include <cerrno>
+#include <fcntl.h>
 #include <securec.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "metadata_log.h"
 #include "camera_metadata_item_info.h"
 
@@ -24,43 +29,24 @@ if (cond) { \
     return {}; \
 }
 
+// index, item, data_type and count of an item in the vec format
+static constexpr uint32_t VEC_ITEM_HEADER_SIZE = 4 * sizeof(uint32_t);
+
 #ifndef UINT32_MAX
 #define UINT32_MAX             (4294967295U)
 #endif
 
 namespace OHOS::Camera {
+// The vec format is only exchanged on the same device, item data keeps the host byte order
+// and is copied as one block, a rational being a numerator followed by a denominator
 void MetadataUtils::WriteMetadataDataToVec(const camera_metadata_item_t &entry, std::vector<uint8_t>& cameraAbility)
 {
-    if (entry.data_type == META_TYPE_BYTE) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<int8_t>(*(entry.data.u8 + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_INT32) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<int32_t>(*(entry.data.i32 + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_UINT32) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<uint32_t>(*(entry.data.ui32 + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_FLOAT) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<float>(*(entry.data.f + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_INT64) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<int64_t>(*(entry.data.i64 + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_DOUBLE) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<double>(*(entry.data.d + i), cameraAbility);
-        }
-    } else if (entry.data_type == META_TYPE_RATIONAL) {
-        for (size_t i = 0; i < entry.count; i++) {
-            WriteData<int32_t>((*(entry.data.r + i)).numerator, cameraAbility);
-            WriteData<int32_t>((*(entry.data.r + i)).denominator, cameraAbility);
-        }
+    if (entry.data_type >= META_NUM_TYPES || entry.data.u8 == nullptr) {
+        METADATA_ERR_LOG("WriteMetadataDataToVec invalid item:%{public}u", entry.item);
+        return;
     }
+    WriteDataArray<uint8_t>(entry.data.u8, entry.count * OHOS_CAMERA_METADATA_TYPE_SIZE[entry.data_type],
+        cameraAbility);
 }
 
 bool MetadataUtils::ConvertMetadataToVec(const std::shared_ptr<CameraMetadata> &metadata,
@@ -92,6 +78,8 @@ bool MetadataUtils::ConvertMetadataToVec(const std::shared_ptr<CameraMetadata> &
         return false;
     }
 
+    // Item headers, the data region and the payloads inlined into entries, so the vector grows once
+    cameraAbility.reserve(MIN_VEC_SIZE + tagCount * (VEC_ITEM_HEADER_SIZE + ENTRY_DATA_SIZE) + meta->data_count);
     WriteData<uint32_t>(tagCount, cameraAbility);
     WriteData<uint32_t>(itemCapacity, cameraAbility);
     WriteData<uint32_t>(dataCapacity, cameraAbility);
@@ -155,110 +143,286 @@ bool MetadataUtils::EncodeCameraMetadata(const std::shared_ptr<CameraMetadata> &
     return WriteCameraMetadata(meta, data);
 }
 
-static void ReadMetadataDataFromVecUInt8(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
+bool MetadataUtils::WriteCameraMetadataBlob(const common_metadata_header_t* meta, MessageParcel &data)
 {
-    entry.data.u8 = new(std::nothrow) uint8_t[entry.count];
-    if (entry.data.u8 != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<uint8_t>(entry.data.u8[i], index, cameraAbility);
-        }
+    if (meta == nullptr) {
+        return data.WriteUint32(0);
     }
+
+    // The buffer only holds offsets, so it can be sent as is. Large buffers go through ashmem in WriteRawData.
+    bool bRet = data.WriteUint32(METADATA_BLOB_MAGIC);
+    bRet = bRet && data.WriteUint32(meta->size);
+    bRet = bRet && data.WriteRawData(meta, meta->size);
+    return bRet;
 }
 
-static void ReadMetadataDataFromVecInt32(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
+bool MetadataUtils::EncodeCameraMetadataBlob(const std::shared_ptr<CameraMetadata> &metadata, MessageParcel &data)
 {
-    entry.data.i32 = new(std::nothrow) int32_t[entry.count];
-    if (entry.data.i32 != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<int32_t>(entry.data.i32[i], index, cameraAbility);
-        }
+    if (metadata == nullptr) {
+        return false;
     }
+
+    return WriteCameraMetadataBlob(metadata->get(), data);
 }
 
-static void ReadMetadataDataFromVecUInt32(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
+bool MetadataUtils::CheckCameraMetadataBlobItems(const common_metadata_header_t *meta, bool &sorted)
 {
-    entry.data.ui32 = new(std::nothrow) uint32_t[entry.count];
-    if (entry.data.ui32 != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<uint32_t>(entry.data.ui32[i], index, cameraAbility);
+    const camera_metadata_item_entry_t *entries = GetMetadataItems(meta);
+    if (entries == nullptr) {
+        return false;
+    }
+    sorted = true;
+    for (uint32_t i = 0; i < meta->item_count; i++) {
+        if (entries[i].count > MAX_SUPPORTED_ITEMS) {
+            METADATA_ERR_LOG("CheckCameraMetadataBlobItems item.count out of range:%{public}u item:%{public}u",
+                entries[i].count, entries[i].item);
+            return false;
         }
+        uint32_t dataType;
+        if (GetCameraMetadataItemType(entries[i].item, &dataType) != CAM_META_SUCCESS ||
+            dataType != entries[i].data_type) {
+            METADATA_ERR_LOG("CheckCameraMetadataBlobItems item data type mismatch! item: %{public}u",
+                entries[i].item);
+            return false;
+        }
+        // Checks the data offset and size against the data region
+        camera_metadata_item_t item;
+        if (GetCameraMetadataItem(meta, i, &item) != CAM_META_SUCCESS) {
+            return false;
+        }
+        sorted = sorted && (i == 0 || entries[i - 1].item <= entries[i].item);
     }
+    return true;
 }
 
-static void ReadMetadataDataFromVecFloat(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
+std::unique_ptr<CameraMetadata> MetadataUtils::ReadCameraMetadataBlob(MessageParcel &data)
 {
-    entry.data.f = new(std::nothrow) float[entry.count];
-    if (entry.data.f != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<float>(entry.data.f[i], index, cameraAbility);
-        }
+    uint32_t blobSize = data.ReadUint32();
+    if (blobSize < sizeof(common_metadata_header_t)) {
+        METADATA_ERR_LOG("ReadCameraMetadataBlob invalid blob size:%{public}u", blobSize);
+        return nullptr;
+    }
+    const void *rawData = data.ReadRawData(blobSize);
+    if (rawData == nullptr) {
+        METADATA_ERR_LOG("ReadCameraMetadataBlob read raw data failed, size:%{public}u", blobSize);
+        return nullptr;
+    }
+    // Raw parcel data is only 4-byte aligned, the header is read from a copy
+    common_metadata_header_t header;
+    if (memcpy_s(&header, sizeof(header), rawData, sizeof(header)) != EOK) {
+        METADATA_ERR_LOG("ReadCameraMetadataBlob header copy failed");
+        return nullptr;
+    }
+    if (header.item_capacity > MAX_ITEM_CAPACITY || header.data_capacity > MAX_DATA_CAPACITY ||
+        header.item_count > header.item_capacity || header.data_count > header.data_capacity) {
+        METADATA_ERR_LOG("ReadCameraMetadataBlob invalid capacity, item:%{public}u/%{public}u, "
+            "data:%{public}u/%{public}u", header.item_count, header.item_capacity,
+            header.data_count, header.data_capacity);
+        return nullptr;
+    }
+
+    // A buffer of the same capacity has the same layout, anything else is not a buffer written by us
+    auto metadata = std::make_unique<CameraMetadata>(header.item_capacity, header.data_capacity);
+    common_metadata_header_t *meta = metadata->get();
+    if (meta == nullptr || meta->size != blobSize || meta->size != header.size ||
+        meta->items_start != header.items_start || meta->data_start != header.data_start) {
+        METADATA_ERR_LOG("ReadCameraMetadataBlob blob layout mismatch, size:%{public}u", blobSize);
+        return nullptr;
     }
+    if (memcpy_s(meta, meta->size, rawData, blobSize) != EOK) {
+        METADATA_ERR_LOG("ReadCameraMetadataBlob memory copy failed");
+        return nullptr;
+    }
+    bool sorted = false;
+    if (!CheckCameraMetadataBlobItems(meta, sorted)) {
+        return nullptr;
+    }
+    if (!sorted) {
+        meta->version &= ~CAMERA_METADATA_FLAG_SORTED_ITEMS;
+    }
+    metadata->RecalculateContentHash();
+    return metadata;
 }
 
-static void ReadMetadataDataFromVecInt64(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
+// Camera ability file: this header, then a metadata buffer whose capacity equals its content
+struct CameraMetadataFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t metadataOffset;
+    uint32_t metadataSize;
+};
+static constexpr uint32_t METADATA_FILE_MAGIC = 0x46414D43; // "CMAF"
+// 2: files of version 1 may hold metadata buffers with a 48-byte header
+static constexpr uint32_t METADATA_FILE_VERSION = 2;
+static constexpr uint32_t METADATA_FILE_OFFSET = 16;
+static_assert(METADATA_FILE_OFFSET >= sizeof(CameraMetadataFileHeader) && METADATA_FILE_OFFSET % DATA_ALIGNMENT == 0,
+    "the metadata buffer in a camera ability file must be aligned");
+
+bool MetadataUtils::CheckCameraMetadataBlobLayout(const common_metadata_header_t *blob, size_t blobSize)
 {
-    entry.data.i64 = new(std::nothrow) int64_t[entry.count];
-    if (entry.data.i64 != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<int64_t>(entry.data.i64[i], index, cameraAbility);
-        }
+    if (blobSize < sizeof(common_metadata_header_t) || blob->size != blobSize ||
+        blob->item_capacity > MAX_ITEM_CAPACITY || blob->data_capacity > MAX_DATA_CAPACITY ||
+        blob->item_count > blob->item_capacity || blob->data_count > blob->data_capacity) {
+        METADATA_ERR_LOG("CheckCameraMetadataBlobLayout invalid header, size:%{public}zu", blobSize);
+        return false;
     }
+    common_metadata_header_t expected = {};
+    FillCameraMetadata(&expected, blobSize, blob->item_capacity, blob->data_capacity);
+    if (blob->items_start != expected.items_start || blob->data_start != expected.data_start ||
+        static_cast<uint64_t>(blob->data_start) + blob->data_capacity > blobSize) {
+        METADATA_ERR_LOG("CheckCameraMetadataBlobLayout layout mismatch, size:%{public}zu", blobSize);
+        return false;
+    }
+    return true;
 }
 
-static void ReadMetadataDataFromVecDouble(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
+static bool WriteFileFully(int fd, const void *data, size_t size)
 {
-    entry.data.d = new(std::nothrow) double[entry.count];
-    if (entry.data.d != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<double>(entry.data.d[i], index, cameraAbility);
+    const uint8_t *ptr = static_cast<const uint8_t *>(data);
+    while (size > 0) {
+        ssize_t written = write(fd, ptr, size);
+        if (written < 0 && errno == EINTR) {
+            continue;
         }
+        if (written <= 0) {
+            return false;
+        }
+        ptr += written;
+        size -= static_cast<size_t>(written);
     }
+    return true;
 }
 
-static void ReadMetadataDataFromVecRational(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
+bool MetadataUtils::WriteCameraMetadataFile(const std::shared_ptr<CameraMetadata> &metadata, const std::string &path)
 {
-    entry.data.r = new(std::nothrow) camera_rational_t[entry.count];
-    if (entry.data.r != nullptr) {
-        for (size_t i = 0; i < entry.count; i++) {
-            MetadataUtils::ReadData<int32_t>(entry.data.r[i].numerator, index, cameraAbility);
-            MetadataUtils::ReadData<int32_t>(entry.data.r[i].denominator, index, cameraAbility);
-        }
+    if (metadata == nullptr || metadata->get() == nullptr) {
+        METADATA_ERR_LOG("WriteCameraMetadataFile metadata is null");
+        return false;
+    }
+    const common_metadata_header_t *meta = metadata->get();
+    CameraMetadata compact(meta->item_count, meta->data_count);
+    if (!compact.isValid() || CopyCameraMetadataItems(compact.get(), meta) != CAM_META_SUCCESS) {
+        METADATA_ERR_LOG("WriteCameraMetadataFile compact copy failed");
+        return false;
+    }
+
+    CameraMetadataFileHeader header = {};
+    header.magic = METADATA_FILE_MAGIC;
+    header.version = METADATA_FILE_VERSION;
+    header.metadataOffset = METADATA_FILE_OFFSET;
+    header.metadataSize = compact.get()->size;
+    uint8_t padding[METADATA_FILE_OFFSET - sizeof(CameraMetadataFileHeader)] = {};
+
+    // Write to a temporary file first so readers never map a partially written file
+    std::string tmpPath = path + ".tmp";
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        METADATA_ERR_LOG("WriteCameraMetadataFile open failed, errno:%{public}d", errno);
+        return false;
+    }
+    bool bRet = WriteFileFully(fd, &header, sizeof(header));
+    bRet = bRet && WriteFileFully(fd, padding, sizeof(padding));
+    bRet = bRet && WriteFileFully(fd, compact.get(), header.metadataSize);
+    bRet = bRet && fsync(fd) == 0;
+    bRet = (close(fd) == 0) && bRet;
+    if (!bRet || rename(tmpPath.c_str(), path.c_str()) != 0) {
+        METADATA_ERR_LOG("WriteCameraMetadataFile write failed, errno:%{public}d", errno);
+        (void)unlink(tmpPath.c_str());
+        return false;
     }
+    return true;
 }
 
-void MetadataUtils::ReadMetadataDataFromVec(int32_t &index, camera_metadata_item_t &entry,
-    const std::vector<uint8_t>& cameraAbility)
+std::shared_ptr<CameraMetadata> MetadataUtils::MapCameraMetadataFile(const std::string &path)
 {
-    switch (entry.data_type) {
-        case META_TYPE_BYTE:
-            ReadMetadataDataFromVecUInt8(index, entry, cameraAbility);
-            break;
-        case META_TYPE_INT32:
-            ReadMetadataDataFromVecInt32(index, entry, cameraAbility);
-            break;
-        case META_TYPE_UINT32:
-            ReadMetadataDataFromVecUInt32(index, entry, cameraAbility);
-            break;
-        case META_TYPE_FLOAT:
-            ReadMetadataDataFromVecFloat(index, entry, cameraAbility);
-            break;
-        case META_TYPE_INT64:
-            ReadMetadataDataFromVecInt64(index, entry, cameraAbility);
-            break;
-        case META_TYPE_DOUBLE:
-            ReadMetadataDataFromVecDouble(index, entry, cameraAbility);
-            break;
-        case META_TYPE_RATIONAL:
-            ReadMetadataDataFromVecRational(index, entry, cameraAbility);
-            break;
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        METADATA_ERR_LOG("MapCameraMetadataFile open failed, errno:%{public}d", errno);
+        return nullptr;
+    }
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < static_cast<off_t>(METADATA_FILE_OFFSET) ||
+        fileStat.st_size > static_cast<off_t>(METADATA_FILE_OFFSET + MAX_DATA_CAPACITY +
+        MAX_ITEM_CAPACITY * sizeof(camera_metadata_item_entry_t) + sizeof(common_metadata_header_t))) {
+        METADATA_ERR_LOG("MapCameraMetadataFile invalid file size");
+        close(fd);
+        return nullptr;
+    }
+    size_t mapSize = static_cast<size_t>(fileStat.st_size);
+    // Writable so that the existing get() based mutators work. MAP_PRIVATE keeps the file pages shared with
+    // every other process mapping it until a page is written, and keeps the writes out of the file
+    void *mapBase = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapBase == MAP_FAILED) {
+        METADATA_ERR_LOG("MapCameraMetadataFile mmap failed, errno:%{public}d", errno);
+        return nullptr;
+    }
+
+    const CameraMetadataFileHeader *header = static_cast<const CameraMetadataFileHeader *>(mapBase);
+    common_metadata_header_t *meta = reinterpret_cast<common_metadata_header_t *>(
+        static_cast<uint8_t *>(mapBase) + METADATA_FILE_OFFSET);
+    bool sorted = false;
+    if (header->magic != METADATA_FILE_MAGIC || header->version != METADATA_FILE_VERSION ||
+        header->metadataOffset != METADATA_FILE_OFFSET || header->metadataSize != mapSize - METADATA_FILE_OFFSET ||
+        !CheckCameraMetadataBlobLayout(meta, header->metadataSize) || !CheckCameraMetadataBlobItems(meta, sorted) ||
+        (!sorted && IsCameraMetadataItemsSorted(meta))) {
+        METADATA_ERR_LOG("MapCameraMetadataFile invalid camera ability file");
+        munmap(mapBase, mapSize);
+        return nullptr;
+    }
+    return std::make_shared<CameraMetadata>(meta, mapBase, mapSize);
+}
+
+static constexpr uint32_t DELTA_ITEM_CAPACITY = 8;
+static constexpr uint32_t DELTA_DATA_CAPACITY = 64;
+
+bool MetadataUtils::EncodeCameraMetadataDelta(const std::shared_ptr<CameraMetadata> &base,
+    const std::shared_ptr<CameraMetadata> &metadata, MessageParcel &data)
+{
+    if (metadata == nullptr) {
+        return false;
+    }
+
+    CameraMetadata empty(0, 0);
+    CameraMetadata changed(DELTA_ITEM_CAPACITY, DELTA_DATA_CAPACITY);
+    std::vector<uint32_t> deletedTags;
+    if (!metadata->diff(base != nullptr ? *base : empty, changed, deletedTags)) {
+        METADATA_ERR_LOG("EncodeCameraMetadataDelta diff failed");
+        return false;
+    }
+
+    // Hashed from scratch, base may have been changed through get() since its hash was last updated
+    uint64_t baseHash = base != nullptr ? CalculateCameraMetadataContentHash(base->get()) : 0;
+    return data.WriteUint64(baseHash) && data.WriteUInt32Vector(deletedTags) &&
+        WriteCameraMetadata(changed.get(), data);
+}
+
+bool MetadataUtils::DecodeCameraMetadataDelta(MessageParcel &data, std::shared_ptr<CameraMetadata> &metadata)
+{
+    uint64_t baseHash = 0;
+    std::vector<uint32_t> deletedTags;
+    if (!data.ReadUint64(baseHash) || !data.ReadUInt32Vector(&deletedTags) ||
+        deletedTags.size() > MAX_SUPPORTED_TAGS) {
+        METADATA_ERR_LOG("DecodeCameraMetadataDelta read deleted tags failed");
+        return false;
+    }
+    std::shared_ptr<CameraMetadata> changed;
+    DecodeCameraMetadata(data, changed);
+    if (changed == nullptr || !changed->isValid()) {
+        METADATA_ERR_LOG("DecodeCameraMetadataDelta read changed items failed");
+        return false;
     }
+
+    uint64_t localHash = metadata != nullptr ? CalculateCameraMetadataContentHash(metadata->get()) : 0;
+    if (localHash != baseHash) {
+        METADATA_ERR_LOG("DecodeCameraMetadataDelta delta was taken against another base");
+        return false;
+    }
+    if (metadata == nullptr) {
+        metadata = changed;
+        return true;
+    }
+    return metadata->patch(*changed, deletedTags);
 }
 
 void MetadataUtils::ConvertVecToMetadata(const std::vector<uint8_t>& cameraAbility,
@@ -289,34 +453,47 @@ void MetadataUtils::ConvertVecToMetadata(const std::vector<uint8_t>& cameraAbili
         return;
     }
 
-    std::vector<camera_metadata_item_t> items;
+    // Item data is added straight from the vector, nothing is copied out of it first
+    auto result = std::make_shared<CameraMetadata>(itemCapacity, dataCapacity);
+    common_metadata_header_t *meta = result->get();
     for (uint32_t i = 0; i < tagCount; i++) {
         camera_metadata_item_t item;
+        if (cameraAbility.size() - static_cast<size_t>(index) < VEC_ITEM_HEADER_SIZE) {
+            METADATA_ERR_LOG("ConvertVecToMetadata cameraAbility is truncated at item %{public}u", i);
+            return;
+        }
         ReadData<uint32_t>(item.index, index, cameraAbility);
         ReadData<uint32_t>(item.item, index, cameraAbility);
         ReadData<uint32_t>(item.data_type, index, cameraAbility);
         ReadData<uint32_t>(item.count, index, cameraAbility);
-        if (item.count > MAX_SUPPORTED_ITEMS) {
+        if (item.count > MAX_SUPPORTED_ITEMS || item.data_type >= META_NUM_TYPES) {
             METADATA_ERR_LOG("ConvertVecToMetadata item.count out of range:%{public}d item:%{public}d",
                 item.count, item.item);
             return;
         }
-        ReadMetadataDataFromVec(index, item, cameraAbility);
-        items.push_back(item);
-    }
-
-    metadata = std::make_shared<CameraMetadata>(itemCapacity, dataCapacity);
-    common_metadata_header_t *meta = metadata->get();
-    for (auto &item_: items) {
-        void *buffer = nullptr;
-        MetadataUtils::ItemDataToBuffer(item_, &buffer);
-        int32_t addRet = AddCameraMetadataItem(meta, item_.item, buffer, item_.count);
+        size_t dataSize = item.count * OHOS_CAMERA_METADATA_TYPE_SIZE[item.data_type];
+        if (cameraAbility.size() - static_cast<size_t>(index) < dataSize) {
+            METADATA_ERR_LOG("ConvertVecToMetadata item data is truncated, item:%{public}u", item.item);
+            return;
+        }
+        // Add copies by the declared type of the tag, the size checked above only holds if it is the same.
+        // Such an item is skipped like in ReadCameraMetadata, the rest of the ability is kept
+        uint32_t dataType = META_NUM_TYPES;
+        if (GetCameraMetadataItemType(item.item, &dataType) != CAM_META_SUCCESS || dataType != item.data_type) {
+            METADATA_ERR_LOG("ConvertVecToMetadata item data type mismatch! item: %{public}u, data type: %{public}u, "
+                "expected data type: %{public}u", item.item, item.data_type, dataType);
+            index += static_cast<int32_t>(dataSize);
+            continue;
+        }
+        int32_t addRet = AddCameraMetadataItem(meta, item.item, cameraAbility.data() + index, item.count);
         if (addRet != CAM_META_SUCCESS) {
             METADATA_ERR_LOG("ConvertVecToMetadata: AddCameraMetadataItem failed, ret=%{public}d, item=%{public}u",
-                             addRet, item_.item);
+                             addRet, item.item);
         }
-        FreeMetadataBuffer(item_);
+        index += static_cast<int32_t>(dataSize);
     }
+    result->RecalculateContentHash();
+    metadata = result;
 }
 
 void MetadataUtils::ReadCameraMetadata(MessageParcel &data, common_metadata_header_t *meta, uint32_t tagCount)
@@ -325,7 +502,8 @@ void MetadataUtils::ReadCameraMetadata(MessageParcel &data, common_metadata_head
         return;
     }
 
-    std::vector<camera_metadata_item_t> items;
+    // Each item goes straight from the parcel into meta, rationals are staged in one reused buffer
+    std::vector<int32_t> rationalBuffer;
     for (uint32_t i = 0; i < tagCount; i++) {
         camera_metadata_item_t item;
         item.index = data.ReadUint32();
@@ -336,39 +514,39 @@ void MetadataUtils::ReadCameraMetadata(MessageParcel &data, common_metadata_head
             item.count = MAX_SUPPORTED_ITEMS;
             METADATA_ERR_LOG("MetadataUtils::ReadCameraMetadata item.count is more than supported value");
         }
-        MetadataUtils::ReadMetadata(item, data);
+        // The payload is always consumed so that the following items stay in sync
+        const void *buffer = ReadMetadataData(item, data, rationalBuffer);
         uint32_t dataType;
         int32_t ret = GetCameraMetadataItemType(item.item, &dataType);
         if (ret != CAM_META_SUCCESS) {
             METADATA_ERR_LOG("MetadataUtils::ReadCameraMetadata get item type failed!");
-            FreeMetadataBuffer(item);
             continue;
         }
         if (dataType != item.data_type) {
             METADATA_ERR_LOG("MetadataUtils::ReadCameraMetadata item data type mismatch! item: %{public}u,"
                              " data type: %{public}u, expected data type: %{public}u",
                              item.item, item.data_type, dataType);
-            FreeMetadataBuffer(item);
             continue;
         }
-        items.push_back(item);
-    }
-
-    for (auto &item_: items) {
-        void *buffer = nullptr;
-        MetadataUtils::ItemDataToBuffer(item_, &buffer);
-        int32_t addRet = AddCameraMetadataItem(meta, item_.item, buffer, item_.count);
+        if (buffer == nullptr) {
+            METADATA_ERR_LOG("MetadataUtils::ReadCameraMetadata read item data failed, item: %{public}u", item.item);
+            continue;
+        }
+        int32_t addRet = AddCameraMetadataItem(meta, item.item, buffer, item.count);
         if (addRet != CAM_META_SUCCESS) {
             METADATA_ERR_LOG("ReadCameraMetadata: AddCameraMetadataItem failed, ret=%{public}d, item=%{public}u",
-                             addRet, item_.item);
+                             addRet, item.item);
         }
-        FreeMetadataBuffer(item_);
     }
 }
 
 void MetadataUtils::DecodeCameraMetadata(MessageParcel &data, std::shared_ptr<CameraMetadata> &metadata)
 {
     uint32_t tagCount = data.ReadUint32();
+    if (tagCount == METADATA_BLOB_MAGIC) {
+        metadata = ReadCameraMetadataBlob(data);
+        return;
+    }
     uint32_t itemCapacity = data.ReadUint32();
     uint32_t dataCapacity = data.ReadUint32();
 
@@ -393,6 +571,7 @@ void MetadataUtils::DecodeCameraMetadata(MessageParcel &data, std::shared_ptr<Ca
         return;
     }
     ReadCameraMetadata(data, metadata->get(), tagCount);
+    metadata->RecalculateContentHash();
 }
 
 bool MetadataUtils::WriteMetadata(const camera_metadata_item_t &item, MessageParcel &data)
@@ -537,6 +716,7 @@ std::shared_ptr<CameraMetadata> MetadataUtils::DecodeFromString(std::string sett
         "MetadataUtils::DecodeFromString invalid item_start")
     decodeData += headerLength;
     camera_metadata_item_entry_t *item = GetMetadataItems(meta);
+    bool sorted = true;
     for (uint32_t index = 0; index < meta->item_count; index++, item++) {
         METADATA_CHECK_ERROR_RETURN_RET_LOG(totalLen < ((decodeData - &setting[0]) + itemLen), {},
             "MetadataUtils::DecodeFromString Failed at item index: %{public}u", index);
@@ -559,6 +739,11 @@ std::shared_ptr<CameraMetadata> MetadataUtils::DecodeFromString(std::string sett
         IF_COND_PRINT_MSG_AND_RETURN(ret != EOK,
             "MetadataUtils::DecodeFromString Failed to copy memory for item data field")
         decodeData += dataLen;
+        sorted = sorted && (index == 0 || (item - 1)->item <= item->item);
+    }
+    // The header comes from the peer, lookups only binary search items that are really in order
+    if (!sorted) {
+        meta->version &= ~CAMERA_METADATA_FLAG_SORTED_ITEMS;
     }
 
     char *decodeMetadataData = &setting[0];
@@ -566,6 +751,7 @@ std::shared_ptr<CameraMetadata> MetadataUtils::DecodeFromString(std::string sett
     if (ret != CAM_META_SUCCESS) {
         return {};
     }
+    metadata->RecalculateContentHash();
 
     METADATA_DEBUG_LOG("MetadataUtils::DecodeFromString String length: %{public}zu, Decoded length: %{public}zu",
                        setting.capacity(), (decodeData - &setting[0]));
@@ -595,165 +781,22 @@ int MetadataUtils::copyDecodeFromStringMem(common_metadata_header_t *meta, char
     return CAM_META_SUCCESS;
 }
 
-static void ReadMetadataUInt8(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.u8 = new (std::nothrow) uint8_t[entry.count];
-    if (entry.data.u8 == nullptr) {
-        return;
-    }
-    size_t dataSize = entry.count * sizeof(uint8_t);
-    const uint8_t *ptr = data.ReadUnpadBuffer(dataSize);
-    if (ptr == nullptr) {
-        return;
-    }
-    (void)memcpy_s(entry.data.u8, dataSize, ptr, dataSize);
-}
-
-static void ReadMetadataInt32(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.i32 = new (std::nothrow) int32_t[entry.count];
-    if (entry.data.i32 == nullptr) {
-        return;
-    }
-    size_t dataSize = entry.count * sizeof(int32_t);
-    const uint8_t *ptr = data.ReadUnpadBuffer(dataSize);
-    if (ptr == nullptr) {
-        return;
-    }
-    (void)memcpy_s(entry.data.i32, dataSize, ptr, dataSize);
-}
-
-static void ReadMetadataUInt32(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.ui32 = new (std::nothrow) uint32_t[entry.count];
-    if (entry.data.ui32 == nullptr) {
-        return;
-    }
-    size_t dataSize = entry.count * sizeof(uint32_t);
-    const uint8_t *ptr = data.ReadUnpadBuffer(dataSize);
-    if (ptr == nullptr) {
-        return;
-    }
-    (void)memcpy_s(entry.data.ui32, dataSize, ptr, dataSize);
-}
-
-static void ReadMetadataFloat(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.f = new (std::nothrow) float[entry.count];
-    if (entry.data.f == nullptr) {
-        return;
-    }
-    size_t dataSize = entry.count * sizeof(float);
-    const uint8_t *ptr = data.ReadUnpadBuffer(dataSize);
-    if (ptr == nullptr) {
-        return;
-    }
-    (void)memcpy_s(entry.data.f, dataSize, ptr, dataSize);
-}
-
-static void ReadMetadataInt64(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.i64 = new (std::nothrow) int64_t[entry.count];
-    if (entry.data.i64 == nullptr) {
-        return;
-    }
-    size_t dataSize = entry.count * sizeof(int64_t);
-    const uint8_t *ptr = data.ReadUnpadBuffer(dataSize);
-    if (ptr == nullptr) {
-        return;
-    }
-    (void)memcpy_s(entry.data.i64, dataSize, ptr, dataSize);
-}
-
-static void ReadMetadataDouble(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    entry.data.d = new (std::nothrow) double[entry.count];
-    if (entry.data.d == nullptr) {
-        return;
-    }
-    size_t dataSize = entry.count * sizeof(double);
-    const uint8_t *ptr = data.ReadUnpadBuffer(dataSize);
-    if (ptr == nullptr) {
-        return;
-    }
-    (void)memcpy_s(entry.data.d, dataSize, ptr, dataSize);
-}
-
-static void ReadMetadataRational(camera_metadata_item_t &entry, MessageParcel &data)
+const void *MetadataUtils::ReadMetadataData(const camera_metadata_item_t &item, MessageParcel &data,
+    std::vector<int32_t> &rationalBuffer)
 {
-    std::vector<int32_t> buffers;
-    data.ReadInt32Vector(&buffers);
-    if (buffers.size() < 1) {
-        METADATA_ERR_LOG("MetadataUtils::ReadMetadataRational the buffers size < 1");
-        entry.data.r = nullptr;
-        return;
+    if (item.data_type >= META_NUM_TYPES) {
+        return nullptr;
     }
-    entry.data.r = new (std::nothrow) camera_rational_t[entry.count];
-    if (entry.data.r == nullptr) {
-        return;
-    }
-    (void) memset_s(entry.data.r, entry.count * sizeof(camera_rational_t), 0, entry.count * sizeof(camera_rational_t));
-    for (size_t i = 0, j = 0;
-        i < entry.count && j < static_cast<size_t>(buffers.size() - 1);
-        i++, j += 2) { // 2:Take two elements from the buffer vector container
-        entry.data.r[i].numerator = buffers.at(j);
-        entry.data.r[i].denominator = buffers.at(j + 1);
+    if (item.data_type != META_TYPE_RATIONAL) {
+        return data.ReadUnpadBuffer(item.count * OHOS_CAMERA_METADATA_TYPE_SIZE[item.data_type]);
     }
-}
-
-bool MetadataUtils::ReadMetadata(camera_metadata_item_t &entry, MessageParcel &data)
-{
-    if (entry.count > MAX_SUPPORTED_ITEMS) {
-        entry.count = MAX_SUPPORTED_ITEMS;
-        METADATA_ERR_LOG("MetadataUtils::ReadMetadata item.count is more than supported value");
-    }
-    switch (entry.data_type) {
-        case META_TYPE_BYTE:
-            ReadMetadataUInt8(entry, data);
-            break;
-        case META_TYPE_INT32:
-            ReadMetadataInt32(entry, data);
-            break;
-        case META_TYPE_UINT32:
-            ReadMetadataUInt32(entry, data);
-            break;
-        case META_TYPE_FLOAT:
-            ReadMetadataFloat(entry, data);
-            break;
-        case META_TYPE_INT64:
-            ReadMetadataInt64(entry, data);
-            break;
-        case META_TYPE_DOUBLE:
-            ReadMetadataDouble(entry, data);
-            break;
-        case META_TYPE_RATIONAL:
-            ReadMetadataRational(entry, data);
-            break;
-    }
-    return true;
-}
 
-void MetadataUtils::ItemDataToBuffer(const camera_metadata_item_t &item, void **buffer)
-{
-    if (buffer == nullptr) {
-        METADATA_ERR_LOG("MetadataUtils::ItemDataToBuffer buffer is null");
-        return;
-    }
-    if (item.data_type == META_TYPE_BYTE) {
-        *buffer = reinterpret_cast<void *>(item.data.u8);
-    } else if (item.data_type == META_TYPE_INT32) {
-        *buffer = reinterpret_cast<void *>(item.data.i32);
-    } else if (item.data_type == META_TYPE_FLOAT) {
-        *buffer = reinterpret_cast<void *>(item.data.f);
-    } else if (item.data_type == META_TYPE_UINT32) {
-        *buffer = reinterpret_cast<void *>(item.data.ui32);
-    } else if (item.data_type == META_TYPE_INT64) {
-        *buffer = reinterpret_cast<void *>(item.data.i64);
-    } else if (item.data_type == META_TYPE_DOUBLE) {
-        *buffer = reinterpret_cast<void *>(item.data.d);
-    } else if (item.data_type == META_TYPE_RATIONAL) {
-        *buffer = reinterpret_cast<void *>(item.data.r);
+    // Rationals travel as an int32 vector of numerator, denominator pairs, the layout of camera_rational_t
+    if (!data.ReadInt32Vector(&rationalBuffer) || rationalBuffer.size() < static_cast<size_t>(item.count) * 2) {
+        METADATA_ERR_LOG("MetadataUtils::ReadMetadataData rational buffer is too short, item: %{public}u", item.item);
+        return nullptr;
     }
+    return rationalBuffer.data();
 }
 
 void MetadataUtils::FreeMetadataBuffer(camera_metadata_item_t &entry)
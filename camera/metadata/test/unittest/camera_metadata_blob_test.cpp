@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "camera_metadata_info.h"
+#include "camera_metadata_operator.h"
+#include "message_parcel.h"
+#include "metadata_test_utils.h"
+#include "metadata_utils.h"
+
+using namespace OHOS;
+using namespace OHOS::Camera;
+
+namespace {
+std::shared_ptr<CameraMetadata> BlobRoundTrip(const common_metadata_header_t *meta)
+{
+    MessageParcel data;
+    EXPECT_TRUE(MetadataUtils::WriteCameraMetadataBlob(meta, data));
+    std::shared_ptr<CameraMetadata> decoded;
+    MetadataUtils::DecodeCameraMetadata(data, decoded);
+    return decoded;
+}
+} // namespace
+
+TEST(CameraMetadataBlobTest, RoundTripKeepsEntries)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildTestMetadata();
+    MessageParcel data;
+    ASSERT_TRUE(MetadataUtils::EncodeCameraMetadataBlob(metadata, data));
+    std::shared_ptr<CameraMetadata> decoded;
+    MetadataUtils::DecodeCameraMetadata(data, decoded);
+    ASSERT_NE(decoded, nullptr);
+    ExpectSameEntries(*metadata, *decoded);
+    EXPECT_EQ(decoded->get()->item_capacity, metadata->get()->item_capacity);
+    EXPECT_EQ(decoded->get()->data_capacity, metadata->get()->data_capacity);
+    EXPECT_EQ(decoded->GetContentHash(), CalculateCameraMetadataContentHash(metadata->get()));
+}
+
+TEST(CameraMetadataBlobTest, RoundTripOfEmptyMetadata)
+{
+    CameraMetadata metadata(TEST_ITEM_CAPACITY, TEST_DATA_CAPACITY);
+    std::shared_ptr<CameraMetadata> decoded = BlobRoundTrip(metadata.get());
+    ASSERT_NE(decoded, nullptr);
+    EXPECT_EQ(GetCameraMetadataItemCount(decoded->get()), 0U);
+}
+
+TEST(CameraMetadataBlobTest, KeepsSortedFlagOfSortedItems)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildTestMetadata();
+    ASSERT_EQ(SetCameraMetadataItemsSorted(metadata->get(), true), CAM_META_SUCCESS);
+    std::shared_ptr<CameraMetadata> decoded = BlobRoundTrip(metadata->get());
+    ASSERT_NE(decoded, nullptr);
+    EXPECT_TRUE(IsCameraMetadataItemsSorted(decoded->get()));
+    ExpectSameEntries(*metadata, *decoded);
+}
+
+TEST(CameraMetadataBlobTest, ClearsSortedFlagOfUnsortedItems)
+{
+    // BuildTestMetadata adds the tags in descending order, the flag is set without sorting them
+    std::shared_ptr<CameraMetadata> metadata = BuildTestMetadata();
+    metadata->get()->version |= CAMERA_METADATA_FLAG_SORTED_ITEMS;
+    std::shared_ptr<CameraMetadata> decoded = BlobRoundTrip(metadata->get());
+    ASSERT_NE(decoded, nullptr);
+    EXPECT_FALSE(IsCameraMetadataItemsSorted(decoded->get()));
+    metadata->get()->version &= ~CAMERA_METADATA_FLAG_SORTED_ITEMS;
+    ExpectSameEntries(*metadata, *decoded);
+}
+
+TEST(CameraMetadataBlobTest, RejectsWrongDataType)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildTestMetadata();
+    camera_metadata_item_entry_t *entries = GetMetadataItems(metadata->get());
+    ASSERT_NE(entries, nullptr);
+    entries[0].data_type = entries[0].data_type == META_TYPE_BYTE ? META_TYPE_INT32 : META_TYPE_BYTE;
+    EXPECT_EQ(BlobRoundTrip(metadata->get()), nullptr);
+}
+
+TEST(CameraMetadataBlobTest, RejectsItemCountAboveCapacity)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildTestMetadata();
+    metadata->get()->item_count = metadata->get()->item_capacity + 1;
+    EXPECT_EQ(BlobRoundTrip(metadata->get()), nullptr);
+}
+
+TEST(CameraMetadataBlobTest, RejectsDataOutsideDataRegion)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildTestMetadata();
+    camera_metadata_item_t item = {};
+    uint32_t index = 0;
+    ASSERT_EQ(FindCameraMetadataItemIndex(metadata->get(), OHOS_JPEG_GPS_COORDINATES, &index), CAM_META_SUCCESS);
+    camera_metadata_item_entry_t *entries = GetMetadataItems(metadata->get());
+    ASSERT_NE(entries, nullptr);
+    entries[index].data.offset = metadata->get()->data_capacity;
+    EXPECT_NE(GetCameraMetadataItem(metadata->get(), index, &item), CAM_META_SUCCESS);
+    EXPECT_EQ(BlobRoundTrip(metadata->get()), nullptr);
+}
+
+TEST(CameraMetadataBlobTest, RejectsLayoutMismatch)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildTestMetadata();
+    metadata->get()->data_start += sizeof(uint64_t);
+    EXPECT_EQ(BlobRoundTrip(metadata->get()), nullptr);
+}
+
+TEST(CameraMetadataBlobTest, RejectsTruncatedBlob)
+{
+    const uint32_t truncated[] = { 0, 0 };
+    MessageParcel data;
+    ASSERT_TRUE(data.WriteUint32(METADATA_BLOB_MAGIC));
+    ASSERT_TRUE(data.WriteUint32(sizeof(truncated)));
+    ASSERT_TRUE(data.WriteRawData(truncated, sizeof(truncated)));
+    std::shared_ptr<CameraMetadata> decoded;
+    MetadataUtils::DecodeCameraMetadata(data, decoded);
+    EXPECT_EQ(decoded, nullptr);
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "camera_metadata_info.h"
+#include "camera_metadata_operator.h"
+#include "message_parcel.h"
+#include "metadata_test_utils.h"
+#include "metadata_utils.h"
+
+using namespace OHOS;
+using namespace OHOS::Camera;
+
+namespace {
+// Same entries as BuildTestMetadata, with one entry changed, one deleted and one added
+std::shared_ptr<CameraMetadata> BuildChangedMetadata()
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildTestMetadata();
+    const int64_t exposureTime[] = { 10000000 };
+    const float zoomRatio[] = { 2.0f };
+    EXPECT_TRUE(metadata->Set<OHOS_SENSOR_EXPOSURE_TIME>(exposureTime));
+    EXPECT_TRUE(metadata->deleteEntry(OHOS_ABILITY_ZOOM_RATIO_RANGE));
+    EXPECT_TRUE(metadata->Set<OHOS_CONTROL_ZOOM_RATIO>(zoomRatio));
+    return metadata;
+}
+} // namespace
+
+TEST(CameraMetadataDeltaTest, AppliesChangedAndDeletedEntries)
+{
+    std::shared_ptr<CameraMetadata> base = BuildTestMetadata();
+    std::shared_ptr<CameraMetadata> changed = BuildChangedMetadata();
+    MessageParcel data;
+    ASSERT_TRUE(MetadataUtils::EncodeCameraMetadataDelta(base, changed, data));
+
+    std::shared_ptr<CameraMetadata> receiver = BuildTestMetadata();
+    ASSERT_TRUE(MetadataUtils::DecodeCameraMetadataDelta(data, receiver));
+    ExpectSameEntries(*changed, *receiver);
+    EXPECT_EQ(receiver->GetContentHash(), CalculateCameraMetadataContentHash(changed->get()));
+}
+
+TEST(CameraMetadataDeltaTest, IsSmallerThanFullMetadata)
+{
+    std::shared_ptr<CameraMetadata> base = BuildTestMetadata();
+    std::shared_ptr<CameraMetadata> changed = BuildTestMetadata();
+    const int32_t fpsRange[] = { 30, 30 };
+    ASSERT_TRUE(changed->Set<OHOS_CONTROL_AE_TARGET_FPS_RANGE>(fpsRange));
+    MessageParcel delta;
+    ASSERT_TRUE(MetadataUtils::EncodeCameraMetadataDelta(base, changed, delta));
+    MessageParcel full;
+    ASSERT_TRUE(MetadataUtils::EncodeCameraMetadata(changed, full));
+    EXPECT_LT(delta.GetDataSize(), full.GetDataSize());
+}
+
+TEST(CameraMetadataDeltaTest, UnchangedMetadataGivesEmptyDelta)
+{
+    std::shared_ptr<CameraMetadata> base = BuildTestMetadata();
+    MessageParcel data;
+    ASSERT_TRUE(MetadataUtils::EncodeCameraMetadataDelta(base, BuildTestMetadata(), data));
+
+    std::shared_ptr<CameraMetadata> receiver = BuildTestMetadata();
+    uint64_t hash = receiver->GetContentHash();
+    ASSERT_TRUE(MetadataUtils::DecodeCameraMetadataDelta(data, receiver));
+    EXPECT_EQ(receiver->GetContentHash(), hash);
+    ExpectSameEntries(*base, *receiver);
+}
+
+TEST(CameraMetadataDeltaTest, WithoutBaseIsFullSnapshot)
+{
+    std::shared_ptr<CameraMetadata> metadata = BuildTestMetadata();
+    MessageParcel data;
+    ASSERT_TRUE(MetadataUtils::EncodeCameraMetadataDelta(nullptr, metadata, data));
+
+    std::shared_ptr<CameraMetadata> receiver;
+    ASSERT_TRUE(MetadataUtils::DecodeCameraMetadataDelta(data, receiver));
+    ASSERT_NE(receiver, nullptr);
+    ExpectSameEntries(*metadata, *receiver);
+}
+
+TEST(CameraMetadataDeltaTest, RejectsAnotherBase)
+{
+    std::shared_ptr<CameraMetadata> base = BuildTestMetadata();
+    MessageParcel data;
+    ASSERT_TRUE(MetadataUtils::EncodeCameraMetadataDelta(base, BuildChangedMetadata(), data));
+
+    std::shared_ptr<CameraMetadata> receiver = BuildTestMetadata();
+    const uint8_t position[] = { OHOS_CAMERA_POSITION_FRONT };
+    ASSERT_TRUE(receiver->Set<OHOS_ABILITY_CAMERA_POSITION>(position));
+    uint64_t hash = receiver->GetContentHash();
+    EXPECT_FALSE(MetadataUtils::DecodeCameraMetadataDelta(data, receiver));
+    EXPECT_EQ(receiver->GetContentHash(), hash);
+    EXPECT_EQ(receiver->Get<OHOS_ABILITY_CAMERA_POSITION>()[0], OHOS_CAMERA_POSITION_FRONT);
+}
+
+TEST(CameraMetadataDeltaTest, RejectsDeltaWithoutBaseForExistingMetadata)
+{
+    MessageParcel data;
+    ASSERT_TRUE(MetadataUtils::EncodeCameraMetadataDelta(nullptr, BuildChangedMetadata(), data));
+
+    std::shared_ptr<CameraMetadata> receiver = BuildTestMetadata();
+    EXPECT_FALSE(MetadataUtils::DecodeCameraMetadataDelta(data, receiver));
+    ExpectSameEntries(*BuildTestMetadata(), *receiver);
+}
+
+TEST(CameraMetadataDeltaTest, SeesBaseChangedThroughGet)
+{
+    // The delta hashes base from scratch, so a write through get() is not missed
+    std::shared_ptr<CameraMetadata> base = BuildTestMetadata();
+    const int32_t fpsRange[] = { 24, 24 };
+    ASSERT_EQ(UpdateCameraMetadataItem(base->get(), OHOS_CONTROL_AE_TARGET_FPS_RANGE, fpsRange, 2, nullptr),
+        CAM_META_SUCCESS);
+    MessageParcel data;
+    ASSERT_TRUE(MetadataUtils::EncodeCameraMetadataDelta(base, BuildChangedMetadata(), data));
+
+    std::shared_ptr<CameraMetadata> receiver = BuildTestMetadata();
+    EXPECT_FALSE(MetadataUtils::DecodeCameraMetadataDelta(data, receiver));
+}
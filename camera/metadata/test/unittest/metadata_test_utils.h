@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CAMERA_METADATA_TEST_UTILS_H
+#define CAMERA_METADATA_TEST_UTILS_H
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+
+#include "camera_metadata_info.h"
+#include "camera_metadata_item_info.h"
+#include "camera_metadata_operator.h"
+
+namespace OHOS::Camera {
+constexpr uint32_t TEST_ITEM_CAPACITY = 16;
+constexpr uint32_t TEST_DATA_CAPACITY = 256;
+
+// One entry of every data type that fits into the data region, added in descending tag order
+inline std::shared_ptr<CameraMetadata> BuildTestMetadata()
+{
+    auto metadata = std::make_shared<CameraMetadata>(TEST_ITEM_CAPACITY, TEST_DATA_CAPACITY);
+    const double gps[] = { 31.2, 121.5, 12.0 };
+    const float zoomRange[] = { 1.0f, 10.0f };
+    const int64_t exposureTime[] = { 33000000 };
+    const int32_t fpsRange[] = { 15, 30 };
+    const uint8_t position[] = { OHOS_CAMERA_POSITION_BACK };
+    EXPECT_TRUE(metadata->Set<OHOS_JPEG_GPS_COORDINATES>(gps));
+    EXPECT_TRUE(metadata->Set<OHOS_SENSOR_EXPOSURE_TIME>(exposureTime));
+    EXPECT_TRUE(metadata->Set<OHOS_CONTROL_AE_TARGET_FPS_RANGE>(fpsRange));
+    EXPECT_TRUE(metadata->Set<OHOS_ABILITY_ZOOM_RATIO_RANGE>(zoomRange));
+    EXPECT_TRUE(metadata->Set<OHOS_ABILITY_CAMERA_POSITION>(position));
+    return metadata;
+}
+
+inline void ExpectSameEntries(const CameraMetadata &expected, const CameraMetadata &actual)
+{
+    const common_metadata_header_t *expectedMeta = expected.get();
+    const common_metadata_header_t *actualMeta = actual.get();
+    ASSERT_NE(expectedMeta, nullptr);
+    ASSERT_NE(actualMeta, nullptr);
+    ASSERT_EQ(GetCameraMetadataItemCount(actualMeta), GetCameraMetadataItemCount(expectedMeta));
+    for (uint32_t i = 0; i < GetCameraMetadataItemCount(expectedMeta); i++) {
+        camera_metadata_item_t want = {};
+        camera_metadata_item_t got = {};
+        ASSERT_EQ(GetCameraMetadataItem(expectedMeta, i, &want), CAM_META_SUCCESS);
+        ASSERT_EQ(FindCameraMetadataItem(actualMeta, want.item, &got), CAM_META_SUCCESS) << "item " << want.item;
+        ASSERT_EQ(got.data_type, want.data_type);
+        ASSERT_EQ(got.count, want.count);
+        size_t size = want.count * OHOS_CAMERA_METADATA_TYPE_SIZE[want.data_type];
+        EXPECT_EQ(memcmp(got.data.u8, want.data.u8, size), 0) << "item " << want.item;
+    }
+}
+} // namespace OHOS::Camera
+#endif // CAMERA_METADATA_TEST_UTILS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,6 +14,7 @@
  */
 
 #include "securec.h"
+#include <unistd.h>
 #include <message_parcel.h>
 #include "buffer_handle_sequenceable.h"
 #include "buffer_util.h"
@@ -26,6 +27,10 @@ namespace Camera {
 namespace V1_0 {
 using namespace OHOS::HDI::Base;
 
+// Limits of NativeBuffer::Unmarshalling
+static constexpr uint32_t MAX_RESERVE_FDS = 1024;
+static constexpr uint32_t MAX_RESERVE_INTS = 1024;
+
 class BufferHandleSequenceable::BufferHandleWrap {
 public:
     explicit BufferHandleWrap(BufferHandle *bufferHandle = nullptr)
@@ -37,20 +42,113 @@ public:
         }
         nativeBuffer_->SetBufferHandle(bufferHandle);
     }
+    explicit BufferHandleWrap(const sptr<NativeBuffer> &nativeBuffer) : nativeBuffer_(nativeBuffer) {}
     sptr<NativeBuffer> nativeBuffer_;
 };
 
+// Bring a used handle back to the state AllocateNativeBufferHandle creates it in
+static void ResetBufferHandle(BufferHandle *handle)
+{
+    uint32_t reserveFds = handle->reserveFds;
+    uint32_t reserveInts = handle->reserveInts;
+    if (handle->fd >= 0) {
+        close(handle->fd);
+    }
+    for (uint32_t i = 0; i < reserveFds; i++) {
+        if (handle->reserve[i] >= 0) {
+            close(handle->reserve[i]);
+        }
+    }
+    size_t handleSize = sizeof(BufferHandle) + sizeof(int32_t) * (reserveFds + reserveInts);
+    (void)memset_s(handle, handleSize, 0, handleSize);
+    handle->fd = -1;
+    for (uint32_t i = 0; i < reserveFds; i++) {
+        handle->reserve[i] = -1;
+    }
+    handle->reserveFds = reserveFds;
+    handle->reserveInts = reserveInts;
+}
+
+BufferHandlePool::BufferHandlePool(uint32_t maxFreeHandles) : maxFreeHandles_(maxFreeHandles)
+{
+}
+
+BufferHandlePool::~BufferHandlePool()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &[shape, handles] : freeHandles_) {
+        for (BufferHandle *handle : handles) {
+            FreeNativeBufferHandle(handle);
+        }
+    }
+    freeHandles_.clear();
+}
+
+BufferHandle *BufferHandlePool::Acquire(uint32_t reserveFds, uint32_t reserveInts)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = freeHandles_.find(std::make_pair(reserveFds, reserveInts));
+        if (it != freeHandles_.end() && !it->second.empty()) {
+            BufferHandle *handle = it->second.back();
+            it->second.pop_back();
+            return handle;
+        }
+    }
+    return AllocateNativeBufferHandle(reserveFds, reserveInts);
+}
+
+void BufferHandlePool::Release(BufferHandle *handle)
+{
+    if (handle == nullptr) {
+        return;
+    }
+    ResetBufferHandle(handle);
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<BufferHandle *> &handles = freeHandles_[std::make_pair(handle->reserveFds, handle->reserveInts)];
+    if (handles.size() >= maxFreeHandles_) {
+        FreeNativeBufferHandle(handle);
+        return;
+    }
+    if (handles.capacity() == 0) {
+        handles.reserve(maxFreeHandles_);
+    }
+    handles.push_back(handle);
+}
+
 BufferHandleSequenceable::BufferHandleSequenceable(const BufferHandle &bufferHandle)
 {
     auto newBufferHandle = NewBufferHandle(bufferHandle.reserveFds, bufferHandle.reserveInts);
     bufferHandleWrap_ = std::make_shared<BufferHandleWrap>(newBufferHandle);
 }
 
+BufferHandleSequenceable::BufferHandleSequenceable(const BufferHandle &bufferHandle,
+    const std::shared_ptr<BufferHandlePool> &pool)
+{
+    bufferHandleWrap_ = std::make_shared<BufferHandleWrap>();
+    if (pool == nullptr || bufferHandleWrap_->nativeBuffer_ == nullptr) {
+        HDI_CAMERA_LOGE("Buffer handle pool or native buffer is null.");
+        return;
+    }
+    BufferHandle *newBufferHandle = pool->Acquire(bufferHandle.reserveFds, bufferHandle.reserveInts);
+    if (newBufferHandle == nullptr) {
+        HDI_CAMERA_LOGE("Buffer handle acquire failed.");
+        return;
+    }
+    bufferHandleWrap_->nativeBuffer_->SetBufferHandle(newBufferHandle, true,
+        [pool](BufferHandle *handle) { pool->Release(handle); });
+}
+
 BufferHandleSequenceable::BufferHandleSequenceable(BufferHandle *bufferHandle)
 {
     bufferHandleWrap_ = std::make_shared<BufferHandleWrap>(bufferHandle);
 }
 
+BufferHandleSequenceable::BufferHandleSequenceable(std::shared_ptr<BufferHandleWrap> bufferHandleWrap)
+    : bufferHandleWrap_(std::move(bufferHandleWrap))
+{
+}
+
 BufferHandle* BufferHandleSequenceable::NewBufferHandle(uint32_t reserveFds, uint32_t reserveInts)
 {
     return AllocateNativeBufferHandle(reserveFds, reserveInts);
@@ -80,12 +178,85 @@ bool BufferHandleSequenceable::Marshalling(Parcel &parcel) const
 
 sptr<BufferHandleSequenceable> BufferHandleSequenceable::Unmarshalling(Parcel &parcel)
 {
-    sptr<BufferHandleSequenceable> sequenceObj(new BufferHandleSequenceable());
-    if (sequenceObj->bufferHandleWrap_ == nullptr) {
+    // The native buffer comes from the parcel, so the wrap is built around it rather than around an empty one
+    auto bufferHandleWrap = std::make_shared<BufferHandleWrap>(NativeBuffer::Unmarshalling(parcel));
+    sptr<BufferHandleSequenceable> sequenceObj(new BufferHandleSequenceable(std::move(bufferHandleWrap)));
+    return sequenceObj;
+}
+
+// Reads a handle in the layout of NativeBuffer::Marshalling, the valid flag is already consumed
+static BufferHandle *ReadBufferHandle(MessageParcel &parcel, const std::shared_ptr<BufferHandlePool> &pool)
+{
+    uint32_t reserveFds = 0;
+    uint32_t reserveInts = 0;
+    if (!parcel.ReadUint32(reserveFds) || !parcel.ReadUint32(reserveInts) ||
+        reserveFds > MAX_RESERVE_FDS || reserveInts > MAX_RESERVE_INTS) {
+        HDI_CAMERA_LOGE("Invalid reserveFds or reserveInts.");
         return nullptr;
     }
-    sequenceObj->bufferHandleWrap_->nativeBuffer_ = NativeBuffer::Unmarshalling(parcel);
-    return sequenceObj;
+    BufferHandle *handle = (pool != nullptr) ? pool->Acquire(reserveFds, reserveInts) :
+        AllocateNativeBufferHandle(reserveFds, reserveInts);
+    if (handle == nullptr) {
+        HDI_CAMERA_LOGE("Buffer handle allocate failed.");
+        return nullptr;
+    }
+    bool validFd = false;
+    bool ret = parcel.ReadInt32(handle->width) && parcel.ReadInt32(handle->stride) &&
+        parcel.ReadInt32(handle->height) && parcel.ReadInt32(handle->size) && parcel.ReadInt32(handle->format) &&
+        parcel.ReadUint64(handle->usage) && parcel.ReadUint64(handle->phyAddr) && parcel.ReadBool(validFd);
+    if (ret && validFd) {
+        handle->fd = parcel.ReadFileDescriptor();
+        ret = handle->fd >= 0;
+    }
+    for (uint32_t i = 0; ret && i < reserveFds; i++) {
+        handle->reserve[i] = parcel.ReadFileDescriptor();
+        ret = handle->reserve[i] >= 0;
+    }
+    for (uint32_t i = 0; ret && i < reserveInts; i++) {
+        ret = parcel.ReadInt32(handle->reserve[reserveFds + i]);
+    }
+    if (!ret) {
+        HDI_CAMERA_LOGE("Buffer handle read failed.");
+        if (pool != nullptr) {
+            pool->Release(handle);
+        } else {
+            FreeNativeBufferHandle(handle);
+        }
+        return nullptr;
+    }
+    return handle;
+}
+
+bool BufferHandleSequenceable::ReadFromParcel(Parcel &parcel, const std::shared_ptr<BufferHandlePool> &pool)
+{
+    MessageParcel &messageParcel = static_cast<MessageParcel &>(parcel);
+    BufferHandle *handle = nullptr;
+    if (messageParcel.ReadBool()) {
+        handle = ReadBufferHandle(messageParcel, pool);
+        if (handle == nullptr) {
+            return false;
+        }
+    }
+    // Copies share the wrap, this object gets its own before its buffer changes
+    if (bufferHandleWrap_.use_count() > 1 || bufferHandleWrap_->nativeBuffer_ == nullptr) {
+        bufferHandleWrap_ = std::make_shared<BufferHandleWrap>();
+    }
+    if (bufferHandleWrap_->nativeBuffer_ == nullptr) {
+        if (pool != nullptr) {
+            pool->Release(handle);
+        } else {
+            FreeNativeBufferHandle(handle);
+        }
+        return false;
+    }
+    // The previous handle is given back by the native buffer, to the pool when it came from one
+    if (handle != nullptr && pool != nullptr) {
+        bufferHandleWrap_->nativeBuffer_->SetBufferHandle(handle, true,
+            [pool](BufferHandle *bufferHandle) { pool->Release(bufferHandle); });
+    } else {
+        bufferHandleWrap_->nativeBuffer_->SetBufferHandle(handle, true);
+    }
+    return true;
 }
 
 } // V1_0
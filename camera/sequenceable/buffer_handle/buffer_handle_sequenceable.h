@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,7 +17,11 @@
 #define OHOS_HDI_BUFFER_HANDLE_SEQUENCEABLE_H
 
 #include <parcel.h>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 #include "buffer_handle.h"
 
@@ -28,20 +32,48 @@ namespace V1_0 {
 using OHOS::Parcelable;
 using OHOS::Parcel;
 using OHOS::sptr;
+
+// Recycles native buffer handles by their (reserveFds, reserveInts) shape, so that a stream rotating
+// a fixed set of buffers stops allocating a handle for every frame
+class BufferHandlePool {
+public:
+    // At most maxFreeHandles released handles of each shape are kept for reuse
+    explicit BufferHandlePool(uint32_t maxFreeHandles);
+    ~BufferHandlePool();
+    BufferHandlePool(const BufferHandlePool &) = delete;
+    BufferHandlePool &operator=(const BufferHandlePool &) = delete;
+
+    // Handle without fds, like the ones of AllocateNativeBufferHandle, nullptr on failure
+    BufferHandle *Acquire(uint32_t reserveFds, uint32_t reserveInts);
+    // Closes the fds held by handle and keeps it for a later Acquire
+    void Release(BufferHandle *handle);
+
+private:
+    const uint32_t maxFreeHandles_;
+    std::mutex mutex_;
+    std::map<std::pair<uint32_t, uint32_t>, std::vector<BufferHandle *>> freeHandles_;
+};
+
 class BufferHandleSequenceable : public Parcelable {
 public:
     virtual ~BufferHandleSequenceable() = default;
 
     explicit BufferHandleSequenceable(BufferHandle *bufferHandle = nullptr);
     explicit BufferHandleSequenceable(const BufferHandle &bufferHandle);
+    // Owns a handle of the same shape as bufferHandle taken from pool, the last copy gives it back
+    BufferHandleSequenceable(const BufferHandle &bufferHandle, const std::shared_ptr<BufferHandlePool> &pool);
 
     bool Marshalling(Parcel &parcel) const override;
     static sptr<BufferHandleSequenceable> Unmarshalling(Parcel &parcel);
+    // Unmarshal into this object, for receivers that keep one sequenceable per buffer slot. The native buffer
+    // is kept and the handle comes from pool when one is given, copies sharing this object are left unchanged
+    bool ReadFromParcel(Parcel &parcel, const std::shared_ptr<BufferHandlePool> &pool = nullptr);
     static BufferHandle* NewBufferHandle(uint32_t reserveFds, uint32_t reserveInts);
     void SetBufferHandle(BufferHandle *handle);
     BufferHandle* GetBufferHandle();
 private:
     class BufferHandleWrap;
+    explicit BufferHandleSequenceable(std::shared_ptr<BufferHandleWrap> bufferHandleWrap);
     std::shared_ptr<BufferHandleWrap> bufferHandleWrap_;
 };
 } // V1_0
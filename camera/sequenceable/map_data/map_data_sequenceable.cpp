@@ -14,14 +14,15 @@
  */
 
 #include "map_data_sequenceable.h"
+#include <algorithm>
 #include "hdi_log.h"
-#include <message_parcel.h>
 namespace OHOS {
 namespace HDI {
 namespace Camera {
 namespace V1_0 {
 constexpr int32_t BUFFER_DATA_MAGIC = 0x4567;
 constexpr int32_t BUFFER_MAX_USER_DATA_COUNT = 1000;
+constexpr size_t PARCEL_ALIGNMENT = 4;
 
 enum ErrorCode : int32_t {
     ERROR_OK = 0,
@@ -31,11 +32,11 @@ enum ErrorCode : int32_t {
     ERROR_OUT_OF_RANGE = -4,
 };
 
-#define SET_DATA_FROM_POINTER(data, pointer) do { \
-    if ((pointer) != nullptr) { \
-        (data) = *(pointer); \
-    } \
-} while (0)
+// A parcel string is its length followed by the characters and a terminator, padded to the parcel alignment
+static size_t ParcelStringSize(const std::string &str)
+{
+    return sizeof(int32_t) + (str.size() + 1 + PARCEL_ALIGNMENT - 1) / PARCEL_ALIGNMENT * PARCEL_ALIGNMENT;
+}
 
 sptr<MapDataSequenceable> MapDataSequenceable::Unmarshalling(Parcel &parcel)
 {
@@ -52,89 +53,100 @@ sptr<MapDataSequenceable> MapDataSequenceable::Unmarshalling(Parcel &parcel)
     }
     sptr<MapDataSequenceable> sequenceData(new MapDataSequenceable());
 
-    int32_t ret = ERROR_OK;
+    std::vector<MapData> &datas = sequenceData->datas_;
+    datas.reserve(size);
     for (int32_t i = 0; i < size; i++) {
-        auto key = parcel.ReadString();
-        auto type = static_cast<MapDataType>(parcel.ReadInt32());
-        switch (type) {
-            case MapDataType::I32: {
-                ret = sequenceData->Set(key, type, parcel.ReadInt32());
-                break;
-            }
-            case MapDataType::I64: {
-                ret = sequenceData->Set(key, type, parcel.ReadInt64());
-                break;
-            }
-            case MapDataType::F64: {
-                ret = sequenceData->Set(key, type, parcel.ReadDouble());
-                break;
-            }
-            case MapDataType::STRING: {
-                ret = sequenceData->Set(key, type, parcel.ReadString());
-                break;
-            }
-            case MapDataType::U32: {
-                ret = sequenceData->Set(key, type, parcel.ReadUint32());
-                break;
-            }
-            default: break;
-        }
-
-        if (ret != ERROR_OK) {
-            HDI_CAMERA_LOGE("Set extra data failed, return %{public}d", ret);
+        MapData data;
+        bool isKnownType = false;
+        if (!ReadMapData(parcel, data, isKnownType)) {
+            HDI_CAMERA_LOGE("read extra data %{public}d of %{public}d failed", i, size);
             return nullptr;
         }
+        if (isKnownType) {
+            datas.push_back(std::move(data));
+        }
+    }
+
+    // Marshalling writes the keys in order, anything else is sorted once with the last duplicate winning
+    auto keyNotLess = [](const MapData &lhs, const MapData &rhs) { return !(lhs.key < rhs.key); };
+    if (std::adjacent_find(datas.begin(), datas.end(), keyNotLess) != datas.end()) {
+        std::reverse(datas.begin(), datas.end());
+        std::stable_sort(datas.begin(), datas.end(),
+            [](const MapData &lhs, const MapData &rhs) { return lhs.key < rhs.key; });
+        datas.erase(std::unique(datas.begin(), datas.end(),
+            [](const MapData &lhs, const MapData &rhs) { return lhs.key == rhs.key; }), datas.end());
     }
     return sequenceData;
 }
 
+bool MapDataSequenceable::ReadMapData(Parcel &parcel, MapData &data, bool &isKnownType)
+{
+    int32_t type = -1;
+    if (!parcel.ReadString(data.key) || !parcel.ReadInt32(type)) {
+        return false;
+    }
+    isKnownType = true;
+    switch (static_cast<MapDataType>(type)) {
+        case MapDataType::I32:
+            return parcel.ReadInt32(data.val.emplace<int32_t>());
+        case MapDataType::I64:
+            return parcel.ReadInt64(data.val.emplace<int64_t>());
+        case MapDataType::F64:
+            return parcel.ReadDouble(data.val.emplace<double>());
+        case MapDataType::STRING:
+            return parcel.ReadString(data.val.emplace<std::string>());
+        case MapDataType::U32:
+            return parcel.ReadUint32(data.val.emplace<uint32_t>());
+        default:
+            // Nothing follows the type of an unknown entry, it is skipped
+            isKnownType = false;
+            return true;
+    }
+}
+
+bool MapDataSequenceable::WriteMapData(Parcel &parcel, const MapData &data)
+{
+    MapDataType type = static_cast<MapDataType>(data.val.index());
+    if (!parcel.WriteString(data.key) || !parcel.WriteInt32(static_cast<int32_t>(type))) {
+        return false;
+    }
+    switch (type) {
+        case MapDataType::I32:
+            return parcel.WriteInt32(*std::get_if<int32_t>(&data.val));
+        case MapDataType::I64:
+            return parcel.WriteInt64(*std::get_if<int64_t>(&data.val));
+        case MapDataType::F64:
+            return parcel.WriteDouble(*std::get_if<double>(&data.val));
+        case MapDataType::STRING:
+            return parcel.WriteString(*std::get_if<std::string>(&data.val));
+        case MapDataType::U32:
+            return parcel.WriteUint32(*std::get_if<uint32_t>(&data.val));
+        default:
+            return false;
+    }
+}
+
 bool MapDataSequenceable::Marshalling(Parcel &parcel) const
 {
-    OHOS::MessageParcel &dataParcel = static_cast<OHOS::MessageParcel &>(parcel);
     std::lock_guard<std::mutex> lockGuard(mtx_);
-    dataParcel.WriteInt32(BUFFER_DATA_MAGIC);
-    dataParcel.WriteInt32(datas_.size());
-    for (const auto &[key, data] : datas_) {
-        dataParcel.WriteString(key);
-        dataParcel.WriteInt32(static_cast<int32_t>(data.type));
-        switch (data.type) {
-            case MapDataType::I32: {
-                int32_t i32 = -1;
-                auto pVal = std::any_cast<int32_t>(&data.val);
-                SET_DATA_FROM_POINTER(i32, pVal);
-                dataParcel.WriteInt32(i32);
-                break;
-            }
-            case MapDataType::I64: {
-                int64_t i64 = -1;
-                auto pVal = std::any_cast<int64_t>(&data.val);
-                SET_DATA_FROM_POINTER(i64, pVal);
-                dataParcel.WriteInt64(i64);
-                break;
-            }
-            case MapDataType::F64: {
-                double f64 = -1;
-                auto pVal = std::any_cast<double>(&data.val);
-                SET_DATA_FROM_POINTER(f64, pVal);
-                dataParcel.WriteDouble(f64);
-                break;
-            }
-            case MapDataType::STRING: {
-                std::string string = "-1";
-                auto pVal = std::any_cast<std::string>(&data.val);
-                SET_DATA_FROM_POINTER(string, pVal);
-                dataParcel.WriteString(string);
-                break;
-            }
-            case MapDataType::U32: {
-                uint32_t u32 = 0;
-                auto pVal = std::any_cast<uint32_t>(&data.val);
-                SET_DATA_FROM_POINTER(u32, pVal);
-                dataParcel.WriteUint32(u32);
-                break;
-            }
-            default:
-                break;
+    // Grow the parcel once for all entries rather than on every write
+    size_t required = sizeof(int32_t) + sizeof(int32_t);
+    for (const MapData &data : datas_) {
+        required += ParcelStringSize(data.key) + sizeof(int32_t);
+        const std::string *str = std::get_if<std::string>(&data.val);
+        required += (str != nullptr) ? ParcelStringSize(*str) : sizeof(int64_t);
+    }
+    if (parcel.GetWritableBytes() < required) {
+        (void)parcel.SetDataCapacity(parcel.GetDataSize() + required);
+    }
+
+    if (!parcel.WriteInt32(BUFFER_DATA_MAGIC) || !parcel.WriteInt32(static_cast<int32_t>(datas_.size()))) {
+        return false;
+    }
+    for (const MapData &data : datas_) {
+        if (!WriteMapData(parcel, data)) {
+            HDI_CAMERA_LOGE("write extra data %{public}s failed", data.key.c_str());
+            return false;
         }
     }
     return true;
@@ -142,66 +154,70 @@ bool MapDataSequenceable::Marshalling(Parcel &parcel) const
 
 int32_t MapDataSequenceable::Get(const std::string &key, int32_t &value) const
 {
-    return Get<int32_t>(key, MapDataType::I32, value);
+    return GetValue<int32_t>(key, value);
 }
 
 int32_t MapDataSequenceable::Get(const std::string &key, uint32_t &value) const
 {
-    return Get<uint32_t>(key, MapDataType::U32, value);
+    return GetValue<uint32_t>(key, value);
 }
 
 int32_t MapDataSequenceable::Get(const std::string &key, int64_t &value) const
 {
-    return Get<int64_t>(key, MapDataType::I64, value);
+    return GetValue<int64_t>(key, value);
 }
 
 int32_t MapDataSequenceable::Get(const std::string &key, double &value) const
 {
-    return Get<double>(key, MapDataType::F64, value);
+    return GetValue<double>(key, value);
 }
 
 int32_t MapDataSequenceable::Get(const std::string &key, std::string &value) const
 {
-    return Get<std::string>(key, MapDataType::STRING, value);
+    return GetValue<std::string>(key, value);
 }
 
 int32_t MapDataSequenceable::Set(const std::string &key, int32_t value)
 {
-    return Set(key, MapDataType::I32, value);
+    return SetValue<int32_t>(key, value);
 }
 
 int32_t MapDataSequenceable::Set(const std::string &key, uint32_t value)
 {
-    return Set(key, MapDataType::U32, value);
+    return SetValue<uint32_t>(key, value);
 }
 
 int32_t MapDataSequenceable::Set(const std::string &key, int64_t value)
 {
-    return Set(key, MapDataType::I64, value);
+    return SetValue<int64_t>(key, value);
 }
 
 int32_t MapDataSequenceable::Set(const std::string &key, double value)
 {
-    return Set(key, MapDataType::F64, value);
+    return SetValue<double>(key, value);
 }
 
 int32_t MapDataSequenceable::Set(const std::string &key, const std::string& value)
 {
-    return Set(key, MapDataType::STRING, value);
+    return SetValue<std::string>(key, value);
+}
+
+size_t MapDataSequenceable::LowerBound(const std::string &key) const
+{
+    auto it = std::lower_bound(datas_.begin(), datas_.end(), key,
+        [](const MapData &data, const std::string &value) { return data.key < value; });
+    return static_cast<size_t>(it - datas_.begin());
 }
 
 template<class T>
-int32_t MapDataSequenceable::Get(const std::string &key, MapDataType type, T &value) const
+int32_t MapDataSequenceable::GetValue(const std::string &key, T &value) const
 {
     std::lock_guard<std::mutex> lockGuard(mtx_);
-    auto it = datas_.find(key);
-    if (it == datas_.end()) {
+    size_t pos = LowerBound(key);
+    if (pos == datas_.size() || datas_[pos].key != key) {
         return ERROR_NO_ENTRY;
     }
-    if (it->second.type != type) {
-        return ERROR_TYPE_ERROR;
-    }
-    auto pVal = std::any_cast<T>(&it->second.val);
+    const T *pVal = std::get_if<T>(&datas_[pos].val);
     if (pVal == nullptr) {
         return ERROR_TYPE_ERROR;
     }
@@ -209,16 +225,20 @@ int32_t MapDataSequenceable::Get(const std::string &key, MapDataType type, T &va
     return ERROR_OK;
 }
 
-int32_t MapDataSequenceable::Set(const std::string &key, MapDataType type, const std::any& val)
+template<class T>
+int32_t MapDataSequenceable::SetValue(const std::string &key, T value)
 {
     std::lock_guard<std::mutex> lockGuard(mtx_);
-    auto it = datas_.find(key);
-    if (it == datas_.end() && datas_.size() >= BUFFER_MAX_USER_DATA_COUNT) {
+    size_t pos = LowerBound(key);
+    if (pos < datas_.size() && datas_[pos].key == key) {
+        datas_[pos].val.emplace<T>(std::move(value));
+        return ERROR_OK;
+    }
+    if (datas_.size() >= BUFFER_MAX_USER_DATA_COUNT) {
         HDI_CAMERA_LOGW("SurfaceBuffer has too many extra data, cannot save one more!!!");
         return ERROR_OUT_OF_RANGE;
     }
-    datas_[key].type = type;
-    datas_[key].val = val;
+    datas_.insert(datas_.begin() + pos, MapData { key, MapDataValue(std::in_place_type<T>, std::move(value)) });
     return ERROR_OK;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,8 +19,8 @@
 #include <parcel.h>
 #include <string>
 #include <vector>
-#include <any>
-#include <map>
+#include <type_traits>
+#include <variant>
 #include <mutex>
 namespace OHOS {
 namespace HDI {
@@ -58,15 +58,27 @@ private:
         STRING,
         U32,
     };
-    template<class T>
-    int32_t Get(const std::string &key, MapDataType type, T &value) const;
-    int32_t Set(const std::string &key, MapDataType type, const std::any& val);
-
+    // Alternatives are listed in MapDataType order, so the active index is the type of the value
+    using MapDataValue = std::variant<int32_t, int64_t, double, std::string, uint32_t>;
+    static_assert(std::variant_size_v<MapDataValue> == static_cast<size_t>(MapDataType::U32) + 1 &&
+        std::is_same_v<std::variant_alternative_t<static_cast<size_t>(MapDataType::STRING), MapDataValue>,
+        std::string>, "MapDataValue alternatives must follow MapDataType");
     struct MapData {
-        std::any val;
-        MapDataType type;
+        std::string key;
+        MapDataValue val;
     };
-    std::map<std::string, struct MapData> datas_;
+
+    template<class T>
+    int32_t GetValue(const std::string &key, T &value) const;
+    template<class T>
+    int32_t SetValue(const std::string &key, T value);
+    // Position of key in datas_, or where it would be inserted
+    size_t LowerBound(const std::string &key) const;
+    static bool WriteMapData(Parcel &parcel, const MapData &data);
+    static bool ReadMapData(Parcel &parcel, MapData &data, bool &isKnownType);
+
+    // Sorted by key, lookups binary search and entries are marshalled in one sequential pass
+    std::vector<MapData> datas_;
     mutable std::mutex mtx_;
 };
 } // V1_0
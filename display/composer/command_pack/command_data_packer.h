@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,6 +17,7 @@
 #define DISPLAY_COMMAND_DATA_PACKER_H
 
 #include <memory>
+#include <utility>
 #include <securec.h>
 #include "common/include/display_interface_utils.h"
 #include "hilog/log.h"
@@ -89,6 +90,41 @@ public:
         return Write<int32_t>(value);
     }
 
+    // Writes len followed by the bytes padded to 4 bytes, one copy instead of a word per byte.
+    bool WriteRawBytes(const void *data, uint32_t len)
+    {
+        DISPLAY_CHK_RETURN(data == nullptr && len != 0, false,
+            HDF_LOGE("%{public}s, data is nullptr", __func__));
+        size_t alignedLen = (static_cast<size_t>(len) + SECTION_LEN_ALIGN - 1) &
+            ~static_cast<size_t>(SECTION_LEN_ALIGN - 1);
+        DISPLAY_CHK_RETURN(!Reserve(sizeof(uint32_t) + alignedLen), false,
+            HDF_LOGE("%{public}s, reserve %{public}zu bytes error", __func__, alignedLen));
+        *reinterpret_cast<uint32_t *>(data_ + writePos_) = len;
+        writePos_ += sizeof(uint32_t);
+        if (len != 0 && memcpy_s(data_ + writePos_, packSize_ - writePos_, data, len) != EOK) {
+            HDF_LOGE("%{public}s: memcpy_s failed", __func__);
+            writePos_ -= sizeof(uint32_t);
+            return false;
+        }
+        if (alignedLen != len) {
+            (void)memset_s(data_ + writePos_ + len, packSize_ - writePos_ - len, 0, alignedLen - len);
+        }
+        writePos_ += alignedLen;
+        return true;
+    }
+
+    // Exchanges buffers and pack state, so a packed request can be handed over without copying it.
+    void Swap(CommandDataPacker& other)
+    {
+        std::swap(packSize_, other.packSize_);
+        std::swap(writePos_, other.writePos_);
+        std::swap(curSecOffset_, other.curSecOffset_);
+        std::swap(settingSecLen_, other.settingSecLen_);
+        std::swap(curSecLenPos_, other.curSecLenPos_);
+        std::swap(data_, other.data_);
+        std::swap(isAdaptiveGrowth_, other.isAdaptiveGrowth_);
+    }
+
     size_t ValidSize()
     {
         return writePos_;
@@ -200,6 +236,17 @@ private:
     bool Write(T value)
     {
         size_t writeSize = sizeof(T);
+        if (!Reserve(writeSize)) {
+            return false;
+        }
+        *reinterpret_cast<T *>(data_ + writePos_) = value;
+        writePos_ += writeSize;
+
+        return true;
+    }
+
+    bool Reserve(size_t writeSize)
+    {
         size_t newSize = writePos_ + writeSize;
         if (newSize > packSize_) {
             if (!isAdaptiveGrowth_) {
@@ -222,9 +269,6 @@ private:
             data_ = newData;
             packSize_ = newSize;
         }
-        *reinterpret_cast<T *>(data_ + writePos_) = value;
-        writePos_ += writeSize;
-
         return true;
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -71,6 +71,33 @@ public:
         return ret;
     }
 
+    // Reads a block written by CommandDataPacker::WriteRawBytes, data points into the unpacker buffer.
+    bool ReadRawBytes(const char *&data, uint32_t &len)
+    {
+        uint32_t rawLen = 0;
+        DISPLAY_CHK_RETURN(Read<uint32_t>(rawLen) == false, false,
+            HDF_LOGE("%{public}s, read len error", __func__));
+        // Checked before aligning, so rawLen + SECTION_LEN_ALIGN cannot wrap a 32 bit size_t
+        if (rawLen > MAX_RAW_BYTES_LEN || rawLen > packSize_ - readPos_) {
+            HDF_LOGE("Read overflow, readPos=%{public}zu + %{public}u, packSize=%{public}zu.",
+                readPos_, rawLen, packSize_);
+            readPos_ -= sizeof(uint32_t);
+            return false;
+        }
+        size_t alignedLen = (static_cast<size_t>(rawLen) + SECTION_LEN_ALIGN - 1) &
+            ~static_cast<size_t>(SECTION_LEN_ALIGN - 1);
+        if (alignedLen > packSize_ - readPos_) {
+            HDF_LOGE("Read overflow, readPos=%{public}zu + %{public}zu, packSize=%{public}zu.",
+                readPos_, alignedLen, packSize_);
+            readPos_ -= sizeof(uint32_t);
+            return false;
+        }
+        data = data_ + readPos_;
+        len = rawLen;
+        readPos_ += alignedLen;
+        return true;
+    }
+
     char *GetDataPtr()
     {
         return data_;
@@ -166,6 +193,7 @@ private:
     static constexpr uint32_t SECTION_END_MAGIC = 0xB5B5B5B5;
     static constexpr uint32_t COMMAND_ID_SIZE = sizeof(int32_t);
     static constexpr int32_t SECTION_LEN_ALIGN = 4;
+    static constexpr uint32_t MAX_RAW_BYTES_LEN = 10485760; // 10M, the same as CmdUtils::MAX_MEMORY
     static constexpr uint32_t DUMP_HALF_LINE_SPACE = 4;
     static constexpr uint32_t DUMP_LINE_LEN = 8;
 
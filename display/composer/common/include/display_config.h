@@ -29,6 +29,13 @@ static bool GetEnableParallel()
         std::atoi((system::GetParameter("persist.debug.composer.hdi.enableparallel", "1")).c_str()) != 0;
     return enableParallel;
 }
+
+static bool GetEnableLayerStateCache()
+{
+    static bool enableLayerStateCache =
+        std::atoi((system::GetParameter("persist.debug.composer.hdi.layerstatecache", "0")).c_str()) != 0;
+    return enableLayerStateCache;
+}
 } // namespace Display
 } // namespace HDI
 } // namespace OHOS
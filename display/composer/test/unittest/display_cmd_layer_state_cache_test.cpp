@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "display_cmd_test_utils.h"
+
+using namespace OHOS::HDI::Display::Composer;
+
+namespace {
+constexpr uint32_t LAYER_COUNT = 10;
+// Properties set per layer by SetFrame
+constexpr uint32_t FRAME_PROPERTIES = 3;
+constexpr uint32_t FULL_FRAME_CALLS = LAYER_COUNT * FRAME_PROPERTIES;
+// Long enough for the test thread to pack a frame while the asynchronous commit is in flight
+constexpr uint32_t IN_FLIGHT_DELAY_MS = 200;
+} // namespace
+
+class DisplayCmdLayerStateCacheTest : public testing::Test {
+protected:
+    using Requester = CmdLoopback<ResponserV1_2>::Requester;
+
+    void SetUp() override
+    {
+        ASSERT_NE(loopback_.requester, nullptr);
+        loopback_.requester->EnableLayerStateCache(true);
+    }
+
+    // Sets the same frame as the previous call unless the zorder of layer 0 changes
+    void SetFrame(uint32_t zorder0)
+    {
+        for (uint32_t layerId = 0; layerId < LAYER_COUNT; layerId++) {
+            ASSERT_EQ(Req().SetLayerZorder(0, layerId, layerId == 0 ? zorder0 : layerId), HDF_SUCCESS);
+            ASSERT_EQ(Req().SetLayerRegion(0, layerId, IRect { 0, 0, 100, static_cast<int32_t>(layerId) }),
+                HDF_SUCCESS);
+            ASSERT_EQ(Req().SetLayerAlpha(0, layerId, LayerAlpha { true, false, 1, 2, 3 }), HDF_SUCCESS);
+        }
+    }
+
+    // VDI layer property calls made by the commit of the frame set by SetFrame
+    uint32_t CommitFrame(uint32_t zorder0, int32_t expectedRet = HDF_SUCCESS)
+    {
+        uint32_t calls = GetFakeVdiRecord().layerStateCalls;
+        SetFrame(zorder0);
+        int32_t fence = -1;
+        EXPECT_EQ(Req().Commit(0, fence), expectedRet);
+        return GetFakeVdiRecord().layerStateCalls - calls;
+    }
+
+    int32_t CommitSync()
+    {
+        int32_t fence = -1;
+        int32_t skipState = -1;
+        bool needFlush = false;
+        std::vector<uint32_t> layers;
+        std::vector<int32_t> fences;
+        return Req().CommitAndGetReleaseFence(0, fence, false, skipState, needFlush, layers, fences, true);
+    }
+
+    Requester& Req()
+    {
+        return *loopback_.requester;
+    }
+
+    CmdLoopback<ResponserV1_2> loopback_;
+};
+
+TEST_F(DisplayCmdLayerStateCacheTest, DisabledCacheSendsEverything)
+{
+    Req().EnableLayerStateCache(false);
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    EXPECT_EQ(Req().GetLayerStateCacheStats().setCalls, 0);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, SuppressesUnchangedValues)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    uint32_t fullEleCnt = loopback_.composer->requestEleCnt;
+    EXPECT_EQ(CommitFrame(0), 0);
+    EXPECT_LT(loopback_.composer->requestEleCnt, fullEleCnt);
+
+    auto stats = Req().GetLayerStateCacheStats();
+    EXPECT_EQ(stats.setCalls, 2 * FULL_FRAME_CALLS);
+    EXPECT_EQ(stats.suppressed, FULL_FRAME_CALLS);
+    EXPECT_EQ(stats.fieldSuppressed[0], LAYER_COUNT);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, SendsOnlyChangedValues)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    EXPECT_EQ(CommitFrame(42), 1);
+    EXPECT_EQ(GetFakeVdiRecord().zorder[LayerKey(0, 0)], 42);
+    // Going back to an older value is a change as well
+    EXPECT_EQ(CommitFrame(0), 1);
+    EXPECT_EQ(GetFakeVdiRecord().zorder[LayerKey(0, 0)], 0);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, ChangeRevertedWithinFrameIsNotSent)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    uint32_t calls = GetFakeVdiRecord().layerStateCalls;
+    SetFrame(0);
+    ASSERT_EQ(Req().SetLayerZorder(0, 1, 7), HDF_SUCCESS);
+    ASSERT_EQ(Req().SetLayerZorder(0, 1, 1), HDF_SUCCESS);
+    int32_t fence = -1;
+    ASSERT_EQ(Req().Commit(0, fence), HDF_SUCCESS);
+    EXPECT_EQ(GetFakeVdiRecord().layerStateCalls, calls);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, InvalidatesOneLayer)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    Req().InvalidateLayerStateCache(0, 3);
+    EXPECT_EQ(CommitFrame(0), FRAME_PROPERTIES);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, InvalidatesOneDevice)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    Req().InvalidateLayerStateCache(5);
+    EXPECT_EQ(CommitFrame(0), 0);
+    Req().InvalidateLayerStateCache(0);
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, InvalidationFromAnotherThreadAfterSuppression)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    uint32_t calls = GetFakeVdiRecord().layerStateCalls;
+    SetFrame(0);
+    std::thread([this] { Req().InvalidateLayerStateCache(0); }).join();
+    int32_t fence = -1;
+    ASSERT_EQ(Req().Commit(0, fence), HDF_SUCCESS);
+    EXPECT_EQ(GetFakeVdiRecord().layerStateCalls - calls, FULL_FRAME_CALLS);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, TransferFailureInvalidates)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    loopback_.composer->failNext = true;
+    EXPECT_EQ(CommitFrame(9, HDF_FAILURE), 1);
+    EXPECT_EQ(CommitFrame(9), FULL_FRAME_CALLS);
+    EXPECT_EQ(CommitFrame(9), 0);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, RejectedValueInvalidates)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    GetFakeVdiRecord().zorderRet = HDF_FAILURE;
+    // The commit itself still succeeds
+    EXPECT_EQ(CommitFrame(14), 1);
+    GetFakeVdiRecord().zorderRet = HDF_SUCCESS;
+    EXPECT_EQ(CommitFrame(14), FULL_FRAME_CALLS);
+    EXPECT_EQ(CommitFrame(14), 0);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, OtherErrorsKeepCache)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    GetFakeVdiRecord().perFrameRet = HDF_FAILURE;
+    uint32_t calls = GetFakeVdiRecord().layerStateCalls;
+    SetFrame(0);
+    ASSERT_EQ(Req().SetLayerPerFrameParameterSmq(0, 1, "key", { 1 }), HDF_SUCCESS);
+    int32_t fence = -1;
+    ASSERT_EQ(Req().Commit(0, fence), HDF_SUCCESS);
+    EXPECT_EQ(GetFakeVdiRecord().perFrameCalls, 1);
+    EXPECT_EQ(GetFakeVdiRecord().layerStateCalls, calls);
+    EXPECT_EQ(CommitFrame(0), 0);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, AsyncFailureInvalidatesWithoutBlockingNextFrame)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    uint32_t calls = GetFakeVdiRecord().layerStateCalls;
+    loopback_.composer->delayMs = IN_FLIGHT_DELAY_MS;
+    loopback_.composer->failNext = true;
+    std::atomic<int32_t> asyncRet {HDF_SUCCESS};
+    std::atomic<bool> asyncDone {false};
+    SetFrame(11);
+    ASSERT_EQ(Req().CommitAndGetReleaseFenceAsync(0, false, true,
+        [&asyncRet, &asyncDone](int32_t ret, Requester::FenceData&) {
+            asyncRet = ret;
+            asyncDone = true;
+        }), HDF_SUCCESS);
+    // Packing the next frame does not wait for the commit in flight
+    SetFrame(11);
+    EXPECT_FALSE(asyncDone.load());
+    ASSERT_EQ(CommitSync(), HDF_SUCCESS);
+    loopback_.composer->delayMs = 0;
+    ASSERT_TRUE(asyncDone.load());
+    EXPECT_NE(asyncRet.load(), HDF_SUCCESS);
+    // The value in flight was not suppressed, the failure brings back every other one on the next frame
+    EXPECT_EQ(GetFakeVdiRecord().layerStateCalls - calls, 2);
+    EXPECT_EQ(CommitFrame(11), FULL_FRAME_CALLS);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, AsyncRejectedValueInvalidates)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    GetFakeVdiRecord().zorderRet = HDF_FAILURE;
+    SetFrame(15);
+    ASSERT_EQ(Req().CommitAndGetReleaseFenceAsync(0, false, true, [](int32_t, Requester::FenceData&) {}),
+        HDF_SUCCESS);
+    std::vector<uint32_t> layers;
+    std::vector<int32_t> types;
+    // Waits for the commit in flight
+    ASSERT_EQ(Req().GetDisplayCompChange(0, layers, types), HDF_SUCCESS);
+    GetFakeVdiRecord().zorderRet = HDF_SUCCESS;
+    EXPECT_EQ(CommitFrame(15), FULL_FRAME_CALLS);
+}
+
+TEST_F(DisplayCmdLayerStateCacheTest, ReenablingStartsEmpty)
+{
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    Req().EnableLayerStateCache(false);
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    // Invalidations while disabled are not queued
+    Req().InvalidateLayerStateCache(0);
+    Req().EnableLayerStateCache(true);
+    EXPECT_EQ(CommitFrame(0), FULL_FRAME_CALLS);
+    EXPECT_EQ(CommitFrame(0), 0);
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "display_cmd_test_utils.h"
+
+using namespace OHOS::HDI::Display;
+using namespace OHOS::HDI::Display::Composer;
+using V1_2::LayerState;
+using LayerStateUtils = V1_2::DisplayCmdUtils;
+
+namespace {
+constexpr uint32_t WORD_SIZE = sizeof(int32_t);
+
+// Every field set to a value derived from seed, dirty is left to the caller
+LayerState MakeLayerState(uint32_t devId, uint32_t layerId, uint32_t seed)
+{
+    LayerState state;
+    state.devId = devId;
+    state.layerId = layerId;
+    state.zorder = seed;
+    state.preMulti = (seed % 2) != 0;
+    state.transformType = static_cast<int32_t>(ROTATE_90);
+    state.compositionType = static_cast<int32_t>(V1_0::COMPOSITION_DEVICE);
+    state.blendType = static_cast<int32_t>(BLEND_SRC);
+    state.maskInfo = static_cast<uint32_t>(LAYER_HBM_SYNC);
+    state.alpha = { true, false, static_cast<uint8_t>(seed), 2, 3 };
+    state.region = { 0, static_cast<int32_t>(seed), 1920, 1080 };
+    state.crop = { -static_cast<int32_t>(seed), 1, 2, 3 };
+    state.color = { static_cast<uint8_t>(seed), 4, 5, 6 };
+    return state;
+}
+
+void ExpectSameDirtyFields(const LayerState& expected, const LayerState& actual)
+{
+    EXPECT_EQ(actual.devId, expected.devId);
+    EXPECT_EQ(actual.layerId, expected.layerId);
+    ASSERT_EQ(actual.dirty, expected.dirty);
+    for (uint32_t i = 0; i < LayerStateUtils::LAYER_STATE_FIELD_COUNT; i++) {
+        uint32_t field = 1U << i;
+        if ((expected.dirty & field) != 0) {
+            EXPECT_TRUE(LayerStateUtils::LayerStateFieldEqual(field, expected, actual)) << "field " << field;
+        }
+    }
+}
+
+template <typename Requester>
+void SetLayerState(Requester& requester, const LayerState& state)
+{
+    uint32_t devId = state.devId;
+    uint32_t layerId = state.layerId;
+    ASSERT_EQ(requester.SetLayerZorder(devId, layerId, state.zorder), HDF_SUCCESS);
+    ASSERT_EQ(requester.SetLayerPreMulti(devId, layerId, state.preMulti), HDF_SUCCESS);
+    ASSERT_EQ(requester.SetLayerTransformMode(devId, layerId, static_cast<TransformType>(state.transformType)),
+        HDF_SUCCESS);
+    ASSERT_EQ(requester.SetLayerCompositionType(devId, layerId,
+        static_cast<V1_0::CompositionType>(state.compositionType)), HDF_SUCCESS);
+    ASSERT_EQ(requester.SetLayerBlendType(devId, layerId, static_cast<BlendType>(state.blendType)), HDF_SUCCESS);
+    ASSERT_EQ(requester.SetLayerMaskInfo(devId, layerId, static_cast<MaskInfo>(state.maskInfo)), HDF_SUCCESS);
+    ASSERT_EQ(requester.SetLayerAlpha(devId, layerId, state.alpha), HDF_SUCCESS);
+    ASSERT_EQ(requester.SetLayerRegion(devId, layerId, state.region), HDF_SUCCESS);
+    ASSERT_EQ(requester.SetLayerCrop(devId, layerId, state.crop), HDF_SUCCESS);
+    ASSERT_EQ(requester.SetLayerColor(devId, layerId, state.color), HDF_SUCCESS);
+}
+
+void ExpectVdiGotLayerState(const LayerState& state)
+{
+    FakeVdiRecord& record = GetFakeVdiRecord();
+    LayerKey key(state.devId, state.layerId);
+    ASSERT_EQ(record.zorder.count(key), 1);
+    EXPECT_EQ(record.zorder[key], state.zorder);
+    EXPECT_EQ(record.preMulti[key], state.preMulti);
+    EXPECT_EQ(record.transformType[key], state.transformType);
+    EXPECT_EQ(record.compositionType[key], state.compositionType);
+    EXPECT_EQ(record.blendType[key], state.blendType);
+    EXPECT_EQ(static_cast<uint32_t>(record.maskInfo[key]), state.maskInfo);
+
+    LayerState got = state;
+    got.alpha = record.alpha[key];
+    got.region = record.region[key];
+    got.crop = record.crop[key];
+    got.color = record.color[key];
+    EXPECT_TRUE(LayerStateUtils::LayerStateFieldEqual(LayerStateUtils::LAYER_STATE_ALPHA, state, got));
+    EXPECT_TRUE(LayerStateUtils::LayerStateFieldEqual(LayerStateUtils::LAYER_STATE_REGION, state, got));
+    EXPECT_TRUE(LayerStateUtils::LayerStateFieldEqual(LayerStateUtils::LAYER_STATE_CROP, state, got));
+    EXPECT_TRUE(LayerStateUtils::LayerStateFieldEqual(LayerStateUtils::LAYER_STATE_COLOR, state, got));
+}
+} // namespace
+
+TEST(DisplayCmdLayersStateTest, PackUnpackKeepsDirtyFields)
+{
+    std::vector<LayerState> states;
+    states.push_back(MakeLayerState(0, 3, 1));
+    states.back().dirty = LayerStateUtils::LAYER_STATE_ALL;
+    states.push_back(MakeLayerState(1, 4, 2));
+    states.back().dirty = LayerStateUtils::LAYER_STATE_ZORDER;
+    states.push_back(MakeLayerState(0, 5, 3));
+    states.back().dirty = 0;
+    states.push_back(MakeLayerState(0, 6, 4));
+    states.back().dirty = LayerStateUtils::LAYER_STATE_ALPHA | LayerStateUtils::LAYER_STATE_CROP;
+
+    CommandDataPacker packer;
+    ASSERT_TRUE(packer.Init());
+    ASSERT_EQ(LayerStateUtils::LayersStatePack(0, states, packer), HDF_SUCCESS);
+    CommandDataUnpacker unpacker;
+    unpacker.Init(packer.GetDataPtr(), packer.ValidSize());
+    std::vector<LayerState> unpacked;
+    ASSERT_EQ(LayerStateUtils::LayersStateUnpack(unpacker, unpacked), HDF_SUCCESS);
+
+    // Only the dirty layers of the device, in order
+    ASSERT_EQ(unpacked.size(), 2);
+    ExpectSameDirtyFields(states[0], unpacked[0]);
+    ExpectSameDirtyFields(states[3], unpacked[1]);
+}
+
+TEST(DisplayCmdLayersStateTest, RejectsUnknownDirtyField)
+{
+    const uint32_t layerId = 1;
+    const uint32_t dirty = 1U << LayerStateUtils::LAYER_STATE_FIELD_COUNT;
+    CommandDataPacker packer;
+    ASSERT_TRUE(packer.Init());
+    ASSERT_TRUE(packer.WriteUint32(0));
+    ASSERT_TRUE(packer.WriteRawBytes(&layerId, WORD_SIZE));
+    ASSERT_TRUE(packer.WriteRawBytes(&dirty, WORD_SIZE));
+
+    CommandDataUnpacker unpacker;
+    unpacker.Init(packer.GetDataPtr(), packer.ValidSize());
+    std::vector<LayerState> unpacked;
+    EXPECT_NE(LayerStateUtils::LayersStateUnpack(unpacker, unpacked), HDF_SUCCESS);
+}
+
+TEST(DisplayCmdLayersStateTest, RejectsFieldArrayOfAnotherLength)
+{
+    const uint32_t layerId = 1;
+    const uint32_t dirty = LayerStateUtils::LAYER_STATE_ZORDER;
+    const int32_t zorders[] = { 1, 2 };
+    CommandDataPacker packer;
+    ASSERT_TRUE(packer.Init());
+    ASSERT_TRUE(packer.WriteUint32(0));
+    ASSERT_TRUE(packer.WriteRawBytes(&layerId, WORD_SIZE));
+    ASSERT_TRUE(packer.WriteRawBytes(&dirty, WORD_SIZE));
+    ASSERT_TRUE(packer.WriteRawBytes(zorders, sizeof(zorders)));
+
+    CommandDataUnpacker unpacker;
+    unpacker.Init(packer.GetDataPtr(), packer.ValidSize());
+    std::vector<LayerState> unpacked;
+    EXPECT_NE(LayerStateUtils::LayersStateUnpack(unpacker, unpacked), HDF_SUCCESS);
+}
+
+TEST(DisplayCmdLayersStateTest, ReachesVdi)
+{
+    CmdLoopback<ResponserV1_2> loopback;
+    ASSERT_NE(loopback.requester, nullptr);
+    std::vector<LayerState> states;
+    for (uint32_t layerId = 0; layerId < 3; layerId++) {
+        states.push_back(MakeLayerState(0, layerId, layerId + 10));
+        SetLayerState(*loopback.requester, states.back());
+    }
+    int32_t fence = -1;
+    ASSERT_EQ(loopback.requester->Commit(0, fence), HDF_SUCCESS);
+
+    EXPECT_EQ(GetFakeVdiRecord().layerStateCalls, states.size() * LayerStateUtils::LAYER_STATE_FIELD_COUNT);
+    for (const auto& state : states) {
+        ExpectVdiGotLayerState(state);
+    }
+}
+
+TEST(DisplayCmdLayersStateTest, LastValueOfFrameWins)
+{
+    CmdLoopback<ResponserV1_2> loopback;
+    ASSERT_NE(loopback.requester, nullptr);
+    ASSERT_EQ(loopback.requester->SetLayerZorder(0, 1, 5), HDF_SUCCESS);
+    ASSERT_EQ(loopback.requester->SetLayerZorder(0, 1, 6), HDF_SUCCESS);
+    int32_t fence = -1;
+    ASSERT_EQ(loopback.requester->Commit(0, fence), HDF_SUCCESS);
+
+    EXPECT_EQ(GetFakeVdiRecord().layerStateCalls, 1);
+    EXPECT_EQ(GetFakeVdiRecord().zorder[LayerKey(0, 1)], 6);
+}
+
+TEST(DisplayCmdLayersStateTest, IsSmallerThanSingleLayerCommands)
+{
+    const uint32_t layerCount = 40;
+    int32_t fence = -1;
+    uint32_t singleEleCnt = 0;
+    {
+        // A host without SET_LAYERS_STATE rejects the probe and gets one section per call
+        CmdLoopback<ResponserV1_1> loopback;
+        ASSERT_NE(loopback.requester, nullptr);
+        for (uint32_t layerId = 0; layerId < layerCount; layerId++) {
+            SetLayerState(*loopback.requester, MakeLayerState(0, layerId, layerId));
+        }
+        ASSERT_EQ(loopback.requester->Commit(0, fence), HDF_SUCCESS);
+        singleEleCnt = loopback.composer->requestEleCnt;
+        ExpectVdiGotLayerState(MakeLayerState(0, layerCount - 1, layerCount - 1));
+    }
+    CmdLoopback<ResponserV1_2> loopback;
+    ASSERT_NE(loopback.requester, nullptr);
+    for (uint32_t layerId = 0; layerId < layerCount; layerId++) {
+        SetLayerState(*loopback.requester, MakeLayerState(0, layerId, layerId));
+    }
+    ASSERT_EQ(loopback.requester->Commit(0, fence), HDF_SUCCESS);
+    ExpectVdiGotLayerState(MakeLayerState(0, layerCount - 1, layerCount - 1));
+    EXPECT_LT(loopback.composer->requestEleCnt * 2, singleEleCnt);
+}
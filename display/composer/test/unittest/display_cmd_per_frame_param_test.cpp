@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include "display_cmd_test_utils.h"
+
+using namespace OHOS::HDI::Display;
+using namespace OHOS::HDI::Display::Composer;
+
+namespace {
+constexpr uint32_t WORD_SIZE = sizeof(int32_t);
+
+std::vector<int8_t> MakeValue(size_t size)
+{
+    std::vector<int8_t> value(size);
+    for (size_t i = 0; i < size; i++) {
+        value[i] = static_cast<int8_t>(i * 37);
+    }
+    return value;
+}
+} // namespace
+
+TEST(DisplayCmdRawBytesTest, RoundTripPadsToWords)
+{
+    const char bytes[] = { 'a', 'b', 'c', 'd', 'e' };
+    const uint32_t sentinel = 0x5a5a5a5a;
+    CommandDataPacker packer;
+    ASSERT_TRUE(packer.Init());
+    ASSERT_TRUE(packer.WriteRawBytes(bytes, sizeof(bytes)));
+    ASSERT_TRUE(packer.WriteUint32(sentinel));
+    // Length word, the bytes padded to two words, then the next value
+    EXPECT_EQ(packer.ValidSize(), WORD_SIZE + 2 * WORD_SIZE + WORD_SIZE);
+
+    CommandDataUnpacker unpacker;
+    unpacker.Init(packer.GetDataPtr(), packer.ValidSize());
+    const char *data = nullptr;
+    uint32_t len = 0;
+    ASSERT_TRUE(unpacker.ReadRawBytes(data, len));
+    ASSERT_EQ(len, sizeof(bytes));
+    EXPECT_EQ(memcmp(data, bytes, len), 0);
+    uint32_t value = 0;
+    ASSERT_TRUE(unpacker.ReadUint32(value));
+    EXPECT_EQ(value, sentinel);
+}
+
+TEST(DisplayCmdRawBytesTest, EmptyBlockIsLengthOnly)
+{
+    CommandDataPacker packer;
+    ASSERT_TRUE(packer.Init());
+    ASSERT_TRUE(packer.WriteRawBytes(nullptr, 0));
+    EXPECT_EQ(packer.ValidSize(), WORD_SIZE);
+
+    CommandDataUnpacker unpacker;
+    unpacker.Init(packer.GetDataPtr(), packer.ValidSize());
+    const char *data = nullptr;
+    uint32_t len = 1;
+    ASSERT_TRUE(unpacker.ReadRawBytes(data, len));
+    EXPECT_EQ(len, 0);
+}
+
+TEST(DisplayCmdRawBytesTest, RejectsBlockPastThePack)
+{
+    const std::vector<int8_t> bytes = MakeValue(16);
+    CommandDataPacker packer;
+    ASSERT_TRUE(packer.Init());
+    ASSERT_TRUE(packer.WriteRawBytes(bytes.data(), bytes.size()));
+
+    CommandDataUnpacker unpacker;
+    unpacker.Init(packer.GetDataPtr(), packer.ValidSize() - WORD_SIZE);
+    const char *data = nullptr;
+    uint32_t len = 0;
+    EXPECT_FALSE(unpacker.ReadRawBytes(data, len));
+    // The length word is not consumed either
+    uint32_t rawLen = 0;
+    ASSERT_TRUE(unpacker.ReadUint32(rawLen));
+    EXPECT_EQ(rawLen, bytes.size());
+}
+
+TEST(DisplayCmdPerFrameParamTest, LayerParameterArrivesIntact)
+{
+    CmdLoopback<ResponserV1_2> loopback;
+    ASSERT_NE(loopback.requester, nullptr);
+    const std::string key = "ArsrDoEnhance";
+    const std::vector<int8_t> value = { -128, -1, 0, 1, 127 };
+    int32_t fence = -1;
+    ASSERT_EQ(loopback.requester->SetLayerPerFrameParameterSmq(1, 7, key, value), HDF_SUCCESS);
+    ASSERT_EQ(loopback.requester->Commit(1, fence), HDF_SUCCESS);
+
+    const FakeVdiRecord& record = GetFakeVdiRecord();
+    ASSERT_EQ(record.perFrameCalls, 1);
+    EXPECT_EQ(record.perFrameDevId, 1);
+    EXPECT_EQ(record.perFrameLayerId, 7);
+    EXPECT_EQ(record.perFrameKey, key);
+    EXPECT_EQ(record.perFrameValue, value);
+}
+
+TEST(DisplayCmdPerFrameParamTest, DisplayParameterArrivesIntact)
+{
+    CmdLoopback<ResponserV1_2> loopback;
+    ASSERT_NE(loopback.requester, nullptr);
+    const std::string key = "SDRBrightnessRatio";
+    const std::vector<int8_t> value = MakeValue(7);
+    int32_t fence = -1;
+    ASSERT_EQ(loopback.requester->SetDisplayPerFrameParameterSmq(2, key, value), HDF_SUCCESS);
+    ASSERT_EQ(loopback.requester->Commit(2, fence), HDF_SUCCESS);
+
+    const FakeVdiRecord& record = GetFakeVdiRecord();
+    ASSERT_EQ(record.perFrameCalls, 1);
+    EXPECT_EQ(record.perFrameDevId, 2);
+    EXPECT_EQ(record.perFrameKey, key);
+    EXPECT_EQ(record.perFrameValue, value);
+}
+
+TEST(DisplayCmdPerFrameParamTest, IsPackedAsRawBytes)
+{
+    CmdLoopback<ResponserV1_2> loopback;
+    ASSERT_NE(loopback.requester, nullptr);
+    int32_t fence = -1;
+    ASSERT_EQ(loopback.requester->Commit(0, fence), HDF_SUCCESS);
+    uint32_t commitEleCnt = loopback.composer->requestEleCnt;
+
+    const std::string key(64, 'k');
+    const std::vector<int8_t> value = MakeValue(128);
+    ASSERT_EQ(loopback.requester->SetLayerPerFrameParameterSmq(0, 1, key, value), HDF_SUCCESS);
+    ASSERT_EQ(loopback.requester->Commit(0, fence), HDF_SUCCESS);
+    uint32_t paramEleCnt = loopback.composer->requestEleCnt - commitEleCnt;
+    // A word per character and byte before, a word per four of them now
+    EXPECT_LT(paramEleCnt, (key.size() + value.size()) / 2);
+    EXPECT_EQ(GetFakeVdiRecord().perFrameValue, value);
+}
+
+TEST(DisplayCmdPerFrameParamTest, NotSupportedIsNotReported)
+{
+    CmdLoopback<ResponserV1_2> loopback;
+    ASSERT_NE(loopback.requester, nullptr);
+    int32_t fence = -1;
+    ASSERT_EQ(loopback.requester->SetLayerPerFrameParameterSmq(0, 1, "key", { 1 }), HDF_SUCCESS);
+    ASSERT_EQ(loopback.requester->Commit(0, fence), HDF_SUCCESS);
+    uint32_t cleanReplyEleCnt = loopback.composer->replyEleCnt;
+
+    GetFakeVdiRecord().perFrameRet = HDF_ERR_NOT_SUPPORT;
+    ASSERT_EQ(loopback.requester->SetLayerPerFrameParameterSmq(0, 1, "key", { 1 }), HDF_SUCCESS);
+    ASSERT_EQ(loopback.requester->Commit(0, fence), HDF_SUCCESS);
+    EXPECT_EQ(loopback.composer->replyEleCnt, cleanReplyEleCnt);
+
+    GetFakeVdiRecord().perFrameRet = HDF_FAILURE;
+    ASSERT_EQ(loopback.requester->SetLayerPerFrameParameterSmq(0, 1, "key", { 1 }), HDF_SUCCESS);
+    ASSERT_EQ(loopback.requester->Commit(0, fence), HDF_SUCCESS);
+    EXPECT_GT(loopback.composer->replyEleCnt, cleanReplyEleCnt);
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_HDI_DISPLAY_COMPOSER_DISPLAY_CMD_TEST_UTILS_H
+#define OHOS_HDI_DISPLAY_COMPOSER_DISPLAY_CMD_TEST_UTILS_H
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "v1_2/display_command/display_cmd_requester.h"
+// The responder headers reuse the include guards of the requester headers
+#undef OHOS_HDI_DISPLAY_V1_0_DISPLAY_CMD_REQUESTER_H
+#undef OHOS_HDI_DISPLAY_V1_1_DISPLAY_CMD_REQUESTER_H
+#undef OHOS_HDI_DISPLAY_V1_2_DISPLAY_CMD_REQUESTER_H
+#include "v1_2/display_command/display_cmd_responser.h"
+
+namespace OHOS {
+namespace HDI {
+namespace Display {
+namespace Composer {
+using TestTransfer = SharedMemQueue<int32_t>;
+using LayerKey = std::pair<uint32_t, uint32_t>;
+
+// What the fake VDI was called with, keyed by (devId, layerId) for the layer properties
+struct FakeVdiRecord {
+    uint32_t layerStateCalls = 0;
+    std::map<LayerKey, uint32_t> zorder;
+    std::map<LayerKey, bool> preMulti;
+    std::map<LayerKey, TransformType> transformType;
+    std::map<LayerKey, V1_0::CompositionType> compositionType;
+    std::map<LayerKey, BlendType> blendType;
+    std::map<LayerKey, MaskInfo> maskInfo;
+    std::map<LayerKey, LayerAlpha> alpha;
+    std::map<LayerKey, IRect> region;
+    std::map<LayerKey, IRect> crop;
+    std::map<LayerKey, LayerColor> color;
+    int32_t zorderRet = HDF_SUCCESS;
+
+    uint32_t perFrameCalls = 0;
+    uint32_t perFrameDevId = 0;
+    uint32_t perFrameLayerId = 0;
+    std::string perFrameKey;
+    std::vector<int8_t> perFrameValue;
+    int32_t perFrameRet = HDF_SUCCESS;
+};
+
+// The VDI runs on the requester worker for asynchronous commits, read the record after the commit finished
+inline FakeVdiRecord& GetFakeVdiRecord()
+{
+    static FakeVdiRecord record;
+    return record;
+}
+
+template <typename T>
+inline int32_t RecordLayerState(std::map<LayerKey, T>& field, uint32_t devId, uint32_t layerId, const T& value)
+{
+    GetFakeVdiRecord().layerStateCalls++;
+    field[LayerKey(devId, layerId)] = value;
+    return HDF_SUCCESS;
+}
+
+inline int32_t RecordPerFrameParameter(uint32_t devId, uint32_t layerId, const std::string& key,
+    const std::vector<int8_t>& value)
+{
+    FakeVdiRecord& record = GetFakeVdiRecord();
+    record.perFrameCalls++;
+    record.perFrameDevId = devId;
+    record.perFrameLayerId = layerId;
+    record.perFrameKey = key;
+    record.perFrameValue = value;
+    return record.perFrameRet;
+}
+
+// Adapter over GetFakeVdiRecord, the entries the responder does not use stay nullptr
+inline DisplayComposerVdiAdapter MakeFakeVdiAdapter()
+{
+    DisplayComposerVdiAdapter adapter = {};
+    adapter.Commit = [](uint32_t devId, int32_t& fence) {
+        fence = -1;
+        return HDF_SUCCESS;
+    };
+    adapter.PrepareDisplayLayers = [](uint32_t devId, bool& needFlushFb) {
+        needFlushFb = false;
+        return HDF_SUCCESS;
+    };
+    adapter.GetDisplayCompChange = [](uint32_t devId, std::vector<uint32_t>& layers, std::vector<int32_t>& types) {
+        return HDF_SUCCESS;
+    };
+    adapter.GetDisplayReleaseFence = [](uint32_t devId, std::vector<uint32_t>& layers,
+        std::vector<int32_t>& fences) {
+        return HDF_SUCCESS;
+    };
+    adapter.SetLayerZorder = [](uint32_t devId, uint32_t layerId, uint32_t zorder) {
+        RecordLayerState(GetFakeVdiRecord().zorder, devId, layerId, zorder);
+        return GetFakeVdiRecord().zorderRet;
+    };
+    adapter.SetLayerPreMulti = [](uint32_t devId, uint32_t layerId, bool preMul) {
+        return RecordLayerState(GetFakeVdiRecord().preMulti, devId, layerId, preMul);
+    };
+    adapter.SetLayerTransformMode = [](uint32_t devId, uint32_t layerId, TransformType type) {
+        return RecordLayerState(GetFakeVdiRecord().transformType, devId, layerId, type);
+    };
+    adapter.SetLayerCompositionType = [](uint32_t devId, uint32_t layerId, V1_0::CompositionType type) {
+        return RecordLayerState(GetFakeVdiRecord().compositionType, devId, layerId, type);
+    };
+    adapter.SetLayerBlendType = [](uint32_t devId, uint32_t layerId, BlendType type) {
+        return RecordLayerState(GetFakeVdiRecord().blendType, devId, layerId, type);
+    };
+    adapter.SetLayerMaskInfo = [](uint32_t devId, uint32_t layerId, const MaskInfo maskInfo) {
+        return RecordLayerState(GetFakeVdiRecord().maskInfo, devId, layerId, maskInfo);
+    };
+    adapter.SetLayerAlpha = [](uint32_t devId, uint32_t layerId, const LayerAlpha& alpha) {
+        return RecordLayerState(GetFakeVdiRecord().alpha, devId, layerId, alpha);
+    };
+    adapter.SetLayerRegion = [](uint32_t devId, uint32_t layerId, const IRect& rect) {
+        return RecordLayerState(GetFakeVdiRecord().region, devId, layerId, rect);
+    };
+    adapter.SetLayerCrop = [](uint32_t devId, uint32_t layerId, const IRect& rect) {
+        return RecordLayerState(GetFakeVdiRecord().crop, devId, layerId, rect);
+    };
+    adapter.SetLayerColor = [](uint32_t devId, uint32_t layerId, const LayerColor& layerColor) {
+        return RecordLayerState(GetFakeVdiRecord().color, devId, layerId, layerColor);
+    };
+    adapter.SetLayerPerFrameParameter = RecordPerFrameParameter;
+    adapter.SetDisplayPerFrameParameter = [](uint32_t devId, const std::string& key,
+        const std::vector<int8_t>& value) {
+        return RecordPerFrameParameter(devId, UINT32_MAX, key, value);
+    };
+    return adapter;
+}
+
+// Stands in for the composer service: hands every request of the requester straight to a responder
+template <typename Responser>
+class LoopbackComposer : public RefBase {
+public:
+    explicit LoopbackComposer(Responser* responser) : responser_(responser) {}
+
+    int32_t InitCmdRequest(const std::shared_ptr<TestTransfer>& request)
+    {
+        return responser_->InitCmdRequest(request);
+    }
+
+    int32_t GetCmdReply(std::shared_ptr<TestTransfer>& reply)
+    {
+        int32_t ret = responser_->GetCmdReply(reply);
+        reply_ = reply;
+        return ret;
+    }
+
+    int32_t CmdRequest(uint32_t inEleCnt, const std::vector<HdifdInfo>& inFds, uint32_t& outEleCnt,
+        std::vector<HdifdInfo>& outFds)
+    {
+        requestEleCnt = inEleCnt;
+        int32_t ret = responser_->CmdRequest(inEleCnt, inFds, outEleCnt, outFds);
+        replyEleCnt = outEleCnt;
+        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs.load()));
+        if (failNext.exchange(false)) {
+            // The reply is lost, drain it so that the next one is read from the start of the queue
+            std::vector<int32_t> lost(outEleCnt);
+            reply_->Read(lost.data(), outEleCnt, 0);
+            outEleCnt = 0;
+            return HDF_FAILURE;
+        }
+        return ret;
+    }
+
+    // Written by the requester thread making the transfer, read them once it returned
+    uint32_t requestEleCnt = 0;
+    uint32_t replyEleCnt = 0;
+    std::atomic<bool> failNext {false};
+    std::atomic<uint32_t> delayMs {0};
+
+private:
+    Responser* responser_;
+    std::shared_ptr<TestTransfer> reply_;
+};
+
+// A requester wired to a responder of the given version over the fake VDI
+template <typename Responser>
+struct CmdLoopback {
+    using Composer = LoopbackComposer<Responser>;
+    using Requester = V1_2::DisplayCmdRequester<TestTransfer, Composer>;
+
+    CmdLoopback()
+    {
+        GetFakeVdiRecord() = FakeVdiRecord();
+        vdi = MakeFakeVdiAdapter();
+        responser = Responser::Create(&vdi, std::make_shared<DeviceCacheManager>());
+        composer = new Composer(responser.get());
+        requester = Requester::Create(composer);
+    }
+
+    DisplayComposerVdiAdapter vdi;
+    std::unique_ptr<Responser> responser;
+    sptr<Composer> composer;
+    std::unique_ptr<Requester> requester;
+};
+
+using ResponserV1_1 = V1_1::DisplayCmdResponser<TestTransfer, DisplayComposerVdiAdapter>;
+using ResponserV1_2 = V1_2::DisplayCmdResponser<TestTransfer, DisplayComposerVdiAdapter>;
+} // namespace Composer
+} // namespace Display
+} // namespace HDI
+} // namespace OHOS
+#endif // OHOS_HDI_DISPLAY_COMPOSER_DISPLAY_CMD_TEST_UTILS_H
@@ -16,6 +16,10 @@
 #ifndef OHOS_HDI_DISPLAY_V1_0_DISPLAY_CMD_REQUESTER_H
 #define OHOS_HDI_DISPLAY_V1_0_DISPLAY_CMD_REQUESTER_H
 
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include "base/hdi_smq.h"
 #include "command_pack/command_data_packer.h"
@@ -45,6 +49,19 @@ public:
     {
     }
 
+    ~DisplayCmdRequester()
+    {
+        {
+            std::lock_guard<std::mutex> lock(asyncMutex_);
+            asyncExit_ = true;
+        }
+        asyncCond_.notify_all();
+        if (asyncWorker_.joinable()) {
+            asyncWorker_.join();
+        }
+        ReleaseHdiFds(inflightHdiFds_);
+    }
+
     static std::unique_ptr<DisplayCmdRequester> Create(sptr<CompHdi> hdi)
     {
         DISPLAY_CHK_RETURN(hdi == nullptr, nullptr, HDF_LOGE("%{public}s: hdi is nullptr", __func__));
@@ -745,6 +762,8 @@ EXIT:
 
     int32_t GetDisplayCompChange(uint32_t devId, std::vector<uint32_t>& layers, std::vector<int32_t>& types)
     {
+        // The reply of an asynchronous request may still be filling compChangeLayers_
+        WaitAsyncRequest();
         layers = compChangeLayers_[devId];
         types = compChangeTypes_[devId];
         compChangeLayers_.erase(devId);
@@ -815,7 +834,7 @@ protected:
     }
 
     int32_t OnReplyCommit(
-        CommandDataUnpacker& replyUnpacker, std::vector<HdifdInfo>& replyFds, int32_t &fenceFd)
+        CommandDataUnpacker& replyUnpacker, const HdifdIndex& replyFds, int32_t &fenceFd)
     {
         int32_t ret = CmdUtils::FileDescriptorUnpack(replyUnpacker, replyFds, fenceFd);
         DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
@@ -824,7 +843,7 @@ protected:
     }
 
     int32_t ProcessUnpackCmd(CommandDataUnpacker& replyUnpacker, int32_t unpackCmd,
-        std::vector<HdifdInfo>& replyFds, std::function<int32_t(void *)> fn)
+        const HdifdIndex& replyFds, std::function<int32_t(void *)> fn)
     {
         int32_t ret = HDF_SUCCESS;
         while (replyUnpacker.NextSection()) {
@@ -861,8 +880,12 @@ protected:
                     ret = OnReplySetError(replyUnpacker, errMaps);
                     DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
                         HDF_LOGE("%{public}s: OnReplySetError failed", __func__));
-                    DISPLAY_CHK_RETURN(errMaps.size() > 0, HDF_FAILURE,
-                        HDF_LOGE("error: server return errs, size=%{public}zu", errMaps.size()));
+                    // Failed set calls are reported, not treated as a failure of the whole request
+                    for (const auto& err : errMaps) {
+                        HDF_LOGE("error: server return err, cmd=%{public}s, ret=%{public}d",
+                            CmdUtils::CommandToString(err.first), err.second);
+                    }
+                    replyErrMaps_.insert(errMaps.begin(), errMaps.end());
                     break;
                 default:
                     HDF_LOGE("Unpack command failure, unpacked cmd = %{public}d", unpackCmd);
@@ -885,7 +908,9 @@ protected:
             HDF_LOGE("%{public}s: PackBegin failed", __func__));
         DISPLAY_CHK_RETURN(unpackCmd != CONTROL_CMD_REPLY_BEGIN, HDF_FAILURE,
             HDF_LOGE("%{public}s: PackBegin cmd not match, unpackCmd=%{public}d", __func__, unpackCmd));
-        if (ProcessUnpackCmd(replyUnpacker, unpackCmd, replyFds, fn) != HDF_SUCCESS) {
+        replyErrMaps_.clear();
+        HdifdIndex replyFdIndex(replyFds);
+        if (ProcessUnpackCmd(replyUnpacker, unpackCmd, replyFdIndex, fn) != HDF_SUCCESS) {
             return HDF_FAILURE;
         }
 
@@ -902,22 +927,32 @@ protected:
 
     int32_t DoRequest(uint32_t &replyEleCnt, std::vector<HdifdInfo> &outFds)
     {
+        // The SMQs and the reply buffer are shared with the asynchronous request in flight
+        WaitAsyncRequest();
+        int32_t ret = DoRequest(requestPacker_, requestHdiFds_, replyEleCnt, outFds);
+        if (ret != HDF_SUCCESS) {
+            ReqCmdDump();
+        }
+        reqCmdMaps.clear();
+        return ret;
+    }
+
+    int32_t DoRequest(CommandDataPacker &packer, const std::vector<HdifdInfo> &hdiFds, uint32_t &replyEleCnt,
+        std::vector<HdifdInfo> &outFds)
+    {
 #ifdef DEBUG_DISPLAY_CMD_RAW_DATA
-        requestPacker_.Dump();
+        packer.Dump();
 #endif // DEBUG_DISPLAY_CMD_RAW_DATA
-        uint32_t eleCnt = requestPacker_.ValidSize() >> CmdUtils::MOVE_SIZE;
+        uint32_t eleCnt = packer.ValidSize() >> CmdUtils::MOVE_SIZE;
         int32_t ret = request_->Write(
-            reinterpret_cast<int32_t *>(requestPacker_.GetDataPtr()), eleCnt, CmdUtils::TRANSFER_WAIT_TIME);
+            reinterpret_cast<int32_t *>(packer.GetDataPtr()), eleCnt, CmdUtils::TRANSFER_WAIT_TIME);
         if (ret != HDF_SUCCESS) {
             HDF_LOGE("%{public}s: CmdRequest write failed, ret=[%{public}d], eleCnt=[%{public}u]",
                 __func__, ret, eleCnt);
-            ReqCmdDump();
-            reqCmdMaps.clear();
             return ret;
         }
-        reqCmdMaps.clear();
 
-        ret = hdi_->CmdRequest(eleCnt, requestHdiFds_, replyEleCnt, outFds);
+        ret = hdi_->CmdRequest(eleCnt, hdiFds, replyEleCnt, outFds);
         DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
             HDF_LOGE("%{public}s: CmdRequest failed", __func__));
 
@@ -933,15 +968,20 @@ protected:
     }
 
 protected:
-    int32_t PeriodDataReset()
+    static void ReleaseHdiFds(std::vector<HdifdInfo>& hdiFds)
     {
-        for (uint32_t i = 0; i < requestHdiFds_.size(); ++i) {
-            int32_t fd = requestHdiFds_[i].hdiFd->Move();
+        for (uint32_t i = 0; i < hdiFds.size(); ++i) {
+            int32_t fd = hdiFds[i].hdiFd->Move();
             if (fd != -1) {
                 close(fd);
             }
         }
-        requestHdiFds_.clear();
+        hdiFds.clear();
+    }
+
+    int32_t PeriodDataReset()
+    {
+        ReleaseHdiFds(requestHdiFds_);
         reqCmdMaps.clear();
         int32_t ret = CmdUtils::StartPack(CONTROL_CMD_REQUEST_BEGIN, requestPacker_);
         DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
@@ -950,6 +990,67 @@ protected:
         return HDF_SUCCESS;
     }
 
+    // Blocks until the asynchronous request in flight, if any, has run its completion.
+    void WaitAsyncRequest()
+    {
+        std::unique_lock<std::mutex> lock(asyncMutex_);
+        asyncCond_.wait(lock, [this] { return !asyncBusy_; });
+    }
+
+    // Hands the packed request over to the worker thread, which runs transfer while the caller packs the next
+    // request into the swapped in spare buffers. transfer only touches the packer and fds it is given, and
+    // returns the result of DoRequest, whose failure dumps the request statistics like the synchronous path.
+    int32_t SubmitAsyncRequest(
+        std::function<int32_t(CommandDataPacker&, const std::vector<HdifdInfo>&)> transfer)
+    {
+        DISPLAY_CHK_RETURN(transfer == nullptr, HDF_FAILURE, HDF_LOGE("%{public}s: transfer is nullptr", __func__));
+        WaitAsyncRequest();
+        if (!asyncWorker_.joinable()) {
+            DISPLAY_CHK_RETURN(inflightPacker_.Init(requestPacker_.PackSize()) == false, HDF_FAILURE,
+                HDF_LOGE("%{public}s: inflightPacker init failed", __func__));
+            asyncWorker_ = std::thread([this] { AsyncWorkerLoop(); });
+        }
+
+        requestPacker_.Swap(inflightPacker_);
+        requestHdiFds_.swap(inflightHdiFds_);
+        inflightReqCmdMaps_.swap(reqCmdMaps);
+        reqCmdMaps.clear();
+        {
+            std::lock_guard<std::mutex> lock(asyncMutex_);
+            asyncTask_ = [this, transfer] {
+                if (transfer(inflightPacker_, inflightHdiFds_) != HDF_SUCCESS) {
+                    ReqCmdDump(inflightReqCmdMaps_);
+                }
+                ReleaseHdiFds(inflightHdiFds_);
+            };
+            asyncBusy_ = true;
+        }
+        asyncCond_.notify_all();
+
+        int32_t ret = CmdUtils::StartPack(CONTROL_CMD_REQUEST_BEGIN, requestPacker_);
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
+            HDF_LOGE("%{public}s: StartPack failed", __func__));
+        return HDF_SUCCESS;
+    }
+
+    void AsyncWorkerLoop()
+    {
+        std::unique_lock<std::mutex> lock(asyncMutex_);
+        while (true) {
+            asyncCond_.wait(lock, [this] { return asyncExit_ || asyncTask_ != nullptr; });
+            if (asyncTask_ == nullptr) {
+                return;
+            }
+            std::function<void()> task = std::move(asyncTask_);
+            asyncTask_ = nullptr;
+            lock.unlock();
+            task();
+            lock.lock();
+            asyncBusy_ = false;
+            asyncCond_.notify_all();
+        }
+    }
+
     struct ReqCmdInfo {
         uint32_t count = 0;
         uint32_t len = 0;
@@ -984,10 +1085,15 @@ protected:
     }
 
     void ReqCmdDump()
+    {
+        ReqCmdDump(reqCmdMaps);
+    }
+
+    static void ReqCmdDump(const std::unordered_map<uint32_t, std::unordered_map<int32_t, ReqCmdInfo>>& cmdMaps)
     {
         HDF_LOGW("@  DevId |  cmdId | count |  len  \n");
         HDF_LOGW("@ -------+--------+-------+-------\n");
-        for (auto iterDev = reqCmdMaps.begin(); iterDev != reqCmdMaps.end(); iterDev++) {
+        for (auto iterDev = cmdMaps.begin(); iterDev != cmdMaps.end(); iterDev++) {
             for (auto iterCmdInfo = iterDev->second.begin(); iterCmdInfo != iterDev->second.end(); iterCmdInfo++) {
                 HDF_LOGW("@    %{public}u   |   %{public}d   |   %{public}u   |  %{public}u   \n",
                     iterDev->first, iterCmdInfo->first, iterCmdInfo->second.count, iterCmdInfo->second.len);
@@ -1006,8 +1112,20 @@ protected:
     // Composition layers/types changed
     std::unordered_map<uint32_t, std::vector<uint32_t>> compChangeLayers_;
     std::unordered_map<uint32_t, std::vector<int32_t>> compChangeTypes_;
+    // Failed set calls reported in the last reply unpacked by DoReplyResults, cmdId: ret
+    std::unordered_map<int32_t, int32_t> replyErrMaps_;
     // devId: [cmdId: (count, len)]
     std::unordered_map<uint32_t, std::unordered_map<int32_t, ReqCmdInfo>> reqCmdMaps = {};
+    // Asynchronous request: the spare buffers being transferred and the worker that transfers them
+    CommandDataPacker inflightPacker_;
+    std::vector<HdifdInfo> inflightHdiFds_;
+    std::unordered_map<uint32_t, std::unordered_map<int32_t, ReqCmdInfo>> inflightReqCmdMaps_;
+    std::thread asyncWorker_;
+    std::mutex asyncMutex_;
+    std::condition_variable asyncCond_;
+    std::function<void()> asyncTask_;
+    bool asyncBusy_ = false;
+    bool asyncExit_ = false;
 };
 using HdiDisplayCmdRequester = DisplayCmdRequester<SharedMemQueue<int32_t>, IDisplayComposer>;
 } // namespace V1_0
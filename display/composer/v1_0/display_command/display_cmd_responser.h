@@ -100,6 +100,8 @@ public:
             request_.reset();
         }
         request_ = request;
+        // A new requester, it has to show again that it tolerates error sections
+        replyErrorsEnabled_ = false;
 
         return HDF_SUCCESS;
     }
@@ -127,7 +129,7 @@ public:
     }
 
     int32_t ProcessRequestCmd(CommandDataUnpacker& unpacker, int32_t cmd,
-        const std::vector<HdifdInfo>& inFds, std::vector<HdifdInfo>& outFds)
+        const HdifdIndex& inFds, std::vector<HdifdInfo>& outFds)
     {
         int32_t ret = HDF_SUCCESS;
         switch (cmd) {
@@ -147,7 +149,6 @@ public:
             case REQUEST_CMD_SET_LAYER_COMPOSITION_TYPE: OnSetLayerCompositionType(unpacker); break;
             case REQUEST_CMD_SET_LAYER_BLEND_TYPE: OnSetLayerBlendType(unpacker); break;
             case REQUEST_CMD_SET_LAYER_MASK_INFO: OnSetLayerMaskInfo(unpacker); break;
-            case CONTROL_CMD_REQUEST_END: ret = OnRequestEnd(unpacker); break;
             case REQUEST_CMD_SET_LAYER_COLOR: OnSetLayerColor(unpacker); break;
             default:
                 HDF_LOGE("%{public}s: not support this cmd, unpacked cmd = %{public}d", __func__, cmd);
@@ -186,16 +187,20 @@ public:
             HDF_LOGI("error: unpacker PackBegin cmd not match, cmd(%{public}d)=%{public}s.", unpackCmd,
             CmdUtils::CommandToString(unpackCmd)));
 
+        HdifdIndex inFdIndex(inFds);
         while (ret == HDF_SUCCESS && unpacker.NextSection()) {
             if (!unpacker.BeginSection(unpackCmd)) {
                 HDF_LOGE("error: PackSection failed, unpackCmd=%{public}s.", CmdUtils::CommandToString(unpackCmd));
                 ret = HDF_FAILURE;
                 break;
             }
-            ret = ProcessRequestCmd(unpacker, unpackCmd, inFds, outFds);
+            ret = ProcessRequestCmd(unpacker, unpackCmd, inFdIndex, outFds);
         }
 
         DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret, HDF_LOGE("%{public}s:ProcessRequestCmd failed", __func__));
+        /* the request end command is not a section, pack the errors of the request here */
+        ret = OnRequestEnd(unpacker);
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret, HDF_LOGE("%{public}s: OnRequestEnd failed", __func__));
         /* pack request end commands */
         replyPacker_.PackEnd(CONTROL_CMD_REPLY_END);
 
@@ -261,7 +266,7 @@ protected:
         DISPLAY_TRACE;
 
         size_t errCnt = errMaps_.size();
-        if (errCnt >= 0) {
+        if (errCnt > 0 && replyErrorsEnabled_) {
             int32_t ret = CmdUtils::StartSection(REPLY_CMD_SET_ERROR, replyPacker_);
             DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
                 HDF_LOGE("%{public}s: StartSection failed", __func__));
@@ -279,8 +284,8 @@ protected:
                 DISPLAY_CHK_RETURN(result == false, HDF_FAILURE,
                     HDF_LOGE("%{public}s: write errNo failed, errNo:%{public}d", __func__, it->second));
             }
-            result = CmdUtils::EndSection(replyPacker_);
-            DISPLAY_CHK_RETURN(result == false, HDF_FAILURE,
+            ret = CmdUtils::EndSection(replyPacker_);
+            DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
                 HDF_LOGE("%{public}s: write replyPacker_ EndSection failed", __func__));
             replyCommandCnt_++;
         }
@@ -352,7 +357,7 @@ EXIT:
     } ClientBufferData;
 
     int32_t UnpackDisplayClientBufferInfo(CommandDataUnpacker& unpacker,
-        const std::vector<HdifdInfo>& inFds, ClientBufferData& data)
+        const HdifdIndex& inFds, ClientBufferData& data)
     {
         if (!unpacker.ReadUint32(data.devId)) {
             return HDF_FAILURE;
@@ -420,7 +425,7 @@ EXIT:
         return ret;
     }
 
-    void OnSetDisplayClientBuffer(CommandDataUnpacker& unpacker, const std::vector<HdifdInfo>& inFds)
+    void OnSetDisplayClientBuffer(CommandDataUnpacker& unpacker, const HdifdIndex& inFds)
     {
         DISPLAY_TRACE;
 
@@ -826,7 +831,7 @@ EXIT:
         BufferHandle *buffer;
     } LayerBufferData;
 
-    int32_t UnPackLayerBufferInfo(CommandDataUnpacker& unpacker, const std::vector<HdifdInfo>& inFds,
+    int32_t UnPackLayerBufferInfo(CommandDataUnpacker& unpacker, const HdifdIndex& inFds,
         struct LayerBufferData *data, std::vector<uint32_t> &deletingList)
     {
         DISPLAY_CHK_RETURN(HDF_SUCCESS != CmdUtils::SetupDeviceUnpack(unpacker, data->devId, data->layerId),
@@ -904,7 +909,7 @@ EXIT:
         return ret;
     }
 
-    void OnSetLayerBuffer(CommandDataUnpacker& unpacker, const std::vector<HdifdInfo>& inFds)
+    void OnSetLayerBuffer(CommandDataUnpacker& unpacker, const HdifdIndex& inFds)
     {
         DISPLAY_TRACE;
 
@@ -1177,6 +1182,9 @@ protected:
     uint32_t replyCommandCnt_;
     CommandDataPacker replyPacker_;
     std::unordered_map<int32_t, int32_t> errMaps_;
+    // Released requesters fail the whole request on a REPLY_CMD_SET_ERROR section, errMaps_ is only sent to
+    // requesters that announced they log the errors instead
+    bool replyErrorsEnabled_ = false;
     /* fix fd leak */
     std::queue<BufferHandle *> delayFreeQueue_;
     std::mutex requestMutex_;
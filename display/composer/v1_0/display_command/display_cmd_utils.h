@@ -16,6 +16,9 @@
 #ifndef OHOS_HDI_DISPLAY_V1_0_DISPLAY_CMD_UTILS_H
 #define OHOS_HDI_DISPLAY_V1_0_DISPLAY_CMD_UTILS_H
 
+#include <algorithm>
+#include <utility>
+#include <vector>
 #include "buffer_handle_utils.h"
 #include "command_pack/command_data_packer.h"
 #include "command_pack/command_data_unpacker.h"
@@ -36,6 +39,66 @@ namespace Composer {
 namespace V1_0 {
 using namespace OHOS::HDI::Display::Composer::V1_0;
 
+// Indexes the fds of one request by sequence id, so each unpacked fd is found without scanning them all.
+// The index refers to hdiFds instead of copying it: it must not outlive the vector, and the vector must not
+// be modified while the index is in use.
+class HdifdIndex {
+public:
+    explicit HdifdIndex(const std::vector<HdifdInfo>& hdiFds) : hdiFds_(hdiFds), baseId_(0), dense_(true)
+    {
+        if (!hdiFds_.empty()) {
+            baseId_ = hdiFds_.front().id;
+        }
+        // Ids are generated in increasing order, so one packer usually produces a gapless range
+        for (size_t i = 0; i < hdiFds_.size(); ++i) {
+            if (static_cast<int64_t>(hdiFds_[i].id) != static_cast<int64_t>(baseId_) + static_cast<int64_t>(i)) {
+                dense_ = false;
+                break;
+            }
+        }
+        if (dense_) {
+            return;
+        }
+        sortedIds_.reserve(hdiFds_.size());
+        for (size_t i = 0; i < hdiFds_.size(); ++i) {
+            sortedIds_.emplace_back(hdiFds_[i].id, i);
+        }
+        // Stable, so a duplicated id still resolves to its first entry
+        std::stable_sort(sortedIds_.begin(), sortedIds_.end(),
+            [](const std::pair<int32_t, size_t>& lhs, const std::pair<int32_t, size_t>& rhs) {
+                return lhs.first < rhs.first;
+            });
+    }
+
+    const HdifdInfo *Find(int32_t id) const
+    {
+        if (dense_) {
+            int64_t offset = static_cast<int64_t>(id) - static_cast<int64_t>(baseId_);
+            if (offset < 0 || offset >= static_cast<int64_t>(hdiFds_.size())) {
+                return nullptr;
+            }
+            return &hdiFds_[static_cast<size_t>(offset)];
+        }
+        auto iter = std::lower_bound(sortedIds_.begin(), sortedIds_.end(), id,
+            [](const std::pair<int32_t, size_t>& entry, int32_t value) { return entry.first < value; });
+        if (iter == sortedIds_.end() || iter->first != id) {
+            return nullptr;
+        }
+        return &hdiFds_[iter->second];
+    }
+
+    size_t Size() const
+    {
+        return hdiFds_.size();
+    }
+
+private:
+    const std::vector<HdifdInfo>& hdiFds_;
+    int32_t baseId_;
+    bool dense_;
+    std::vector<std::pair<int32_t, size_t>> sortedIds_;
+};
+
 class DisplayCmdUtils {
 public:
     static constexpr int32_t MAX_INT = 0x7fffffff;
@@ -124,19 +187,24 @@ public:
         }
     }
 
-    static bool MatchHdiFd(int32_t id, std::vector<HdifdInfo> hdiFds, int32_t& fd)
+    static bool MatchHdiFd(int32_t id, const HdifdIndex& hdiFds, int32_t& fd)
     {
-        for (uint32_t i = 0; i < hdiFds.size(); ++i) {
-            if (hdiFds[i].hdiFd == nullptr) {
-                HDF_LOGE("%{public}s, hdiFd is nullptr", __func__);
-                continue;
-            }
-            if (hdiFds[i].id == id) {
-                fd = hdiFds[i].hdiFd->Move();
-                return true;
-            }
+        const HdifdInfo *info = hdiFds.Find(id);
+        if (info == nullptr) {
+            return false;
         }
-        return false;
+        if (info->hdiFd == nullptr) {
+            HDF_LOGE("%{public}s, hdiFd is nullptr", __func__);
+            return false;
+        }
+        fd = info->hdiFd->Move();
+        return true;
+    }
+
+    // The std::vector<HdifdInfo> overloads index hdiFds on every call, build one HdifdIndex per request instead.
+    static bool MatchHdiFd(int32_t id, const std::vector<HdifdInfo>& hdiFds, int32_t& fd)
+    {
+        return MatchHdiFd(id, HdifdIndex(hdiFds), fd);
     }
 
     static int32_t RectPack(const IRect& rect, CommandDataPacker& packer)
@@ -267,7 +335,7 @@ public:
     }
 
     static int32_t FileDescriptorUnpack(
-        CommandDataUnpacker& unpacker, const std::vector<HdifdInfo>& hdiFds, int32_t& fd)
+        CommandDataUnpacker& unpacker, const HdifdIndex& hdiFds, int32_t& fd)
     {
         int32_t fdId = -1;
         DISPLAY_CHK_RETURN(unpacker.ReadInt32(fdId) == false, HDF_FAILURE,
@@ -279,14 +347,20 @@ public:
         if (!(MatchHdiFd(fdId, hdiFds, fd))) {
             // If matching failure, the illegal fd is transfered by smq directly, not by binder IPC.
             HDF_LOGE("%{public}s, matching failure, fd %{public}d, fdId %{public}d, hdiFds.size %{public}zu",
-                     __func__, fd, fdId, hdiFds.size());
+                     __func__, fd, fdId, hdiFds.Size());
             fd = INVALID_FD;
             return HDF_FAILURE;
         }
         return HDF_SUCCESS;
     }
 
-    static bool UnpackBasicInfo(CommandDataUnpacker& unpacker, const std::vector<HdifdInfo>& hdiFds,
+    static int32_t FileDescriptorUnpack(
+        CommandDataUnpacker& unpacker, const std::vector<HdifdInfo>& hdiFds, int32_t& fd)
+    {
+        return FileDescriptorUnpack(unpacker, HdifdIndex(hdiFds), fd);
+    }
+
+    static bool UnpackBasicInfo(CommandDataUnpacker& unpacker, const HdifdIndex& hdiFds,
         BufferHandle *handle)
     {
         int32_t ret = FileDescriptorUnpack(unpacker, hdiFds, handle->fd);
@@ -308,7 +382,13 @@ public:
         return retVal;
     }
 
-    static bool UnpackExtraInfo(CommandDataUnpacker& unpacker, const std::vector<HdifdInfo>& hdiFds,
+    static bool UnpackBasicInfo(CommandDataUnpacker& unpacker, const std::vector<HdifdInfo>& hdiFds,
+        BufferHandle *handle)
+    {
+        return UnpackBasicInfo(unpacker, HdifdIndex(hdiFds), handle);
+    }
+
+    static bool UnpackExtraInfo(CommandDataUnpacker& unpacker, const HdifdIndex& hdiFds,
         BufferHandle *handle)
     {
         bool retVal = true;
@@ -331,8 +411,14 @@ public:
         return retVal;
     }
 
+    static bool UnpackExtraInfo(CommandDataUnpacker& unpacker, const std::vector<HdifdInfo>& hdiFds,
+        BufferHandle *handle)
+    {
+        return UnpackExtraInfo(unpacker, HdifdIndex(hdiFds), handle);
+    }
+
     static int32_t BufferHandleUnpack(CommandDataUnpacker& unpacker,
-        const std::vector<HdifdInfo>& hdiFds, BufferHandle*& buffer)
+        const HdifdIndex& hdiFds, BufferHandle*& buffer)
     {
         uint32_t fdsNum = 0;
         uint32_t intsNum = 0;
@@ -363,6 +449,12 @@ public:
         return retVal ? HDF_SUCCESS : HDF_FAILURE;
     }
 
+    static int32_t BufferHandleUnpack(CommandDataUnpacker& unpacker,
+        const std::vector<HdifdInfo>& hdiFds, BufferHandle*& buffer)
+    {
+        return BufferHandleUnpack(unpacker, HdifdIndex(hdiFds), buffer);
+    }
+
     static int32_t LayerColorUnpack(CommandDataUnpacker& unpacker, LayerColor& layerColor)
     {
         DISPLAY_CHK_RETURN(unpacker.ReadUint8(layerColor.r) == false, HDF_FAILURE,
@@ -16,6 +16,9 @@
 #ifndef OHOS_HDI_DISPLAY_V1_2_DISPLAY_CMD_REQUESTER_H
 #define OHOS_HDI_DISPLAY_V1_2_DISPLAY_CMD_REQUESTER_H
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
 #include "v1_1/display_command/display_cmd_requester.h"
 #include "v1_2/display_command/display_cmd_utils.h"
 #include "v1_2/display_composer_type.h"
@@ -31,8 +34,27 @@ using namespace OHOS::HDI::Base;
 template <typename Transfer, typename CompHdi>
 class DisplayCmdRequester : public V1_1::DisplayCmdRequester<Transfer, CompHdi> {
 public:
+    // CommitAndGetReleaseFence
+    struct FenceData {
+        int32_t fence_ = -1;
+        int32_t skipValidateState_ = -1;
+        bool needFlush_ = false;
+        std::vector<uint32_t> layers;
+        std::vector<int32_t> fences;
+    };
+
+    // Completion of CommitAndGetReleaseFenceAsync, runs on the requester worker thread and owns the fences.
+    using CommitCallback = std::function<void(int32_t ret, FenceData& fenceData)>;
+
     DisplayCmdRequester(sptr<CompHdi> hdi) : BaseType1_1(hdi) {}
 
+    ~DisplayCmdRequester()
+    {
+        // The asynchronous request in flight uses the layer state cache, which is destroyed before the base
+        // class joins the worker
+        WaitAsyncRequest();
+    }
+
     static std::unique_ptr<DisplayCmdRequester> Create(sptr<CompHdi> hdi)
     {
         DISPLAY_CHK_RETURN(hdi == nullptr, nullptr, HDF_LOGE("%{public}s: hdi is nullptr", __func__));
@@ -47,31 +69,23 @@ public:
         return requester;
     }
 
+    int32_t Init(uint32_t eleCnt)
+    {
+        int32_t ret = BaseType1_1::Init(eleCnt);
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret, HDF_LOGE("%{public}s: Init failed", __func__));
+        ProbeHostCommands([this](uint32_t& replyEleCnt, std::vector<HdifdInfo>& outFds) {
+            return DoRequest(requestPacker_, requestHdiFds_, replyEleCnt, outFds);
+        });
+        return HDF_SUCCESS;
+    }
+
     int32_t CommitAndGetReleaseFence(uint32_t devId, int32_t& fence, bool isSupportSkipValidate, int32_t& skipState,
         bool& needFlush, std::vector<uint32_t>& layers, std::vector<int32_t>& fences, bool isValidated)
     {
         uint32_t replyEleCnt = 0;
         std::vector<HdifdInfo> outFds;
-        size_t writePos = requestPacker_.ValidSize();
-
-        int32_t ret = CmdUtils::StartSection(REQUEST_CMD_COMMIT_AND_GET_RELEASE_FENCE, requestPacker_);
-        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
-
-        ret = requestPacker_.WriteUint32(devId) ? HDF_SUCCESS : HDF_FAILURE;
-        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
-
-        ret = requestPacker_.WriteBool(isSupportSkipValidate) ? HDF_SUCCESS : HDF_FAILURE;
-        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
-
-        ret = requestPacker_.WriteBool(isValidated) ? HDF_SUCCESS : HDF_FAILURE;
-        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
 
-        ret = CmdUtils::EndSection(requestPacker_);
-        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
-
-        ReqStatistic(devId, REQUEST_CMD_COMMIT_AND_GET_RELEASE_FENCE, writePos);
-
-        ret = CmdUtils::EndPack(requestPacker_);
+        int32_t ret = PackCommitAndGetReleaseFence(devId, isSupportSkipValidate, isValidated);
         DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
 
         ret = DoRequest(replyEleCnt, outFds);
@@ -99,9 +113,53 @@ public:
         }
 
 EXIT:
+        FinishLayerStateFrame(ret != HDF_SUCCESS || HasLayerStateError(replyErrMaps_));
         return PeriodDataReset() == HDF_SUCCESS ? ret : HDF_FAILURE;
     }
 
+    /*
+     * Queues the commit and returns without waiting for the reply, so the next frame can be packed meanwhile.
+     * The transfer, DoReplyResults and callback run on the requester worker thread. Until they finish, the
+     * worker writes compChangeLayers_ and compChangeTypes_ while the caller packs the next frame, so read
+     * them only through GetDisplayCompChange, which waits for the request in flight. Other calls that transfer
+     * wait as well, so callback must not call back into the requester.
+     */
+    int32_t CommitAndGetReleaseFenceAsync(uint32_t devId, bool isSupportSkipValidate, bool isValidated,
+        CommitCallback callback)
+    {
+        DISPLAY_CHK_RETURN(callback == nullptr, HDF_FAILURE, HDF_LOGE("%{public}s: callback is nullptr", __func__));
+        int32_t ret = PackCommitAndGetReleaseFence(devId, isSupportSkipValidate, isValidated);
+        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
+
+        ret = SubmitAsyncRequest([this, callback](CommandDataPacker& packer, const std::vector<HdifdInfo>& hdiFds) {
+            uint32_t replyEleCnt = 0;
+            std::vector<HdifdInfo> outFds;
+            FenceData fenceData;
+            int32_t requestRet = DoRequest(packer, hdiFds, replyEleCnt, outFds);
+            int32_t transferRet = requestRet;
+            if (requestRet == HDF_SUCCESS) {
+                transferRet = DoReplyResults(replyEleCnt, outFds, [&fenceData](void *data) -> int32_t {
+                    DISPLAY_CHK_RETURN(data == nullptr, HDF_FAILURE, HDF_LOGE("fence data is nullptr"));
+                    fenceData = std::move(*reinterpret_cast<FenceData *>(data));
+                    return HDF_SUCCESS;
+                });
+            }
+            // replyErrMaps_ belongs to this reply only until the caller transfers again, read it before callback
+            FinishLayerStateFrame(transferRet != HDF_SUCCESS || HasLayerStateError(replyErrMaps_));
+            callback(transferRet, fenceData);
+            return requestRet;
+        });
+        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
+        return HDF_SUCCESS;
+
+EXIT:
+        // Frames finish in the order they were packed, the one in flight goes first
+        WaitAsyncRequest();
+        FinishLayerStateFrame(true);
+        PeriodDataReset();
+        return HDF_FAILURE;
+    }
+
     int32_t OnReplySkipStateFailed(CommandDataUnpacker& replyUnpacker, bool &needFlush)
     {
         uint32_t devId = 0;
@@ -145,7 +203,7 @@ EXIT:
     }
 
     int32_t OnReplyCommitAndGetReleaseFence(CommandDataUnpacker& replyUnpacker,
-        std::vector<HdifdInfo>& replyFds, int32_t& fenceFd, int32_t& skipState,
+        const V1_0::HdifdIndex& replyFds, int32_t& fenceFd, int32_t& skipState,
         bool& needFlush, std::vector<uint32_t>& layers, std::vector<int32_t>& fences)
     {
         int32_t ret = CmdUtils::FileDescriptorUnpack(replyUnpacker, replyFds, fenceFd);
@@ -194,7 +252,7 @@ EXIT:
     }
 
     int32_t ProcessUnpackCmd(CommandDataUnpacker& replyUnpacker, int32_t unpackCmd,
-        std::vector<HdifdInfo>& replyFds, std::function<int32_t(void *)> fn)
+        const V1_0::HdifdIndex& replyFds, std::function<int32_t(void *)> fn)
     {
         int32_t ret = HDF_SUCCESS;
         while (replyUnpacker.NextSection()) {
@@ -217,6 +275,18 @@ EXIT:
                         HDF_LOGE("%{public}s: return fence fd error, unpackCmd=%{public}s",
                         __func__, CmdUtils::CommandToString(unpackCmd)));
                     break;
+                case REPLY_CMD_SET_ERROR:
+                    ret = OnReplySetError(replyUnpacker, errMaps);
+                    DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
+                        HDF_LOGE("%{public}s: OnReplySetError failed", __func__));
+                    // Failed set calls do not fail the commit, but a rejected layer property is not held by
+                    // the server, so the callers invalidate the layer state cache on HasLayerStateError
+                    for (const auto& err : errMaps) {
+                        HDF_LOGE("%{public}s: server return err, cmd=%{public}s, ret=%{public}d", __func__,
+                            CmdUtils::CommandToString(err.first), err.second);
+                    }
+                    replyErrMaps_.insert(errMaps.begin(), errMaps.end());
+                    break;
                 default:
                     ret = V1_0::DisplayCmdRequester<Transfer, CompHdi>::ProcessUnpackCmd(replyUnpacker,
                         unpackCmd, replyFds, fn);
@@ -245,7 +315,9 @@ EXIT:
             reply_->Reset();
             return HDF_FAILURE;
         }
-        if (ProcessUnpackCmd(replyUnpacker, unpackCmd, replyFds, fn) != HDF_SUCCESS) {
+        replyErrMaps_.clear();
+        V1_0::HdifdIndex replyFdIndex(replyFds);
+        if (ProcessUnpackCmd(replyUnpacker, unpackCmd, replyFdIndex, fn) != HDF_SUCCESS) {
             HDF_LOGE("%{public}s: ProcessUnpackCmd failed, unpackCmd=%{public}d", __func__, unpackCmd);
             request_->Reset();
             reply_->Reset();
@@ -312,9 +384,11 @@ EXIT:
         int32_t ret = 0;
         bool retBool = false;
         size_t writePos = requestPacker_.ValidSize();
+        int32_t cmd = hostCmdsSupported_ ? REQUEST_CMD_SET_LAYER_PERFRAME_PARAM_RAW :
+            REQUEST_CMD_SET_LAYER_PERFRAME_PARAM;
 
         do {
-            ret = CmdUtils::StartSection(REQUEST_CMD_SET_LAYER_PERFRAME_PARAM, requestPacker_);
+            ret = CmdUtils::StartSection(cmd, requestPacker_);
             DISPLAY_CHK_BREAK(ret != HDF_SUCCESS,
                 HDF_LOGE("%{public}s: StartSection failed", __func__));
 
@@ -326,29 +400,9 @@ EXIT:
             DISPLAY_CHK_BREAK(retBool == false,
                 HDF_LOGE("%{public}s: write layerId failed", __func__));
 
-            uint32_t vectStrSize = key.size();
-            retBool = requestPacker_.WriteUint32(vectStrSize);
-            if (vectStrSize > CmdUtils::MAX_MEMORY) {
-                DISPLAY_CHK_BREAK(retBool == false,
-                    HDF_LOGE("%{public}s: write vectStr failed", __func__));
-            }
-            for (uint32_t i = 0; i < vectStrSize; i++) {
-                retBool = requestPacker_.WriteInt32(static_cast<int32_t>(key[i]));
-                DISPLAY_CHK_BREAK(retBool == false,
-                    HDF_LOGE("%{public}s: write vectStr failed", __func__));
-            }
-
-            uint32_t vectSize = value.size();
-            retBool = requestPacker_.WriteUint32(vectSize);
-            if (vectSize > CmdUtils::MAX_MEMORY) {
-                DISPLAY_CHK_BREAK(retBool == false,
-                    HDF_LOGE("%{public}s: write vect failed", __func__));
-            }
-            for (uint32_t i = 0; i < vectSize; i++) {
-                retBool = requestPacker_.WriteUint8(static_cast<uint8_t>(value[i]));
-                DISPLAY_CHK_BREAK(retBool == false,
-                    HDF_LOGE("%{public}s: write vect failed", __func__));
-            }
+            retBool = WritePerFrameParameter(key, value);
+            DISPLAY_CHK_BREAK(retBool == false,
+                HDF_LOGE("%{public}s: write key and value failed", __func__));
 
             ret = CmdUtils::EndSection(requestPacker_);
             DISPLAY_CHK_BREAK(ret != HDF_SUCCESS,
@@ -362,7 +416,7 @@ EXIT:
             return HDF_FAILURE;
         }
 
-        ReqStatistic(devId, REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM, writePos);
+        ReqStatistic(devId, cmd, writePos);
         return HDF_SUCCESS;
     }
 
@@ -372,9 +426,11 @@ EXIT:
         int32_t ret = 0;
         bool retBool = false;
         size_t writePos = requestPacker_.ValidSize();
+        int32_t cmd = hostCmdsSupported_ ? REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM_RAW :
+            REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM;
 
         do {
-            ret = CmdUtils::StartSection(REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM, requestPacker_);
+            ret = CmdUtils::StartSection(cmd, requestPacker_);
             DISPLAY_CHK_BREAK(ret != HDF_SUCCESS,
                 HDF_LOGE("%{public}s: StartSection failed", __func__));
 
@@ -382,29 +438,9 @@ EXIT:
             DISPLAY_CHK_BREAK(retBool == false,
                 HDF_LOGE("%{public}s: write devId failed", __func__));
 
-            uint32_t vectStrSize = key.size();
-            retBool = requestPacker_.WriteUint32(vectStrSize);
-            if (vectStrSize > CmdUtils::MAX_MEMORY) {
-                DISPLAY_CHK_BREAK(retBool == false,
-                    HDF_LOGE("%{public}s: write vectStr failed", __func__));
-            }
-            for (uint32_t i = 0; i < vectStrSize; i++) {
-                retBool = requestPacker_.WriteInt32(static_cast<int32_t>(key[i]));
-                DISPLAY_CHK_BREAK(retBool == false,
-                    HDF_LOGE("%{public}s: write vectStr failed", __func__));
-            }
-
-            uint32_t vectSize = value.size();
-            retBool = requestPacker_.WriteUint32(vectSize);
-            if (vectSize > CmdUtils::MAX_MEMORY) {
-                DISPLAY_CHK_BREAK(retBool == false,
-                    HDF_LOGE("%{public}s: write vect failed", __func__));
-            }
-            for (uint32_t i = 0; i < vectSize; i++) {
-                retBool = requestPacker_.WriteUint8(static_cast<uint8_t>(value[i]));
-                DISPLAY_CHK_BREAK(retBool == false,
-                    HDF_LOGE("%{public}s: write vect failed", __func__));
-            }
+            retBool = WritePerFrameParameter(key, value);
+            DISPLAY_CHK_BREAK(retBool == false,
+                HDF_LOGE("%{public}s: write key and value failed", __func__));
 
             ret = CmdUtils::EndSection(requestPacker_);
             DISPLAY_CHK_BREAK(ret != HDF_SUCCESS,
@@ -418,32 +454,496 @@ EXIT:
             return HDF_FAILURE;
         }
 
-        ReqStatistic(devId, REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM, writePos);
+        ReqStatistic(devId, cmd, writePos);
         return HDF_SUCCESS;
     }
 
+    // The fixed size layer properties below are collected per layer and sent as REQUEST_CMD_SET_LAYERS_STATE
+    // right before the request is transferred, instead of one section per call.
+    int32_t SetLayerAlpha(uint32_t devId, uint32_t layerId, const V1_0::LayerAlpha &alpha)
+    {
+        return SetLayerStateField(devId, layerId, CmdUtils::LAYER_STATE_ALPHA, &LayerState::alpha, alpha);
+    }
+
+    int32_t SetLayerRegion(uint32_t devId, uint32_t layerId, const V1_0::IRect &rect)
+    {
+        return SetLayerStateField(devId, layerId, CmdUtils::LAYER_STATE_REGION, &LayerState::region, rect);
+    }
+
+    int32_t SetLayerCrop(uint32_t devId, uint32_t layerId, const V1_0::IRect &rect)
+    {
+        return SetLayerStateField(devId, layerId, CmdUtils::LAYER_STATE_CROP, &LayerState::crop, rect);
+    }
+
+    int32_t SetLayerZorder(uint32_t devId, uint32_t layerId, uint32_t zorder)
+    {
+        return SetLayerStateField(devId, layerId, CmdUtils::LAYER_STATE_ZORDER, &LayerState::zorder, zorder);
+    }
+
+    int32_t SetLayerPreMulti(uint32_t devId, uint32_t layerId, bool preMul)
+    {
+        return SetLayerStateField(devId, layerId, CmdUtils::LAYER_STATE_PREMULTI, &LayerState::preMulti, preMul);
+    }
+
+    int32_t SetLayerTransformMode(uint32_t devId, uint32_t layerId, V1_0::TransformType type)
+    {
+        return SetLayerStateField(devId, layerId, CmdUtils::LAYER_STATE_TRANSFORM_MODE, &LayerState::transformType,
+            static_cast<int32_t>(type));
+    }
+
+    int32_t SetLayerCompositionType(uint32_t devId, uint32_t layerId, V1_0::CompositionType type)
+    {
+        return SetLayerStateField(devId, layerId, CmdUtils::LAYER_STATE_COMPOSITION_TYPE,
+            &LayerState::compositionType, static_cast<int32_t>(type));
+    }
+
+    int32_t SetLayerBlendType(uint32_t devId, uint32_t layerId, V1_0::BlendType type)
+    {
+        return SetLayerStateField(devId, layerId, CmdUtils::LAYER_STATE_BLEND_TYPE, &LayerState::blendType,
+            static_cast<int32_t>(type));
+    }
+
+    int32_t SetLayerMaskInfo(uint32_t devId, uint32_t layerId, const V1_0::MaskInfo maskInfo)
+    {
+        return SetLayerStateField(devId, layerId, CmdUtils::LAYER_STATE_MASK_INFO, &LayerState::maskInfo,
+            static_cast<uint32_t>(maskInfo));
+    }
+
+    int32_t SetLayerColor(uint32_t devId, uint32_t layerId, const V1_0::LayerColor& layerColor)
+    {
+        return SetLayerStateField(devId, layerId, CmdUtils::LAYER_STATE_COLOR, &LayerState::color, layerColor);
+    }
+
+    /*
+     * Layer state cache: remembers the layer properties already sent to the server and drops set calls that
+     * would resend the same value. It is off by default, switch it from the thread using the requester.
+     */
+    static constexpr uint32_t ALL_DEVICES = UINT32_MAX;
+    static constexpr uint32_t ALL_LAYERS = UINT32_MAX;
+
+    void EnableLayerStateCache(bool enable)
+    {
+        if (!enable) {
+            InvalidateLayerStateCache();
+            ApplyLayerStateUpdates();
+            // Frames packed while disabled are not recorded, so the ones in flight now may be overwritten
+            for (auto& frame : inflightLayerStates_) {
+                frame.clear();
+            }
+        }
+        layerStateCacheEnabled_.store(enable, std::memory_order_relaxed);
+    }
+
+    // Forgets what the server holds for one layer, every layer of devId or every layer of every device.
+    // May be called from any thread, the requester applies it before its next layer state access.
+    void InvalidateLayerStateCache(uint32_t devId = ALL_DEVICES, uint32_t layerId = ALL_LAYERS)
+    {
+        if (!layerStateCacheEnabled_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(staleLayersMutex_);
+        staleLayers_.emplace_back(devId, layerId);
+        layerStateStale_.store(true, std::memory_order_release);
+    }
+
+    struct LayerStateCacheStats {
+        uint64_t setCalls = 0;
+        uint64_t suppressed = 0;
+        uint64_t fieldSuppressed[CmdUtils::LAYER_STATE_FIELD_COUNT] = {};
+    };
+
+    // Layer state set calls seen while the cache was enabled, and how many of them were not sent, per field
+    // in dirty bit order. May be called from any thread.
+    LayerStateCacheStats GetLayerStateCacheStats() const
+    {
+        LayerStateCacheStats stats;
+        stats.setCalls = layerStateSetCalls_.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < CmdUtils::LAYER_STATE_FIELD_COUNT; i++) {
+            stats.fieldSuppressed[i] = layerStateSuppressedCalls_[i].load(std::memory_order_relaxed);
+            stats.suppressed += stats.fieldSuppressed[i];
+        }
+        return stats;
+    }
+
+    int32_t PrepareDisplayLayers(uint32_t devId, bool &needFlushFb)
+    {
+        if (PackLayersState() != HDF_SUCCESS) {
+            FinishLayerStateFrame(true);
+            PeriodDataReset();
+            return HDF_FAILURE;
+        }
+        int32_t ret = BaseType1_1::PrepareDisplayLayers(devId, needFlushFb);
+        FinishLayerStateFrame(ret != HDF_SUCCESS || HasLayerStateError(replyErrMaps_));
+        return ret;
+    }
+
+    int32_t Commit(uint32_t devId, int32_t &fence)
+    {
+        if (PackLayersState() != HDF_SUCCESS) {
+            FinishLayerStateFrame(true);
+            PeriodDataReset();
+            return HDF_FAILURE;
+        }
+        int32_t ret = BaseType1_1::Commit(devId, fence);
+        FinishLayerStateFrame(ret != HDF_SUCCESS || HasLayerStateError(replyErrMaps_));
+        return ret;
+    }
+
 protected:
+    int32_t PackCommitAndGetReleaseFence(uint32_t devId, bool isSupportSkipValidate, bool isValidated)
+    {
+        int32_t ret = PackLayersState();
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret, HDF_LOGE("%{public}s: PackLayersState failed", __func__));
+
+        size_t writePos = requestPacker_.ValidSize();
+
+        ret = CmdUtils::StartSection(REQUEST_CMD_COMMIT_AND_GET_RELEASE_FENCE, requestPacker_);
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret, HDF_LOGE("%{public}s: StartSection failed", __func__));
+
+        ret = requestPacker_.WriteUint32(devId) ? HDF_SUCCESS : HDF_FAILURE;
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret, HDF_LOGE("%{public}s: write devId failed", __func__));
+
+        ret = requestPacker_.WriteBool(isSupportSkipValidate) ? HDF_SUCCESS : HDF_FAILURE;
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
+            HDF_LOGE("%{public}s: write isSupportSkipValidate failed", __func__));
+
+        ret = requestPacker_.WriteBool(isValidated) ? HDF_SUCCESS : HDF_FAILURE;
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret, HDF_LOGE("%{public}s: write isValidated failed", __func__));
+
+        ret = CmdUtils::EndSection(requestPacker_);
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret, HDF_LOGE("%{public}s: EndSection failed", __func__));
+
+        ReqStatistic(devId, REQUEST_CMD_COMMIT_AND_GET_RELEASE_FENCE, writePos);
+
+        ret = CmdUtils::EndPack(requestPacker_);
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret, HDF_LOGE("%{public}s: EndPack failed", __func__));
+        return HDF_SUCCESS;
+    }
+
+    // Sends the collected layer states, one REQUEST_CMD_SET_LAYERS_STATE section per device, or one single layer
+    // command per dirty field for hosts without it. Each call starts a frame, which the caller has to end with
+    // FinishLayerStateFrame once the transfer is done, even when packing failed.
+    int32_t PackLayersState()
+    {
+        bool cacheEnabled = layerStateCacheEnabled_.load(std::memory_order_relaxed);
+        // Does not wait for the request in flight, its result is applied by whichever pack follows it
+        ApplyLayerStateUpdates();
+        int32_t ret = HDF_SUCCESS;
+        std::vector<uint32_t> devIds;
+        for (const auto& state : layerStates_) {
+            if (!hostCmdsSupported_) {
+                ret = PackLayerStateCommands(state);
+                DISPLAY_CHK_BREAK(ret != HDF_SUCCESS,
+                    HDF_LOGE("%{public}s: PackLayerStateCommands failed", __func__));
+            } else if (state.dirty != 0 && std::find(devIds.begin(), devIds.end(), state.devId) == devIds.end()) {
+                devIds.push_back(state.devId);
+            }
+        }
+        for (uint32_t devId : devIds) {
+            size_t writePos = requestPacker_.ValidSize();
+            ret = CmdUtils::StartSection(REQUEST_CMD_SET_LAYERS_STATE, requestPacker_);
+            DISPLAY_CHK_BREAK(ret != HDF_SUCCESS,
+                HDF_LOGE("%{public}s: StartSection failed", __func__));
+
+            ret = CmdUtils::LayersStatePack(devId, layerStates_, requestPacker_);
+            DISPLAY_CHK_BREAK(ret != HDF_SUCCESS,
+                HDF_LOGE("%{public}s: LayersStatePack failed", __func__));
+
+            ret = CmdUtils::EndSection(requestPacker_);
+            DISPLAY_CHK_BREAK(ret != HDF_SUCCESS,
+                HDF_LOGE("%{public}s: EndSection failed", __func__));
+
+            ReqStatistic(devId, REQUEST_CMD_SET_LAYERS_STATE, writePos);
+        }
+        // Held aside until the frame finishes, merged into committedLayerStates_ only if the server took it
+        std::unordered_map<uint64_t, LayerState> frame;
+        if (cacheEnabled && ret == HDF_SUCCESS) {
+            for (const auto& state : layerStates_) {
+                if (state.dirty != 0) {
+                    LayerState& pending = frame[LayerKey(state.devId, state.layerId)];
+                    pending.devId = state.devId;
+                    pending.layerId = state.layerId;
+                    CmdUtils::LayerStateMerge(state, pending);
+                }
+            }
+        } else if (cacheEnabled) {
+            committedLayerStates_.clear();
+        }
+        inflightLayerStates_.push_back(std::move(frame));
+        layerStates_.clear();
+        layerStateIndex_.clear();
+        layerStateSuppressed_.clear();
+        return ret;
+    }
+
+    int32_t PackLayerStateCommands(const LayerState& state)
+    {
+        uint32_t devId = state.devId;
+        uint32_t layerId = state.layerId;
+        int32_t ret = HDF_SUCCESS;
+        if ((state.dirty & CmdUtils::LAYER_STATE_ZORDER) != 0) {
+            ret = BaseType1_1::SetLayerZorder(devId, layerId, state.zorder);
+        }
+        if (ret == HDF_SUCCESS && (state.dirty & CmdUtils::LAYER_STATE_PREMULTI) != 0) {
+            ret = BaseType1_1::SetLayerPreMulti(devId, layerId, state.preMulti);
+        }
+        if (ret == HDF_SUCCESS && (state.dirty & CmdUtils::LAYER_STATE_TRANSFORM_MODE) != 0) {
+            ret = BaseType1_1::SetLayerTransformMode(devId, layerId,
+                static_cast<V1_0::TransformType>(state.transformType));
+        }
+        if (ret == HDF_SUCCESS && (state.dirty & CmdUtils::LAYER_STATE_COMPOSITION_TYPE) != 0) {
+            ret = BaseType1_1::SetLayerCompositionType(devId, layerId,
+                static_cast<V1_0::CompositionType>(state.compositionType));
+        }
+        if (ret == HDF_SUCCESS && (state.dirty & CmdUtils::LAYER_STATE_BLEND_TYPE) != 0) {
+            ret = BaseType1_1::SetLayerBlendType(devId, layerId, static_cast<V1_0::BlendType>(state.blendType));
+        }
+        if (ret == HDF_SUCCESS && (state.dirty & CmdUtils::LAYER_STATE_MASK_INFO) != 0) {
+            ret = BaseType1_1::SetLayerMaskInfo(devId, layerId, static_cast<V1_0::MaskInfo>(state.maskInfo));
+        }
+        if (ret == HDF_SUCCESS && (state.dirty & CmdUtils::LAYER_STATE_ALPHA) != 0) {
+            ret = BaseType1_1::SetLayerAlpha(devId, layerId, state.alpha);
+        }
+        if (ret == HDF_SUCCESS && (state.dirty & CmdUtils::LAYER_STATE_REGION) != 0) {
+            ret = BaseType1_1::SetLayerRegion(devId, layerId, state.region);
+        }
+        if (ret == HDF_SUCCESS && (state.dirty & CmdUtils::LAYER_STATE_CROP) != 0) {
+            ret = BaseType1_1::SetLayerCrop(devId, layerId, state.crop);
+        }
+        if (ret == HDF_SUCCESS && (state.dirty & CmdUtils::LAYER_STATE_COLOR) != 0) {
+            ret = BaseType1_1::SetLayerColor(devId, layerId, state.color);
+        }
+        return ret;
+    }
+
+    size_t PendingLayerIndex(uint32_t devId, uint32_t layerId)
+    {
+        uint64_t key = LayerKey(devId, layerId);
+        auto iter = layerStateIndex_.find(key);
+        if (iter != layerStateIndex_.end()) {
+            return iter->second;
+        }
+        layerStateIndex_.emplace(key, layerStates_.size());
+        layerStates_.emplace_back();
+        layerStates_.back().devId = devId;
+        layerStates_.back().layerId = layerId;
+        layerStateSuppressed_.push_back(0);
+        return layerStates_.size() - 1;
+    }
+
+    template <typename T>
+    int32_t SetLayerStateField(uint32_t devId, uint32_t layerId, uint32_t field, T LayerState::*member,
+        const T& value)
+    {
+        size_t index = PendingLayerIndex(devId, layerId);
+        LayerState& state = layerStates_[index];
+        state.*member = value;
+        bool committed = false;
+        if (layerStateCacheEnabled_.load(std::memory_order_relaxed)) {
+            ApplyLayerStateUpdates();
+            layerStateSetCalls_.fetch_add(1, std::memory_order_relaxed);
+            committed = IsLayerStateCommitted(state, field);
+        }
+        if (committed) {
+            // Kept aside so an invalidation before the transfer can still send it
+            state.dirty &= ~field;
+            layerStateSuppressed_[index] |= field;
+            for (uint32_t i = 0; i < CmdUtils::LAYER_STATE_FIELD_COUNT; i++) {
+                if (field == (1U << i)) {
+                    layerStateSuppressedCalls_[i].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        } else {
+            state.dirty |= field;
+            layerStateSuppressed_[index] &= ~field;
+        }
+        return HDF_SUCCESS;
+    }
+
+    // A field still in flight is not known to be held, whatever its value
+    bool IsLayerStateCommitted(const LayerState& state, uint32_t field) const
+    {
+        uint64_t key = LayerKey(state.devId, state.layerId);
+        for (const auto& frame : inflightLayerStates_) {
+            auto pending = frame.find(key);
+            if (pending != frame.end() && (pending->second.dirty & field) != 0) {
+                return false;
+            }
+        }
+        auto iter = committedLayerStates_.find(key);
+        return iter != committedLayerStates_.end() && (iter->second.dirty & field) != 0 &&
+            CmdUtils::LayerStateFieldEqual(field, state, iter->second);
+    }
+
+    LayerState& CommittedLayerState(uint32_t devId, uint32_t layerId)
+    {
+        LayerState& state = committedLayerStates_[LayerKey(devId, layerId)];
+        state.devId = devId;
+        state.layerId = layerId;
+        return state;
+    }
+
+    // Ends the oldest frame started by PackLayersState. May be called from the worker thread, the requester
+    // applies it before its next layer state access.
+    void FinishLayerStateFrame(bool failed)
+    {
+        if (failed) {
+            InvalidateLayerStateCache();
+        }
+        std::lock_guard<std::mutex> lock(staleLayersMutex_);
+        finishedLayerStateFrames_.push_back(!failed);
+        layerStateStale_.store(true, std::memory_order_release);
+    }
+
+    void ApplyLayerStateUpdates()
+    {
+        if (!layerStateStale_.load(std::memory_order_acquire)) {
+            return;
+        }
+        std::vector<std::pair<uint32_t, uint32_t>> staleLayers;
+        std::vector<bool> finishedFrames;
+        {
+            std::lock_guard<std::mutex> lock(staleLayersMutex_);
+            staleLayers.swap(staleLayers_);
+            finishedFrames.swap(finishedLayerStateFrames_);
+            layerStateStale_.store(false, std::memory_order_relaxed);
+        }
+        for (bool held : finishedFrames) {
+            DISPLAY_CHK_BREAK(inflightLayerStates_.empty(), HDF_LOGE("%{public}s: no frame in flight", __func__));
+            if (held) {
+                for (const auto& pending : inflightLayerStates_.front()) {
+                    CmdUtils::LayerStateMerge(pending.second,
+                        CommittedLayerState(pending.second.devId, pending.second.layerId));
+                }
+            }
+            inflightLayerStates_.pop_front();
+        }
+        auto isStale = [&staleLayers](uint32_t devId, uint32_t layerId) {
+            return std::any_of(staleLayers.begin(), staleLayers.end(), [devId, layerId](const auto& stale) {
+                return (stale.first == ALL_DEVICES || stale.first == devId) &&
+                    (stale.second == ALL_LAYERS || stale.second == layerId);
+            });
+        };
+        for (auto iter = committedLayerStates_.begin(); iter != committedLayerStates_.end();) {
+            iter = isStale(iter->second.devId, iter->second.layerId) ? committedLayerStates_.erase(iter) : ++iter;
+        }
+        for (size_t i = 0; i < layerStates_.size(); i++) {
+            if (isStale(layerStates_[i].devId, layerStates_[i].layerId)) {
+                layerStates_[i].dirty |= layerStateSuppressed_[i];
+                layerStateSuppressed_[i] = 0;
+            }
+        }
+    }
+
+    /*
+     * Hosts that predate the raw per-frame parameter and batched layer state commands fail the whole request on
+     * them. An empty REQUEST_CMD_SET_LAYERS_STATE tells the two apart without touching the display, transfer
+     * sends it through the DoRequest of the most derived requester.
+     */
+    void ProbeHostCommands(const std::function<int32_t(uint32_t&, std::vector<HdifdInfo>&)>& transfer)
+    {
+        uint32_t replyEleCnt = 0;
+        std::vector<HdifdInfo> outFds;
+        int32_t ret = CmdUtils::StartSection(REQUEST_CMD_SET_LAYERS_STATE, requestPacker_);
+        if (ret == HDF_SUCCESS) {
+            ret = CmdUtils::LayersStatePack(0, std::vector<LayerState>(), requestPacker_);
+        }
+        if (ret == HDF_SUCCESS) {
+            ret = CmdUtils::EndSection(requestPacker_);
+        }
+        if (ret == HDF_SUCCESS) {
+            ret = CmdUtils::EndPack(requestPacker_);
+        }
+        if (ret == HDF_SUCCESS) {
+            ret = transfer(replyEleCnt, outFds);
+        }
+        hostCmdsSupported_ = (ret == HDF_SUCCESS);
+        HDF_LOGI("%{public}s: host %{public}s raw per-frame parameters and batched layer states", __func__,
+            hostCmdsSupported_ ? "supports" : "does not support");
+        PeriodDataReset();
+    }
+
+    static bool HasLayerStateError(const std::unordered_map<int32_t, int32_t>& errMaps)
+    {
+        return std::any_of(errMaps.begin(), errMaps.end(),
+            [](const auto& err) { return CmdUtils::IsLayerStateCommand(err.first); });
+    }
+
+    static uint64_t LayerKey(uint32_t devId, uint32_t layerId)
+    {
+        return (static_cast<uint64_t>(devId) << LAYER_KEY_DEV_SHIFT) | layerId;
+    }
+
+    // Key and value go out as two raw byte blocks, or one 4 byte word per character for hosts without them.
+    bool WritePerFrameParameter(const std::string& key, const std::vector<int8_t>& value)
+    {
+        DISPLAY_CHK_RETURN(key.size() > CmdUtils::MAX_MEMORY || value.size() > CmdUtils::MAX_MEMORY, false,
+            HDF_LOGE("%{public}s: key size %{public}zu or value size %{public}zu is too large",
+            __func__, key.size(), value.size()));
+        if (!hostCmdsSupported_) {
+            DISPLAY_CHK_RETURN(requestPacker_.WriteUint32(static_cast<uint32_t>(key.size())) == false, false,
+                HDF_LOGE("%{public}s: write key size failed", __func__));
+            for (char c : key) {
+                DISPLAY_CHK_RETURN(requestPacker_.WriteInt32(static_cast<int32_t>(c)) == false, false,
+                    HDF_LOGE("%{public}s: write key failed", __func__));
+            }
+            DISPLAY_CHK_RETURN(requestPacker_.WriteUint32(static_cast<uint32_t>(value.size())) == false, false,
+                HDF_LOGE("%{public}s: write value size failed", __func__));
+            for (int8_t byte : value) {
+                DISPLAY_CHK_RETURN(requestPacker_.WriteUint8(static_cast<uint8_t>(byte)) == false, false,
+                    HDF_LOGE("%{public}s: write value failed", __func__));
+            }
+            return true;
+        }
+        DISPLAY_CHK_RETURN(requestPacker_.WriteRawBytes(key.data(), static_cast<uint32_t>(key.size())) == false,
+            false, HDF_LOGE("%{public}s: write key failed", __func__));
+        DISPLAY_CHK_RETURN(requestPacker_.WriteRawBytes(value.data(), static_cast<uint32_t>(value.size())) == false,
+            false, HDF_LOGE("%{public}s: write value failed", __func__));
+        return true;
+    }
+
     using BaseType1_1 = V1_1::DisplayCmdRequester<Transfer, CompHdi>;
     using BaseType1_1::request_;
     using BaseType1_1::reply_;
     using BaseType1_1::requestPacker_;
+    using BaseType1_1::requestHdiFds_;
     using BaseType1_1::replyData_;
     using BaseType1_1::DoRequest;
     using BaseType1_1::PeriodDataReset;
     using BaseType1_1::ReqStatistic;
+    using BaseType1_1::SubmitAsyncRequest;
+    using BaseType1_1::WaitAsyncRequest;
+    using BaseType1_1::OnReplySetError;
 
     // Composition layers/types changed
     using BaseType1_1::compChangeLayers_;
     using BaseType1_1::compChangeTypes_;
-
-    // CommitAndGetReleaseFence
-    struct FenceData {
-        int32_t fence_ = -1;
-        int32_t skipValidateState_ = -1;
-        bool needFlush_ = false;
-        std::vector<uint32_t> layers;
-        std::vector<int32_t> fences;
-    };
+    using BaseType1_1::replyErrMaps_;
+
+private:
+    static constexpr uint32_t LAYER_KEY_DEV_SHIFT = 32;
+    // Set by ProbeHostCommands, false sends the commands older hosts know instead of the raw and batched ones,
+    // layer states then go out through PackLayerStateCommands
+    bool hostCmdsSupported_ = false;
+    // Layer states set since the last transfer, in the order the layers were first touched
+    std::vector<LayerState> layerStates_;
+    std::unordered_map<uint64_t, size_t> layerStateIndex_;
+    // Fields of layerStates_ left out because the server already holds the value
+    std::vector<uint32_t> layerStateSuppressed_;
+
+    std::atomic<bool> layerStateCacheEnabled_ = false;
+    // What the server is known to hold, dirty marks the known fields
+    std::unordered_map<uint64_t, LayerState> committedLayerStates_;
+    // States of the frames packed but not finished yet, oldest first, keyed like committedLayerStates_
+    std::deque<std::unordered_map<uint64_t, LayerState>> inflightLayerStates_;
+    // Guards the invalidations and frame results posted from other threads, layerStateStale_ flags either
+    std::mutex staleLayersMutex_;
+    std::vector<std::pair<uint32_t, uint32_t>> staleLayers_;
+    // Per finished frame in finishing order, true if the server took its layer states
+    std::vector<bool> finishedLayerStateFrames_;
+    std::atomic<bool> layerStateStale_ = false;
+    std::atomic<uint64_t> layerStateSetCalls_ = 0;
+    std::atomic<uint64_t> layerStateSuppressedCalls_[CmdUtils::LAYER_STATE_FIELD_COUNT] = {};
 };
 using HdiDisplayCmdRequester = V1_2::DisplayCmdRequester<SharedMemQueue<int32_t>, V1_2::IDisplayComposer>;
 } // namespace V1_2
@@ -58,7 +58,7 @@ public:
     virtual ~DisplayCmdResponser() {}
 
     int32_t ProcessRequestCmd(CommandDataUnpacker& unpacker, int32_t cmd,
-        const std::vector<HdifdInfo>& inFds, std::vector<HdifdInfo>& outFds)
+        const V1_0::HdifdIndex& inFds, std::vector<HdifdInfo>& outFds)
     {
         HDF_LOGD("%{public}s: HDI 1.2 PackSection, cmd-[%{public}d] = %{public}s",
             __func__, cmd, CmdUtils::CommandToString(cmd));
@@ -70,6 +70,12 @@ public:
             OnSetLayerPerFrameParam(unpacker);
         } else if (cmd == REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM) {
             OnSetDisplayPerFrameParam(unpacker);
+        } else if (cmd == REQUEST_CMD_SET_LAYER_PERFRAME_PARAM_RAW) {
+            OnSetLayerPerFrameParamRaw(unpacker);
+        } else if (cmd == REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM_RAW) {
+            OnSetDisplayPerFrameParamRaw(unpacker);
+        } else if (cmd == REQUEST_CMD_SET_LAYERS_STATE) {
+            OnSetLayersState(unpacker);
         } else {
             return V1_0::DisplayCmdResponser<Transfer, VdiImpl>::ProcessRequestCmd(unpacker, cmd, inFds, outFds);
         }
@@ -250,15 +256,19 @@ REPLY:
 
         DISPLAY_CHK_RETURN(PeriodDataReset() == HDF_FAILURE, HDF_FAILURE,
                            HDF_LOGE("%{public}s: error: PeriodDataReset failed", __func__));
+        V1_0::HdifdIndex inFdIndex(inFds);
         while (ret == HDF_SUCCESS && unpacker.NextSection()) {
             DISPLAY_CHK_RETURN(unpacker.BeginSection(unpackCmd) == false, HDF_FAILURE,
                 HDF_LOGE("error: PackSection failed, unpackCmd=%{public}s.",
                 CmdUtils::CommandToString(unpackCmd)));
-            ret = ProcessRequestCmd(unpacker, unpackCmd, inFds, outFds);
+            ret = ProcessRequestCmd(unpacker, unpackCmd, inFdIndex, outFds);
         }
 
         DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
                            HDF_LOGE("%{public}s: ProcessRequestCmd failed", __func__));
+        /* the request end command is not a section, pack the errors of the request here */
+        ret = OnRequestEnd(unpacker);
+        DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret, HDF_LOGE("%{public}s: OnRequestEnd failed", __func__));
         /* pack request end commands */
         replyPacker_.PackEnd(CONTROL_CMD_REPLY_END);
 
@@ -366,7 +376,7 @@ EXIT:
                 key.c_str(), devId, layerId, ret);
         }
 UNPACKER_EXIT:
-        if (ret != HDF_SUCCESS) {
+        if (ret != HDF_SUCCESS && ret != DISPLAY_NOT_SUPPORT && ret != HDF_ERR_NOT_SUPPORT) {
             errMaps_.emplace(REQUEST_CMD_SET_LAYER_PERFRAME_PARAM, ret);
         }
         return ret;
@@ -422,12 +432,97 @@ UNPACKER_EXIT:
                 key.c_str(), devId, ret);
         }
 UNPACKER_EXIT:
-        if (ret != HDF_SUCCESS) {
+        if (ret != HDF_SUCCESS && ret != DISPLAY_NOT_SUPPORT && ret != HDF_ERR_NOT_SUPPORT) {
             errMaps_.emplace(REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM, ret);
         }
         return ret;
     }
 
+    int32_t OnSetLayerPerFrameParamRaw(CommandDataUnpacker& unpacker)
+    {
+        DISPLAY_TRACE;
+        uint32_t devId = 0;
+        uint32_t layerId = 0;
+        std::string key;
+        std::vector<int8_t> value;
+
+        int32_t ret = unpacker.ReadUint32(devId) ? HDF_SUCCESS : HDF_FAILURE;
+        DISPLAY_CHECK(ret != HDF_SUCCESS, goto UNPACKER_EXIT);
+
+        ret = unpacker.ReadUint32(layerId) ? HDF_SUCCESS : HDF_FAILURE;
+        DISPLAY_CHECK(ret != HDF_SUCCESS, goto UNPACKER_EXIT);
+
+        ret = ReadPerFrameParameter(unpacker, key, value);
+        DISPLAY_CHECK(ret != HDF_SUCCESS, goto UNPACKER_EXIT);
+
+        HDF_LOGD("OnSetLayerPerFrameParamRaw %{public}s, %{public}d, %{public}d",
+            key.c_str(), devId, layerId);
+
+        if (impl_ != nullptr && impl_->SetLayerPerFrameParameter != nullptr) {
+            ret = impl_->SetLayerPerFrameParameter(devId, layerId, key, value);
+        }
+
+        if (ret != HDF_SUCCESS && ret != DISPLAY_NOT_SUPPORT && ret != HDF_ERR_NOT_SUPPORT) {
+            HDF_LOGE("OnSetLayerPerFrameParamRaw %{public}s, %{public}d, %{public}d, %{public}d",
+                key.c_str(), devId, layerId, ret);
+        }
+UNPACKER_EXIT:
+        if (ret != HDF_SUCCESS && ret != DISPLAY_NOT_SUPPORT && ret != HDF_ERR_NOT_SUPPORT) {
+            errMaps_.emplace(REQUEST_CMD_SET_LAYER_PERFRAME_PARAM_RAW, ret);
+        }
+        return ret;
+    }
+
+    int32_t OnSetDisplayPerFrameParamRaw(CommandDataUnpacker& unpacker)
+    {
+        DISPLAY_TRACE;
+        uint32_t devId = 0;
+        std::string key;
+        std::vector<int8_t> value;
+
+        int32_t ret = unpacker.ReadUint32(devId) ? HDF_SUCCESS : HDF_FAILURE;
+        DISPLAY_CHECK(ret != HDF_SUCCESS, goto UNPACKER_EXIT);
+
+        ret = ReadPerFrameParameter(unpacker, key, value);
+        DISPLAY_CHECK(ret != HDF_SUCCESS, goto UNPACKER_EXIT);
+
+        HDF_LOGD("OnSetDisplayPerFrameParamRaw %{public}s, %{public}d",
+            key.c_str(), devId);
+
+        if (impl_ != nullptr && impl_->SetDisplayPerFrameParameter != nullptr) {
+            ret = impl_->SetDisplayPerFrameParameter(devId, key, value);
+        }
+
+        if (ret != HDF_SUCCESS && ret != DISPLAY_NOT_SUPPORT && ret != HDF_ERR_NOT_SUPPORT) {
+            HDF_LOGE("OnSetDisplayPerFrameParamRaw %{public}s, %{public}d, %{public}d",
+                key.c_str(), devId, ret);
+        }
+UNPACKER_EXIT:
+        if (ret != HDF_SUCCESS && ret != DISPLAY_NOT_SUPPORT && ret != HDF_ERR_NOT_SUPPORT) {
+            errMaps_.emplace(REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM_RAW, ret);
+        }
+        return ret;
+    }
+
+    int32_t OnSetLayersState(CommandDataUnpacker& unpacker)
+    {
+        DISPLAY_TRACE;
+        // Only requesters that log failed set calls send it, starting with the probe at their init
+        replyErrorsEnabled_ = true;
+        int32_t ret = CmdUtils::LayersStateUnpack(unpacker, layersState_);
+        if (ret != HDF_SUCCESS) {
+            HDF_LOGE("%{public}s: LayersStateUnpack failed", __func__);
+            errMaps_.emplace(REQUEST_CMD_SET_LAYERS_STATE, ret);
+            return ret;
+        }
+
+        HdfTrace traceVdi("SetLayersState", "HDI:DISP:HARDWARE");
+        for (const auto& state : layersState_) {
+            ApplyLayerState(state);
+        }
+        return HDF_SUCCESS;
+    }
+
 private:
     using BaseType1_1 = V1_1::DisplayCmdResponser<Transfer, VdiImpl>;
     using BaseType1_1::replyPacker_;
@@ -435,6 +530,7 @@ private:
     using BaseType1_1::impl_;
     using BaseType1_1::replyCommandCnt_;
     using BaseType1_1::errMaps_;
+    using BaseType1_1::replyErrorsEnabled_;
     using BaseType1_1::request_;
     using BaseType1_1::reply_;
     using BaseType1_1::PeriodDataReset;
@@ -460,6 +556,73 @@ private:
     using BaseType1_1::CmdRequestDataWrite;
     using BaseType1_1::requestMutex_;
     using BaseType1_1::replyMutex_;
+
+    // Errors are reported under the single layer command of the field, as if it had been sent alone
+    void ApplyLayerState(const LayerState& state)
+    {
+        uint32_t devId = state.devId;
+        uint32_t layerId = state.layerId;
+        if ((state.dirty & CmdUtils::LAYER_STATE_ZORDER) != 0) {
+            CheckLayerStateResult(REQUEST_CMD_SET_LAYER_ZORDER, impl_->SetLayerZorder(devId, layerId, state.zorder));
+        }
+        if ((state.dirty & CmdUtils::LAYER_STATE_PREMULTI) != 0) {
+            CheckLayerStateResult(REQUEST_CMD_SET_LAYER_PREMULTI,
+                impl_->SetLayerPreMulti(devId, layerId, state.preMulti));
+        }
+        if ((state.dirty & CmdUtils::LAYER_STATE_TRANSFORM_MODE) != 0) {
+            CheckLayerStateResult(REQUEST_CMD_SET_LAYER_TRANSFORM_MODE,
+                impl_->SetLayerTransformMode(devId, layerId, static_cast<V1_0::TransformType>(state.transformType)));
+        }
+        if ((state.dirty & CmdUtils::LAYER_STATE_COMPOSITION_TYPE) != 0) {
+            CheckLayerStateResult(REQUEST_CMD_SET_LAYER_COMPOSITION_TYPE, impl_->SetLayerCompositionType(devId,
+                layerId, static_cast<V1_0::CompositionType>(state.compositionType)));
+        }
+        if ((state.dirty & CmdUtils::LAYER_STATE_BLEND_TYPE) != 0) {
+            CheckLayerStateResult(REQUEST_CMD_SET_LAYER_BLEND_TYPE,
+                impl_->SetLayerBlendType(devId, layerId, static_cast<V1_0::BlendType>(state.blendType)));
+        }
+        if ((state.dirty & CmdUtils::LAYER_STATE_MASK_INFO) != 0) {
+            CheckLayerStateResult(REQUEST_CMD_SET_LAYER_MASK_INFO,
+                impl_->SetLayerMaskInfo(devId, layerId, static_cast<V1_0::MaskInfo>(state.maskInfo)));
+        }
+        if ((state.dirty & CmdUtils::LAYER_STATE_ALPHA) != 0) {
+            CheckLayerStateResult(REQUEST_CMD_SET_LAYER_ALPHA, impl_->SetLayerAlpha(devId, layerId, state.alpha));
+        }
+        if ((state.dirty & CmdUtils::LAYER_STATE_REGION) != 0) {
+            CheckLayerStateResult(REQUEST_CMD_SET_LAYER_REGION, impl_->SetLayerRegion(devId, layerId, state.region));
+        }
+        if ((state.dirty & CmdUtils::LAYER_STATE_CROP) != 0) {
+            CheckLayerStateResult(REQUEST_CMD_SET_LAYER_CROP, impl_->SetLayerCrop(devId, layerId, state.crop));
+        }
+        if ((state.dirty & CmdUtils::LAYER_STATE_COLOR) != 0) {
+            CheckLayerStateResult(REQUEST_CMD_SET_LAYER_COLOR, impl_->SetLayerColor(devId, layerId, state.color));
+        }
+    }
+
+    void CheckLayerStateResult(int32_t cmd, int32_t ret)
+    {
+        if (ret != HDF_SUCCESS) {
+            HDF_LOGE("%{public}s: %{public}s failed, ret=%{public}d", __func__, CmdUtils::CommandToString(cmd), ret);
+            errMaps_.emplace(cmd, ret);
+        }
+    }
+
+    static int32_t ReadPerFrameParameter(CommandDataUnpacker& unpacker, std::string& key, std::vector<int8_t>& value)
+    {
+        const char *data = nullptr;
+        uint32_t len = 0;
+        DISPLAY_CHK_RETURN(unpacker.ReadRawBytes(data, len) == false, HDF_FAILURE,
+            HDF_LOGE("%{public}s: read key failed", __func__));
+        key.assign(data, len);
+
+        DISPLAY_CHK_RETURN(unpacker.ReadRawBytes(data, len) == false, HDF_FAILURE,
+            HDF_LOGE("%{public}s: read value failed", __func__));
+        value.assign(reinterpret_cast<const int8_t *>(data), reinterpret_cast<const int8_t *>(data) + len);
+        return HDF_SUCCESS;
+    }
+
+    // Reused across requests to keep the per frame batch allocation free
+    std::vector<LayerState> layersState_;
 };
 
 using HdiDisplayCmdResponser = DisplayCmdResponser<SharedMemQueue<int32_t>, DisplayComposerVdiAdapter>;
@@ -30,6 +30,31 @@ namespace Display {
 namespace Composer {
 namespace V1_2 {
 
+/*
+ * Commands added after the v1_2 DispCmd enum was released. The released IDL is frozen, so they are declared here
+ * and only sent to hosts that accepted the probe of the requester.
+ */
+constexpr int32_t REQUEST_CMD_SET_LAYER_PERFRAME_PARAM_RAW = 86;    // SetLayer cmd, key and value as raw bytes
+constexpr int32_t REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM_RAW = 87;  // SetDisplay cmd, key and value as raw bytes
+constexpr int32_t REQUEST_CMD_SET_LAYERS_STATE = 88;                // SetLayer cmd, fixed size states of many layers
+
+// Fixed size layer properties carried by REQUEST_CMD_SET_LAYERS_STATE, dirty tells which ones are set
+struct LayerState {
+    uint32_t devId = 0;
+    uint32_t layerId = 0;
+    uint32_t dirty = 0;
+    uint32_t zorder = 0;
+    bool preMulti = false;
+    int32_t transformType = 0;
+    int32_t compositionType = 0;
+    int32_t blendType = 0;
+    uint32_t maskInfo = 0;
+    V1_0::LayerAlpha alpha = {};
+    V1_0::IRect region = {};
+    V1_0::IRect crop = {};
+    V1_0::LayerColor color = {};
+};
+
 class DisplayCmdUtils : public V1_1::DisplayCmdUtils {
 public:
     #define SWITCHCASE(x) case (x): {return #x;}
@@ -59,6 +84,9 @@ public:
             SWITCHCASE(REQUEST_CMD_SET_DISPLAY_CONSTRAINT);
             SWITCHCASE(REQUEST_CMD_SET_LAYER_PERFRAME_PARAM);
             SWITCHCASE(REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM);
+            SWITCHCASE(REQUEST_CMD_SET_LAYER_PERFRAME_PARAM_RAW);
+            SWITCHCASE(REQUEST_CMD_SET_DISPLAY_PERFRAME_PARAM_RAW);
+            SWITCHCASE(REQUEST_CMD_SET_LAYERS_STATE);
             /* reply cmd */
             SWITCHCASE(REPLY_CMD_SET_ERROR);
             SWITCHCASE(REPLY_CMD_PREPARE_DISPLAY_LAYERS);
@@ -73,6 +101,284 @@ public:
                 return "unknow command id.";
         }
     }
+
+    // Dirty bits of LayerState, the field arrays of REQUEST_CMD_SET_LAYERS_STATE follow in bit order
+    static constexpr uint32_t LAYER_STATE_ZORDER = 1U << 0;
+    static constexpr uint32_t LAYER_STATE_PREMULTI = 1U << 1;
+    static constexpr uint32_t LAYER_STATE_TRANSFORM_MODE = 1U << 2;
+    static constexpr uint32_t LAYER_STATE_COMPOSITION_TYPE = 1U << 3;
+    static constexpr uint32_t LAYER_STATE_BLEND_TYPE = 1U << 4;
+    static constexpr uint32_t LAYER_STATE_MASK_INFO = 1U << 5;
+    static constexpr uint32_t LAYER_STATE_ALPHA = 1U << 6;
+    static constexpr uint32_t LAYER_STATE_REGION = 1U << 7;
+    static constexpr uint32_t LAYER_STATE_CROP = 1U << 8;
+    static constexpr uint32_t LAYER_STATE_COLOR = 1U << 9;
+    static constexpr uint32_t LAYER_STATE_FIELD_COUNT = 10;
+    static constexpr uint32_t LAYER_STATE_ALL = (1U << LAYER_STATE_FIELD_COUNT) - 1;
+
+    // Commands that set a LayerState field, the responder reports REQUEST_CMD_SET_LAYERS_STATE errors under them
+    static bool IsLayerStateCommand(int32_t cmdId)
+    {
+        switch (cmdId) {
+            case REQUEST_CMD_SET_LAYER_ZORDER:
+            case REQUEST_CMD_SET_LAYER_PREMULTI:
+            case REQUEST_CMD_SET_LAYER_TRANSFORM_MODE:
+            case REQUEST_CMD_SET_LAYER_COMPOSITION_TYPE:
+            case REQUEST_CMD_SET_LAYER_BLEND_TYPE:
+            case REQUEST_CMD_SET_LAYER_MASK_INFO:
+            case REQUEST_CMD_SET_LAYER_ALPHA:
+            case REQUEST_CMD_SET_LAYER_REGION:
+            case REQUEST_CMD_SET_LAYER_CROP:
+            case REQUEST_CMD_SET_LAYER_COLOR:
+            case REQUEST_CMD_SET_LAYERS_STATE:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /*
+     * Payload: devId, the layer ids and the dirty masks as two uint32 arrays, then for every field dirty on
+     * any layer one int32 array holding that field of the dirty layers only, in layer order.
+     */
+    static int32_t LayersStatePack(uint32_t devId, const std::vector<LayerState>& states, CommandDataPacker& packer)
+    {
+        std::vector<uint32_t> layerIds;
+        std::vector<uint32_t> dirtyMasks;
+        uint32_t dirtyFields = 0;
+        for (const auto& state : states) {
+            if (state.devId == devId && state.dirty != 0) {
+                layerIds.push_back(state.layerId);
+                dirtyMasks.push_back(state.dirty);
+                dirtyFields |= state.dirty;
+            }
+        }
+        uint32_t arrayLen = static_cast<uint32_t>(layerIds.size()) * ELEMENT_SIZE;
+        DISPLAY_CHK_RETURN(packer.WriteUint32(devId) == false, HDF_FAILURE,
+            HDF_LOGE("%{public}s, write devId error", __func__));
+        DISPLAY_CHK_RETURN(packer.WriteRawBytes(layerIds.data(), arrayLen) == false, HDF_FAILURE,
+            HDF_LOGE("%{public}s, write layer ids error", __func__));
+        DISPLAY_CHK_RETURN(packer.WriteRawBytes(dirtyMasks.data(), arrayLen) == false, HDF_FAILURE,
+            HDF_LOGE("%{public}s, write dirty masks error", __func__));
+
+        std::vector<int32_t> words;
+        for (uint32_t i = 0; i < LAYER_STATE_FIELD_COUNT; i++) {
+            uint32_t field = 1U << i;
+            if ((dirtyFields & field) == 0) {
+                continue;
+            }
+            words.clear();
+            for (const auto& state : states) {
+                if (state.devId == devId && (state.dirty & field) != 0) {
+                    LayerStateFieldEncode(field, state, words);
+                }
+            }
+            arrayLen = static_cast<uint32_t>(words.size()) * ELEMENT_SIZE;
+            DISPLAY_CHK_RETURN(packer.WriteRawBytes(words.data(), arrayLen) == false, HDF_FAILURE,
+                HDF_LOGE("%{public}s, write field %{public}u error", __func__, field));
+        }
+        return HDF_SUCCESS;
+    }
+
+    static int32_t LayersStateUnpack(CommandDataUnpacker& unpacker, std::vector<LayerState>& states)
+    {
+        uint32_t devId = 0;
+        const char *data = nullptr;
+        uint32_t len = 0;
+        DISPLAY_CHK_RETURN(unpacker.ReadUint32(devId) == false, HDF_FAILURE,
+            HDF_LOGE("%{public}s, read devId failed", __func__));
+        DISPLAY_CHK_RETURN(unpacker.ReadRawBytes(data, len) == false || len % ELEMENT_SIZE != 0 ||
+            len / ELEMENT_SIZE > MAX_ELE_COUNT, HDF_FAILURE, HDF_LOGE("%{public}s, read layer ids failed", __func__));
+        uint32_t count = len / ELEMENT_SIZE;
+        states.assign(count, LayerState());
+        for (uint32_t i = 0; i < count; i++) {
+            states[i].devId = devId;
+            (void)memcpy_s(&states[i].layerId, sizeof(uint32_t), data + i * ELEMENT_SIZE, ELEMENT_SIZE);
+        }
+
+        DISPLAY_CHK_RETURN(unpacker.ReadRawBytes(data, len) == false || len != count * ELEMENT_SIZE, HDF_FAILURE,
+            HDF_LOGE("%{public}s, read dirty masks failed", __func__));
+        uint32_t dirtyFields = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            (void)memcpy_s(&states[i].dirty, sizeof(uint32_t), data + i * ELEMENT_SIZE, ELEMENT_SIZE);
+            dirtyFields |= states[i].dirty;
+        }
+        DISPLAY_CHK_RETURN((dirtyFields & ~LAYER_STATE_ALL) != 0, HDF_FAILURE,
+            HDF_LOGE("%{public}s, unknown dirty fields 0x%{public}x", __func__, dirtyFields));
+
+        std::vector<int32_t> words;
+        for (uint32_t i = 0; i < LAYER_STATE_FIELD_COUNT; i++) {
+            uint32_t field = 1U << i;
+            if ((dirtyFields & field) == 0) {
+                continue;
+            }
+            uint32_t fieldWords = LayerStateFieldWords(field);
+            uint32_t dirtyCount = 0;
+            for (const auto& state : states) {
+                dirtyCount += (state.dirty & field) != 0 ? 1 : 0;
+            }
+            DISPLAY_CHK_RETURN(unpacker.ReadRawBytes(data, len) == false ||
+                len != dirtyCount * fieldWords * ELEMENT_SIZE, HDF_FAILURE,
+                HDF_LOGE("%{public}s, read field %{public}u failed", __func__, field));
+            words.resize(dirtyCount * fieldWords);
+            if (len != 0) {
+                DISPLAY_CHK_RETURN(memcpy_s(words.data(), words.size() * ELEMENT_SIZE, data, len) != EOK,
+                    HDF_FAILURE, HDF_LOGE("%{public}s, copy field %{public}u failed", __func__, field));
+            }
+            const int32_t *word = words.data();
+            for (auto& state : states) {
+                if ((state.dirty & field) != 0) {
+                    LayerStateFieldDecode(field, word, state);
+                    word += fieldWords;
+                }
+            }
+        }
+        return HDF_SUCCESS;
+    }
+
+    // Compares one field of two states, whatever their dirty masks say
+    static bool LayerStateFieldEqual(uint32_t field, const LayerState& lhs, const LayerState& rhs)
+    {
+        switch (field) {
+            case LAYER_STATE_ZORDER:
+                return lhs.zorder == rhs.zorder;
+            case LAYER_STATE_PREMULTI:
+                return lhs.preMulti == rhs.preMulti;
+            case LAYER_STATE_TRANSFORM_MODE:
+                return lhs.transformType == rhs.transformType;
+            case LAYER_STATE_COMPOSITION_TYPE:
+                return lhs.compositionType == rhs.compositionType;
+            case LAYER_STATE_BLEND_TYPE:
+                return lhs.blendType == rhs.blendType;
+            case LAYER_STATE_MASK_INFO:
+                return lhs.maskInfo == rhs.maskInfo;
+            case LAYER_STATE_ALPHA:
+                return lhs.alpha.enGlobalAlpha == rhs.alpha.enGlobalAlpha &&
+                    lhs.alpha.enPixelAlpha == rhs.alpha.enPixelAlpha && lhs.alpha.alpha0 == rhs.alpha.alpha0 &&
+                    lhs.alpha.alpha1 == rhs.alpha.alpha1 && lhs.alpha.gAlpha == rhs.alpha.gAlpha;
+            case LAYER_STATE_REGION:
+                return lhs.region.x == rhs.region.x && lhs.region.y == rhs.region.y &&
+                    lhs.region.w == rhs.region.w && lhs.region.h == rhs.region.h;
+            case LAYER_STATE_CROP:
+                return lhs.crop.x == rhs.crop.x && lhs.crop.y == rhs.crop.y &&
+                    lhs.crop.w == rhs.crop.w && lhs.crop.h == rhs.crop.h;
+            case LAYER_STATE_COLOR:
+                return lhs.color.r == rhs.color.r && lhs.color.g == rhs.color.g &&
+                    lhs.color.b == rhs.color.b && lhs.color.a == rhs.color.a;
+            default:
+                return false;
+        }
+    }
+
+    // Copies the dirty fields of src into dst and marks them dirty there
+    static void LayerStateMerge(const LayerState& src, LayerState& dst)
+    {
+        std::vector<int32_t> words;
+        for (uint32_t i = 0; i < LAYER_STATE_FIELD_COUNT; i++) {
+            uint32_t field = 1U << i;
+            if ((src.dirty & field) == 0) {
+                continue;
+            }
+            words.clear();
+            LayerStateFieldEncode(field, src, words);
+            LayerStateFieldDecode(field, words.data(), dst);
+        }
+        dst.dirty |= src.dirty;
+    }
+
+private:
+    static uint32_t LayerStateFieldWords(uint32_t field)
+    {
+        switch (field) {
+            case LAYER_STATE_ALPHA:
+                return 5; // enGlobalAlpha, enPixelAlpha, alpha0, alpha1, gAlpha
+            case LAYER_STATE_REGION:
+            case LAYER_STATE_CROP:
+            case LAYER_STATE_COLOR:
+                return 4; // x, y, w, h or r, g, b, a
+            default:
+                return 1;
+        }
+    }
+
+    static void LayerStateFieldEncode(uint32_t field, const LayerState& state, std::vector<int32_t>& words)
+    {
+        switch (field) {
+            case LAYER_STATE_ZORDER:
+                words.push_back(static_cast<int32_t>(state.zorder));
+                break;
+            case LAYER_STATE_PREMULTI:
+                words.push_back(state.preMulti ? 1 : 0);
+                break;
+            case LAYER_STATE_TRANSFORM_MODE:
+                words.push_back(state.transformType);
+                break;
+            case LAYER_STATE_COMPOSITION_TYPE:
+                words.push_back(state.compositionType);
+                break;
+            case LAYER_STATE_BLEND_TYPE:
+                words.push_back(state.blendType);
+                break;
+            case LAYER_STATE_MASK_INFO:
+                words.push_back(static_cast<int32_t>(state.maskInfo));
+                break;
+            case LAYER_STATE_ALPHA:
+                words.insert(words.end(), {state.alpha.enGlobalAlpha ? 1 : 0, state.alpha.enPixelAlpha ? 1 : 0,
+                    state.alpha.alpha0, state.alpha.alpha1, state.alpha.gAlpha});
+                break;
+            case LAYER_STATE_REGION:
+                words.insert(words.end(), {state.region.x, state.region.y, state.region.w, state.region.h});
+                break;
+            case LAYER_STATE_CROP:
+                words.insert(words.end(), {state.crop.x, state.crop.y, state.crop.w, state.crop.h});
+                break;
+            case LAYER_STATE_COLOR:
+                words.insert(words.end(), {state.color.r, state.color.g, state.color.b, state.color.a});
+                break;
+            default:
+                break;
+        }
+    }
+
+    static void LayerStateFieldDecode(uint32_t field, const int32_t *words, LayerState& state)
+    {
+        switch (field) {
+            case LAYER_STATE_ZORDER:
+                state.zorder = static_cast<uint32_t>(words[0]);
+                break;
+            case LAYER_STATE_PREMULTI:
+                state.preMulti = words[0] != 0;
+                break;
+            case LAYER_STATE_TRANSFORM_MODE:
+                state.transformType = words[0];
+                break;
+            case LAYER_STATE_COMPOSITION_TYPE:
+                state.compositionType = words[0];
+                break;
+            case LAYER_STATE_BLEND_TYPE:
+                state.blendType = words[0];
+                break;
+            case LAYER_STATE_MASK_INFO:
+                state.maskInfo = static_cast<uint32_t>(words[0]);
+                break;
+            case LAYER_STATE_ALPHA:
+                state.alpha = {words[0] != 0, words[1] != 0, static_cast<uint8_t>(words[2]),
+                    static_cast<uint8_t>(words[3]), static_cast<uint8_t>(words[4])};
+                break;
+            case LAYER_STATE_REGION:
+                state.region = {words[0], words[1], words[2], words[3]};
+                break;
+            case LAYER_STATE_CROP:
+                state.crop = {words[0], words[1], words[2], words[3]};
+                break;
+            case LAYER_STATE_COLOR:
+                state.color = {static_cast<uint8_t>(words[0]), static_cast<uint8_t>(words[1]),
+                    static_cast<uint8_t>(words[2]), static_cast<uint8_t>(words[3])};
+                break;
+            default:
+                break;
+        }
+    }
 };
 using CmdUtils = DisplayCmdUtils;
 } // namespace V1_2
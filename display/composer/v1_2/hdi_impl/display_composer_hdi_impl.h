@@ -16,6 +16,7 @@
 #ifndef OHOS_HDI_DISPLAY_V1_2_DISPLAY_COMPOSER_HDI_IMPL_H
 #define OHOS_HDI_DISPLAY_V1_2_DISPLAY_COMPOSER_HDI_IMPL_H
 
+#include "common/include/display_config.h"
 #include "v1_1/hdi_impl/display_composer_hdi_impl.h"
 #include "v1_2/display_command/display_cmd_requester.h"
 #include "v1_2/display_composer_type.h"
@@ -64,10 +65,31 @@ public:
         hdi_v1_2_(hdi),
         isSupportSkipValidate_(0),
         VBlankIdleCb_(nullptr),
-        VBlankIdleCbData_(nullptr) {}
+        VBlankIdleCbData_(nullptr) {
+            if (req_v1_2_ != nullptr) {
+                req_v1_2_->EnableLayerStateCache(GetEnableLayerStateCache());
+            }
+        }
 
     virtual ~DisplayComposerHdiImpl() {}
 
+    virtual int32_t DestroyLayer(uint32_t devId, uint32_t layerId) override
+    {
+        int32_t ret = BaseType1_1::DestroyLayer(devId, layerId);
+        if (req_v1_2_ != nullptr) {
+            req_v1_2_->InvalidateLayerStateCache(devId, layerId);
+        }
+        return ret;
+    }
+
+    virtual int32_t OnHotPlug(uint32_t outputId, bool connected) override
+    {
+        if (req_v1_2_ != nullptr) {
+            req_v1_2_->InvalidateLayerStateCache(outputId);
+        }
+        return BaseType1_1::OnHotPlug(outputId, connected);
+    }
+
     virtual int32_t CommitAndGetReleaseFence(uint32_t devId, int32_t& fence, int32_t& skipState, bool& needFlush,
         std::vector<uint32_t>& layers, std::vector<int32_t>& fences, bool isValidated) override
     {
@@ -31,8 +31,17 @@ using namespace OHOS::HDI::Base;
 template <typename Transfer, typename CompHdi>
 class DisplayCmdRequester : public V1_3::DisplayCmdRequester<Transfer, CompHdi> {
 public:
+    using FenceData = typename V1_2::DisplayCmdRequester<Transfer, CompHdi>::FenceData;
+    using CommitCallback = typename V1_2::DisplayCmdRequester<Transfer, CompHdi>::CommitCallback;
+
     DisplayCmdRequester(sptr<CompHdi> hdi) : BaseType1_3(hdi), hdi_v1_4_(hdi) {}
 
+    ~DisplayCmdRequester()
+    {
+        // The asynchronous request in flight uses hdi_v1_4_
+        WaitAsyncRequest();
+    }
+
     // UINT32_MAX IS THE DEFAULT DEVID.
     static std::unique_ptr<DisplayCmdRequester> Create(sptr<CompHdi> hdi, uint32_t devId = UINT32_MAX)
     {
@@ -71,6 +80,9 @@ public:
         DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
             HDF_LOGE("%{public}s: StartPack failed", __func__));
 
+        ProbeHostCommands([this, devId](uint32_t& replyEleCnt, std::vector<HdifdInfo>& outFds) {
+            return DoRequest(devId, requestPacker_, requestHdiFds_, replyEleCnt, outFds);
+        });
         return HDF_SUCCESS;
     }
 
@@ -80,29 +92,14 @@ public:
         uint32_t replyEleCnt = 0;
         std::vector<HdifdInfo> outFds;
 
-        int32_t ret = CmdUtils::StartSection(REQUEST_CMD_COMMIT_AND_GET_RELEASE_FENCE, requestPacker_);
-        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
-
-        ret = requestPacker_.WriteUint32(devId) ? HDF_SUCCESS : HDF_FAILURE;
-        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
-
-        ret = requestPacker_.WriteBool(isSupportSkipValidate) ? HDF_SUCCESS : HDF_FAILURE;
-        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
-
-        ret = requestPacker_.WriteBool(isValidated) ? HDF_SUCCESS : HDF_FAILURE;
-        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
-
-        ret = CmdUtils::EndSection(requestPacker_);
-        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
-
-        ret = CmdUtils::EndPack(requestPacker_);
+        int32_t ret = PackCommitAndGetReleaseFence(devId, isSupportSkipValidate, isValidated);
         DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
 
         ret = DoRequest(devId, replyEleCnt, outFds);
         DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
 
         ret = DoReplyResults(replyEleCnt, outFds, [&](void *data) -> int32_t {
-            FenceData *fenceData = reinterpret_cast<struct FenceData *>(data);
+            FenceData *fenceData = reinterpret_cast<FenceData *>(data);
             if (fenceData == nullptr) {
                 fence = -1;
                 skipState = -1;
@@ -123,21 +120,67 @@ public:
         }
 
 EXIT:
+        FinishLayerStateFrame(ret != HDF_SUCCESS || HasLayerStateError(replyErrMaps_));
         return PeriodDataReset() == HDF_SUCCESS ? ret : HDF_FAILURE;
     }
 
+    // Per-device variant of V1_2::DisplayCmdRequester::CommitAndGetReleaseFenceAsync, same threading rules.
+    int32_t CommitAndGetReleaseFenceAsync(uint32_t devId, bool isSupportSkipValidate, bool isValidated,
+        CommitCallback callback)
+    {
+        DISPLAY_CHK_RETURN(callback == nullptr, HDF_FAILURE, HDF_LOGE("%{public}s: callback is nullptr", __func__));
+        int32_t ret = PackCommitAndGetReleaseFence(devId, isSupportSkipValidate, isValidated);
+        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
+
+        ret = SubmitAsyncRequest([this, devId, callback](CommandDataPacker& packer,
+            const std::vector<HdifdInfo>& hdiFds) {
+            uint32_t replyEleCnt = 0;
+            std::vector<HdifdInfo> outFds;
+            FenceData fenceData;
+            int32_t requestRet = DoRequest(devId, packer, hdiFds, replyEleCnt, outFds);
+            int32_t transferRet = requestRet;
+            if (requestRet == HDF_SUCCESS) {
+                transferRet = DoReplyResults(replyEleCnt, outFds, [&fenceData](void *data) -> int32_t {
+                    DISPLAY_CHK_RETURN(data == nullptr, HDF_FAILURE, HDF_LOGE("fence data is nullptr"));
+                    fenceData = std::move(*reinterpret_cast<FenceData *>(data));
+                    return HDF_SUCCESS;
+                });
+            }
+            // replyErrMaps_ belongs to this reply only until the caller transfers again, read it before callback
+            FinishLayerStateFrame(transferRet != HDF_SUCCESS || HasLayerStateError(replyErrMaps_));
+            callback(transferRet, fenceData);
+            return requestRet;
+        });
+        DISPLAY_CHECK(ret != HDF_SUCCESS, goto EXIT);
+        return HDF_SUCCESS;
+
+EXIT:
+        WaitAsyncRequest();
+        FinishLayerStateFrame(true);
+        PeriodDataReset();
+        return HDF_FAILURE;
+    }
+
     int32_t DoRequest(uint32_t devId, uint32_t &replyEleCnt, std::vector<HdifdInfo> &outFds)
     {
+        // The SMQs and the reply buffer are shared with the asynchronous request in flight
+        WaitAsyncRequest();
+        return DoRequest(devId, requestPacker_, requestHdiFds_, replyEleCnt, outFds);
+    }
+
+    int32_t DoRequest(uint32_t devId, CommandDataPacker &packer, const std::vector<HdifdInfo> &hdiFds,
+        uint32_t &replyEleCnt, std::vector<HdifdInfo> &outFds)
+    {
 #ifdef DEBUG_DISPLAY_CMD_RAW_DATA
-        requestPacker_.Dump();
+        packer.Dump();
 #endif // DEBUG_DISPLAY_CMD_RAW_DATA
-        uint32_t eleCnt = requestPacker_.ValidSize() >> CmdUtils::MOVE_SIZE;
+        uint32_t eleCnt = packer.ValidSize() >> CmdUtils::MOVE_SIZE;
         int32_t ret = request_->Write(
-            reinterpret_cast<int32_t *>(requestPacker_.GetDataPtr()), eleCnt, CmdUtils::TRANSFER_WAIT_TIME);
+            reinterpret_cast<int32_t *>(packer.GetDataPtr()), eleCnt, CmdUtils::TRANSFER_WAIT_TIME);
         DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
             HDF_LOGE("%{public}s: CmdRequest write failed", __func__));
 
-        ret = hdi_v1_4_->DoCmdRequest(devId, eleCnt, requestHdiFds_, replyEleCnt, outFds);
+        ret = hdi_v1_4_->DoCmdRequest(devId, eleCnt, hdiFds, replyEleCnt, outFds);
         DISPLAY_CHK_RETURN(ret != HDF_SUCCESS, ret,
             HDF_LOGE("%{public}s: CmdRequest failed", __func__));
 
@@ -164,15 +207,13 @@ private:
     using BaseType1_3::PeriodDataReset;
     using BaseType1_3::requestHdiFds_;
     using BaseType1_3::DoReplyResults;
-
-    // CommitAndGetReleaseFence
-    struct FenceData {
-        int32_t fence_ = -1;
-        int32_t skipValidateState_ = -1;
-        bool needFlush_ = false;
-        std::vector<uint32_t> layers;
-        std::vector<int32_t> fences;
-    };
+    using BaseType1_3::PackCommitAndGetReleaseFence;
+    using BaseType1_3::SubmitAsyncRequest;
+    using BaseType1_3::WaitAsyncRequest;
+    using BaseType1_3::ProbeHostCommands;
+    using BaseType1_3::HasLayerStateError;
+    using BaseType1_3::FinishLayerStateFrame;
+    using BaseType1_3::replyErrMaps_;
 };
 using HdiDisplayCmdRequester = V1_4::DisplayCmdRequester<SharedMemQueue<int32_t>, V1_4::IDisplayComposer>;
 } // namespace V1_4
@@ -82,6 +82,7 @@ public:
         DISPLAY_TRACE;
 
         HDF_LOGI("OnHotPlug(%{public}u, %{public}u)", outputId, connected);
+        InvalidateLayerStateCache(outputId, CmdReq::ALL_LAYERS);
         int32_t ret = HDF_SUCCESS;
         if (hotPlugCb_ != nullptr) {
             hotPlugCb_(outputId, connected, hotPlugCbData_);
@@ -96,6 +97,13 @@ public:
         return ret;
     }
 
+    virtual int32_t DestroyLayer(uint32_t devId, uint32_t layerId) override
+    {
+        int32_t ret = BaseType1_3::DestroyLayer(devId, layerId);
+        InvalidateLayerStateCache(devId, layerId);
+        return ret;
+    }
+
     virtual int32_t SetLayerAlpha(uint32_t devId, uint32_t layerId, const LayerAlpha& alpha) override
     {
         std::shared_ptr<CmdReq> reqCur = GetRequest(devId);
@@ -301,6 +309,7 @@ protected:
                 HDF_LOGE("%{public}s: Create DisplayCmdRequester for devId[%{public}u] failed.", __func__, outputId);
                 return;
             }
+            ReqCur->EnableLayerStateCache(GetEnableLayerStateCache());
             reqMap_.insert({outputId, ReqCur});
         } else {
             auto reqItem = reqMap_.find(outputId);
@@ -313,6 +322,19 @@ protected:
         HDF_LOGI("%{public}s: the size of reqMap_: %{public}zu.", __func__, reqMap_.size());
     }
 
+    // Tells the requesters a display may serve that the server no longer holds what they cached for it
+    void InvalidateLayerStateCache(uint32_t devId, uint32_t layerId)
+    {
+        if (req_v1_4_ != nullptr) {
+            req_v1_4_->InvalidateLayerStateCache(devId, layerId);
+        }
+        std::lock_guard<std::mutex> lock(reqMapMutex_);
+        auto reqItem = reqMap_.find(devId);
+        if (reqItem != reqMap_.end() && reqItem->second != nullptr && reqItem->second != req_v1_4_) {
+            reqItem->second->InvalidateLayerStateCache(devId, layerId);
+        }
+    }
+
     std::shared_ptr<CmdReq> GetRequest(uint32_t devId)
     {
         if (!GetEnableParallel()) {